@@ -27,6 +27,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Graphics/GraphicsManager.h"
 #include "Configs/ConfigPath.h"
 #include "Debugging/Performance.h"
+#include "Debugging/Profiler.h"
 #include "Scripting/ScriptManager.h"
 #include "Physics/PhysicsManager.h"
 
@@ -186,6 +187,11 @@ namespace Application {
                 --------------------------------------------------------------*/
                 ecs.EndFrame();
 
+                /*--------------------------------------------------------------
+                    Profiler Endframe
+                --------------------------------------------------------------*/
+                KOS_PROFILE_END_FRAME();
+
                 graphicsManager.gm_ClearGBuffer();
 
                 glfwSwapBuffers(lvWindow.window);
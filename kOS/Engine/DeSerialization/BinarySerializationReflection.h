@@ -0,0 +1,273 @@
+/******************************************************************/
+/*!
+\file      BinarySerializationReflection.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   Reflection for the binary scene format. Members are written
+		   back to back in declaration order, there are no keys, so
+		   loading is a straight read of the fields.
+
+		   The members covered match SerializationReflection.h,
+		   members the JSON format skips are skipped here too.
+		   - float, int, bool, glm vectors: raw bytes
+		   - std::string: uint32 length, then the characters
+		   - GUID: high, low
+		   - enums: int32
+		   - std::vector: uint32 count, then the elements
+		   - reflectable structs: their members
+
+		   The schema hash covers the member names and sizes, a
+		   component that changed since the file was written is
+		   detected before anything is loaded.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+namespace serialization {
+
+	class BinaryWriter {
+	public:
+		template <typename T>
+		void Write(const T& value) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			const size_t offset = m_buffer.size();
+			m_buffer.resize(offset + sizeof(T));
+			std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+		}
+
+		void WriteString(std::string_view text) {
+			Write(static_cast<uint32_t>(text.size()));
+			m_buffer.insert(m_buffer.end(), text.begin(), text.end());
+		}
+
+		//overwrites a value written earlier, eg. an offset that was not known yet
+		template <typename T>
+		void Patch(size_t offset, const T& value) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+		}
+
+		size_t Size() const { return m_buffer.size(); }
+		const std::vector<unsigned char>& Buffer() const { return m_buffer; }
+
+	private:
+		std::vector<unsigned char> m_buffer;
+	};
+
+	class BinaryReader {
+	public:
+		BinaryReader(const unsigned char* data, size_t size) : m_data(data), m_size(size) {}
+
+		//reading past the end fails the reader and yields zeroed values
+		template <typename T>
+		T Read() {
+			static_assert(std::is_trivially_copyable_v<T>);
+			T value{};
+			if (m_failed || m_size - m_offset < sizeof(T)) {
+				m_failed = true;
+				return value;
+			}
+			std::memcpy(&value, m_data + m_offset, sizeof(T));
+			m_offset += sizeof(T);
+			return value;
+		}
+
+		//points into the reader's memory
+		std::string_view ReadString() {
+			const uint32_t length = Read<uint32_t>();
+			if (m_failed || m_size - m_offset < length) {
+				m_failed = true;
+				return {};
+			}
+			std::string_view text{ reinterpret_cast<const char*>(m_data + m_offset), length };
+			m_offset += length;
+			return text;
+		}
+
+		//memory of the next count bytes, nullptr past the end
+		const unsigned char* Skip(size_t count) {
+			if (m_failed || m_size - m_offset < count) {
+				m_failed = true;
+				return nullptr;
+			}
+			const unsigned char* data = m_data + m_offset;
+			m_offset += count;
+			return data;
+		}
+
+		bool Failed() const { return m_failed; }
+		bool AtEnd() const { return m_offset == m_size; }
+		size_t Offset() const { return m_offset; }
+
+	private:
+		const unsigned char* m_data{};
+		size_t m_size{};
+		size_t m_offset{};
+		bool m_failed{ false };
+	};
+}
+
+struct SaveComponentBinary {
+
+	serialization::BinaryWriter& writer;
+
+	void operator()(float& _args) { writer.Write(_args); }
+	void operator()(int& _args) { writer.Write(static_cast<int32_t>(_args)); }
+	void operator()(bool& _args) { writer.Write(static_cast<uint8_t>(_args)); }
+	void operator()(glm::vec2& _args) { writer.Write(_args); }
+	void operator()(glm::vec3& _args) { writer.Write(_args); }
+	void operator()(glm::vec4& _args) { writer.Write(_args); }
+	void operator()(std::string& _args) { writer.WriteString(_args); }
+
+	void operator()(utility::GUID& _args) {
+		writer.Write(_args.high);
+		writer.Write(_args.low);
+	}
+
+	template <typename EnumType>
+		requires std::is_enum_v<EnumType>
+	void operator()(EnumType& _args) {
+		writer.Write(static_cast<int32_t>(_args));
+	}
+
+	template <typename U>
+	void operator()(std::vector<U>& _args) {
+		writer.Write(static_cast<uint32_t>(_args.size()));
+		for (U& x : _args) {
+			(*this)(x);
+		}
+	}
+
+	template <typename K>
+	void operator()(K& _args) {
+		if constexpr (std::is_class_v<K> && requires { K::Names(); }) {
+			_args.ApplyFunction([&](auto& member) {
+				(*this)(member);
+				});
+		}
+	}
+};
+
+struct LoadComponentBinary {
+
+	serialization::BinaryReader& reader;
+
+	void operator()(float& _args) { _args = reader.Read<float>(); }
+	void operator()(int& _args) { _args = static_cast<int>(reader.Read<int32_t>()); }
+	void operator()(bool& _args) { _args = reader.Read<uint8_t>() != 0; }
+	void operator()(glm::vec2& _args) { _args = reader.Read<glm::vec2>(); }
+	void operator()(glm::vec3& _args) { _args = reader.Read<glm::vec3>(); }
+	void operator()(glm::vec4& _args) { _args = reader.Read<glm::vec4>(); }
+	void operator()(std::string& _args) { _args = reader.ReadString(); }
+
+	void operator()(utility::GUID& _args) {
+		_args.high = reader.Read<uint64_t>();
+		_args.low = reader.Read<uint64_t>();
+	}
+
+	template <typename EnumType>
+		requires std::is_enum_v<EnumType>
+	void operator()(EnumType& _args) {
+		_args = static_cast<EnumType>(reader.Read<int32_t>());
+	}
+
+	template <typename U>
+	void operator()(std::vector<U>& _args) {
+		const uint32_t count = reader.Read<uint32_t>();
+		_args.clear();
+		//a corrupt count must not reserve gigabytes, grow as the elements are actually read
+		for (uint32_t i = 0; i < count && !reader.Failed(); ++i) {
+			U temp{};
+			(*this)(temp);
+			_args.push_back(std::move(temp));
+		}
+	}
+
+	template <typename K>
+	void operator()(K& _args) {
+		if constexpr (std::is_class_v<K> && requires { K::Names(); }) {
+			_args.ApplyFunction([&](auto& member) {
+				(*this)(member);
+				});
+		}
+	}
+};
+
+struct HashComponentSchema {
+
+	uint64_t hash{ 14695981039346656037ull };
+
+	void Add(const void* data, size_t size) {
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; ++i) {
+			hash = (hash ^ bytes[i]) * 1099511628211ull;
+		}
+	}
+
+	void Add(std::string_view text) { Add(text.data(), text.size()); }
+
+	template <typename K>
+	void AddType() {
+		const uint64_t size = sizeof(K);
+		Add(&size, sizeof(size));
+		if constexpr (std::is_class_v<K> && requires { K::Names(); }) {
+			for (const std::string& name : K::Names()) {
+				Add(name);
+			}
+			K temp{};
+			temp.ApplyFunction([&](auto& member) {
+				(*this)(member);
+				});
+		}
+	}
+
+	template <typename K>
+	void operator()(K&) {
+		AddType<K>();
+	}
+
+	template <typename U>
+	void operator()(std::vector<U>&) {
+		Add("vector");
+		AddType<U>();
+	}
+};
+
+template<typename T>
+inline void SaveComponentBinaryReflect(T* component, serialization::BinaryWriter& writer)
+{
+	if (component == nullptr) return;
+	SaveComponentBinary saver{ writer };
+	component->ApplyFunction([&](auto& member) {
+		saver(member);
+		});
+}
+
+template<typename T>
+inline void LoadComponentBinaryReflect(T* component, serialization::BinaryReader& reader)
+{
+	if (component == nullptr) return;
+	LoadComponentBinary loader{ reader };
+	component->ApplyFunction([&](auto& member) {
+		loader(member);
+		});
+}
+
+template<typename T>
+inline uint64_t ComponentSchemaHash()
+{
+	static const uint64_t hash = [] {
+		HashComponentSchema hasher;
+		hasher.Add(T::classname());
+		hasher.AddType<T>();
+		return hasher.hash;
+	}();
+	return hash;
+}
@@ -0,0 +1,359 @@
+/******************************************************************/
+/*!
+\file      binary_scene.cpp
+\author    Jaz Winn Ng, jazwinn.ng, 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Compiled binary form of a JSON scene. JSON stays the
+		   authoring format, the binary file sits next to it and is
+		   used whenever it is newer than the JSON it came from.
+
+		   Layout, all values little endian as written by the engine:
+			- header: magic, version, JSON size and write time,
+			  entity count, component type count
+			- scene data: byte size, then the reflected fields
+			- entity table: GUID and parent index per entity, in the
+			  same depth first order SaveScene writes them, so a
+			  parent always comes before its children
+			- one block per component type: name, schema hash,
+			  record count, byte size, then the records. A record is
+			  the entity index followed by the component's fields.
+
+		   Loading maps the file and reads the fields straight out of
+		   the mapping. There is no parsing and no key lookup, and every
+		   component pool is reserved once for its whole block.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "Config/pch.h"
+#include "json_handler.h"
+#include "BinarySerializationReflection.h"
+
+#include "ECS/ECS.h"
+#include "Debugging/Logging.h"
+#include "Debugging/Profiler.h"
+#include "Utility/MappedFile.h"
+
+namespace serialization {
+
+	namespace {
+		constexpr uint32_t BINARY_SCENE_MAGIC = 0x53534F4B; // "KOSS"
+		constexpr uint32_t BINARY_SCENE_VERSION = 1;
+
+		struct BinarySceneHeader {
+			uint32_t magic{};
+			uint32_t version{};
+			uint64_t sourceSize{};
+			int64_t sourceTime{};
+			uint32_t entityCount{};
+			uint32_t componentTypeCount{};
+		};
+
+		struct BinaryComponentBlock {
+			IActionInvoker* invoker{};
+			std::string name;
+			uint32_t count{};
+			const unsigned char* data{};
+			size_t size{};
+		};
+
+		//size and write time of the JSON, the binary is only used while both match
+		bool GetSourceStamp(const std::filesystem::path& jsonFilePath, uint64_t& size, int64_t& time) {
+			std::error_code error;
+			size = static_cast<uint64_t>(std::filesystem::file_size(jsonFilePath, error));
+			if (error) return false;
+			time = static_cast<int64_t>(std::filesystem::last_write_time(jsonFilePath, error).time_since_epoch().count());
+			return !error;
+		}
+
+		BinarySceneHeader ReadHeader(BinaryReader& reader) {
+			BinarySceneHeader header;
+			header.magic = reader.Read<uint32_t>();
+			header.version = reader.Read<uint32_t>();
+			header.sourceSize = reader.Read<uint64_t>();
+			header.sourceTime = reader.Read<int64_t>();
+			header.entityCount = reader.Read<uint32_t>();
+			header.componentTypeCount = reader.Read<uint32_t>();
+			return header;
+		}
+	}
+
+	std::filesystem::path Serialization::GetBinaryScenePath(const std::filesystem::path& jsonFilePath)
+	{
+		std::filesystem::path binaryPath = jsonFilePath;
+		binaryPath += ".bin";
+		return binaryPath;
+	}
+
+	bool Serialization::IsBinarySceneCurrent(const std::filesystem::path& jsonFilePath)
+	{
+		uint64_t sourceSize{};
+		int64_t sourceTime{};
+		if (!GetSourceStamp(jsonFilePath, sourceSize, sourceTime)) return false;
+
+		std::ifstream file(GetBinaryScenePath(jsonFilePath), std::ios::binary);
+		if (!file) return false;
+
+		unsigned char bytes[sizeof(uint32_t) * 2 + sizeof(uint64_t) + sizeof(int64_t)]{};
+		if (!file.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) return false;
+
+		BinaryReader reader(bytes, sizeof(bytes));
+		const uint32_t magic = reader.Read<uint32_t>();
+		const uint32_t version = reader.Read<uint32_t>();
+		const uint64_t size = reader.Read<uint64_t>();
+		const int64_t time = reader.Read<int64_t>();
+
+		return magic == BINARY_SCENE_MAGIC && version == BINARY_SCENE_VERSION && size == sourceSize && time == sourceTime;
+	}
+
+	bool Serialization::SaveSceneBinary(const std::string& sceneName, const std::filesystem::path& jsonFilePath)
+	{
+		KOS_PROFILE_SCOPE("Serialization::SaveSceneBinary");
+
+		BinarySceneHeader header;
+		header.magic = BINARY_SCENE_MAGIC;
+		header.version = BINARY_SCENE_VERSION;
+		if (!GetSourceStamp(jsonFilePath, header.sourceSize, header.sourceTime)) {
+			LOGGING_WARN("Binary scene not written, {} does not exist", jsonFilePath.string());
+			return false;
+		}
+
+		const auto sceneIt = m_ecs.sceneMap.find(sceneName);
+		SceneData sceneData;
+		if (sceneIt != m_ecs.sceneMap.end()) {
+			sceneData = sceneIt->second;
+		}
+
+		//same order as SaveScene, roots then their children depth first
+		std::vector<ecs::EntityID> entities;
+		std::vector<int32_t> parents;
+		std::unordered_map<ecs::EntityID, uint32_t> entityIndex;
+		if (sceneIt != m_ecs.sceneMap.end()) {
+			std::function<void(ecs::EntityID, int32_t)> addEntity = [&](ecs::EntityID id, int32_t parent) {
+				if (entityIndex.find(id) != entityIndex.end()) return;
+				const uint32_t index = static_cast<uint32_t>(entities.size());
+				entityIndex[id] = index;
+				entities.push_back(id);
+				parents.push_back(parent);
+
+				std::optional<std::vector<ecs::EntityID>> children = m_ecs.GetChild(id);
+				if (children.has_value()) {
+					for (ecs::EntityID child : children.value()) {
+						addEntity(child, static_cast<int32_t>(index));
+					}
+				}
+			};
+
+			const std::vector<ecs::EntityID> sceneEntities = sceneIt->second.sceneIDs;
+			for (ecs::EntityID id : sceneEntities) {
+				if (!m_ecs.GetParent(id).has_value()) {
+					addEntity(id, -1);
+				}
+			}
+		}
+
+		BinaryWriter writer;
+		header.entityCount = static_cast<uint32_t>(entities.size());
+		writer.Write(header.magic);
+		writer.Write(header.version);
+		writer.Write(header.sourceSize);
+		writer.Write(header.sourceTime);
+		writer.Write(header.entityCount);
+		const size_t typeCountOffset = writer.Size();
+		writer.Write(header.componentTypeCount);
+
+		{
+			const size_t sizeOffset = writer.Size();
+			writer.Write(uint64_t{});
+			SaveComponentBinaryReflect(&sceneData, writer);
+			writer.Patch(sizeOffset, static_cast<uint64_t>(writer.Size() - sizeOffset - sizeof(uint64_t)));
+		}
+
+		for (size_t i = 0; i < entities.size(); ++i) {
+			utility::GUID guid{};
+			ecs::NameComponent* nameComp = m_ecs.GetComponent<ecs::NameComponent>(entities[i]);
+			if (nameComp) {
+				//same as SaveEntity, entities without a GUID get one now
+				if (nameComp->entityGUID.Empty()) {
+					nameComp->entityGUID = utility::GenerateGUID();
+					m_ecs.InsertGUID(nameComp->entityGUID, entities[i]);
+				}
+				guid = nameComp->entityGUID;
+			}
+			writer.Write(guid.high);
+			writer.Write(guid.low);
+			writer.Write(parents[i]);
+		}
+
+		const auto& componentKey = m_ecs.GetComponentKeyData();
+		for (const auto& [componentName, key] : componentKey) {
+			const auto actionIt = m_ecs.componentAction.find(componentName);
+			if (actionIt == m_ecs.componentAction.end()) continue;
+			IActionInvoker* invoker = actionIt->second.get();
+
+			uint32_t count{};
+			for (ecs::EntityID id : entities) {
+				if (m_ecs.GetEntitySignature(id).test(key)) ++count;
+			}
+			if (count == 0) continue;
+
+			writer.WriteString(componentName);
+			writer.Write(invoker->GetSchemaHash());
+			writer.Write(count);
+			const size_t sizeOffset = writer.Size();
+			writer.Write(uint64_t{});
+
+			for (uint32_t index = 0; index < entities.size(); ++index) {
+				if (!m_ecs.GetEntitySignature(entities[index]).test(key)) continue;
+				auto* component = m_ecs.GetIComponent<ecs::Component*>(componentName, entities[index]);
+				writer.Write(index);
+				invoker->SaveBinary(component, writer);
+			}
+
+			writer.Patch(sizeOffset, static_cast<uint64_t>(writer.Size() - sizeOffset - sizeof(uint64_t)));
+			++header.componentTypeCount;
+		}
+		writer.Patch(typeCountOffset, header.componentTypeCount);
+
+		const std::filesystem::path binaryPath = GetBinaryScenePath(jsonFilePath);
+		std::ofstream outputFile(binaryPath, std::ios::binary | std::ios::trunc);
+		if (!outputFile) {
+			LOGGING_WARN("Failed to open binary scene for writing: {}", binaryPath.string());
+			return false;
+		}
+		outputFile.write(reinterpret_cast<const char*>(writer.Buffer().data()), static_cast<std::streamsize>(writer.Size()));
+		if (!outputFile) {
+			LOGGING_WARN("Failed to write binary scene: {}", binaryPath.string());
+			return false;
+		}
+
+		LOGGING_INFO("Save Binary Scene Successful");
+		return true;
+	}
+
+	bool Serialization::LoadSceneBinary(const std::filesystem::path& binaryFilePath, const std::string& sceneName)
+	{
+		KOS_PROFILE_SCOPE("Serialization::LoadSceneBinary");
+
+		utility::MappedFile file;
+		if (!file.Open(binaryFilePath)) {
+			LOGGING_WARN("Failed to map binary scene: {}", binaryFilePath.string());
+			return false;
+		}
+
+		BinaryReader reader(file.Data(), file.Size());
+		const BinarySceneHeader header = ReadHeader(reader);
+		if (reader.Failed() || header.magic != BINARY_SCENE_MAGIC || header.version != BINARY_SCENE_VERSION) {
+			LOGGING_WARN("Not a binary scene of this version: {}", binaryFilePath.string());
+			return false;
+		}
+
+		//everything is checked before the first entity is created, a file that is
+		//rejected here leaves the ECS untouched so the caller can fall back to JSON
+		SceneData sceneData;
+		{
+			const uint64_t size = reader.Read<uint64_t>();
+			const unsigned char* data = reader.Failed() || size > file.Size() ? nullptr : reader.Skip(static_cast<size_t>(size));
+			if (!data) {
+				LOGGING_WARN("Binary scene data is truncated: {}", binaryFilePath.string());
+				return false;
+			}
+			BinaryReader sceneReader(data, static_cast<size_t>(size));
+			LoadComponentBinaryReflect(&sceneData, sceneReader);
+			if (sceneReader.Failed() || !sceneReader.AtEnd()) {
+				LOGGING_WARN("Binary scene data does not match SceneData: {}", binaryFilePath.string());
+				return false;
+			}
+		}
+
+		constexpr size_t entityRecordSize = sizeof(uint64_t) * 2 + sizeof(int32_t);
+		const uint64_t entityTableSize = static_cast<uint64_t>(header.entityCount) * entityRecordSize;
+		const unsigned char* entityTable = entityTableSize > file.Size() ? nullptr : reader.Skip(static_cast<size_t>(entityTableSize));
+		if (!entityTable) {
+			LOGGING_WARN("Binary scene entity table is truncated: {}", binaryFilePath.string());
+			return false;
+		}
+
+		std::vector<BinaryComponentBlock> blocks;
+		blocks.reserve(header.componentTypeCount);
+		for (uint32_t i = 0; i < header.componentTypeCount; ++i) {
+			BinaryComponentBlock block;
+			block.name = reader.ReadString();
+			const uint64_t schemaHash = reader.Read<uint64_t>();
+			block.count = reader.Read<uint32_t>();
+			const uint64_t size = reader.Read<uint64_t>();
+			block.size = static_cast<size_t>(size);
+			block.data = reader.Failed() || size > file.Size() ? nullptr : reader.Skip(block.size);
+			if (!block.data) {
+				LOGGING_WARN("Binary scene component block {} is truncated: {}", block.name, binaryFilePath.string());
+				return false;
+			}
+
+			const auto actionIt = m_ecs.componentAction.find(block.name);
+			if (actionIt == m_ecs.componentAction.end()) {
+				LOGGING_WARN("Binary scene skips unknown component {}", block.name);
+				continue;
+			}
+			if (actionIt->second->GetSchemaHash() != schemaHash) {
+				LOGGING_WARN("Binary scene is out of date, {} changed since it was written", block.name);
+				return false;
+			}
+			block.invoker = actionIt->second.get();
+			blocks.push_back(std::move(block));
+		}
+
+		m_ecs.AddScene(sceneName, sceneData);
+
+		//entities join their systems once, after all their components are loaded
+		ecs::RegistrationBatchScope registrationBatch(m_ecs);
+
+		BinaryReader entityReader(entityTable, static_cast<size_t>(entityTableSize));
+		std::vector<ecs::EntityID> entities(header.entityCount);
+		std::vector<int32_t> parents(header.entityCount);
+		for (uint32_t i = 0; i < header.entityCount; ++i) {
+			utility::GUID guid{};
+			guid.high = entityReader.Read<uint64_t>();
+			guid.low = entityReader.Read<uint64_t>();
+			parents[i] = entityReader.Read<int32_t>();
+
+			entities[i] = m_ecs.CreateEntity(sceneName);
+			if (!guid.Empty()) {
+				ecs::NameComponent* nameComp = m_ecs.GetComponent<ecs::NameComponent>(entities[i]);
+				if (nameComp) {
+					nameComp->entityGUID = guid;
+					m_ecs.InsertGUID(guid, entities[i]);
+				}
+			}
+		}
+
+		for (const BinaryComponentBlock& block : blocks) {
+			ISparseSet* pool = m_ecs.GetComponentPool(block.name);
+			if (pool) {
+				pool->Reserve(block.count);
+			}
+
+			BinaryReader recordReader(block.data, block.size);
+			for (uint32_t i = 0; i < block.count; ++i) {
+				const uint32_t index = recordReader.Read<uint32_t>();
+				if (recordReader.Failed() || index >= header.entityCount) break;
+				block.invoker->LoadBinary(entities[index], recordReader);
+			}
+			if (recordReader.Failed() || !recordReader.AtEnd()) {
+				LOGGING_ERROR("Binary scene component block {} is corrupt, remaining records skipped", block.name);
+			}
+		}
+
+		//parents are always earlier in the table than their children
+		for (uint32_t i = 0; i < header.entityCount; ++i) {
+			if (parents[i] >= 0 && static_cast<uint32_t>(parents[i]) < i) {
+				m_ecs.SetParent(entities[parents[i]], entities[i]);
+			}
+		}
+
+		LOGGING_INFO("Load Binary Scene Successful");
+		return true;
+	}
+}
@@ -45,6 +45,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "ECS/ECS.h"
 #include "Debugging/Logging.h"
+#include "Debugging/Profiler.h"
 #include "ECS/ecs.h"
 
 
@@ -56,6 +57,28 @@ namespace serialization{
 
 	void  Serialization::LoadScene(const std::filesystem::path& jsonFilePath, const std::string sceneName)
 	{
+		KOS_PROFILE_SCOPE("Serialization::LoadScene");
+
+		std::string scenename = sceneName.empty() ? jsonFilePath.filename().string() : sceneName;
+
+		if (IsBinarySceneCurrent(jsonFilePath) && LoadSceneBinary(GetBinaryScenePath(jsonFilePath), scenename)) {
+			return;
+		}
+
+		//only a scene loaded on its own matches its file, not one merged into an open scene
+		const auto sceneIt = m_ecs.sceneMap.find(scenename);
+		const bool compileBinary = sceneIt == m_ecs.sceneMap.end() || sceneIt->second.sceneIDs.empty();
+
+		LoadSceneJson(jsonFilePath, scenename);
+
+		if (compileBinary && std::filesystem::exists(jsonFilePath)) {
+			SaveSceneBinary(scenename, jsonFilePath);
+		}
+	}
+
+	void  Serialization::LoadSceneJson(const std::filesystem::path& jsonFilePath, const std::string sceneName)
+	{
+		KOS_PROFILE_SCOPE("Serialization::LoadSceneJson");
 		// Open the JSON file for reading
 		std::ifstream inputFile(jsonFilePath.string());
 
@@ -75,6 +98,9 @@ namespace serialization{
 
 		/*******************INSERT INTO FUNCTION*****************************/
 
+		//entities join their systems once, after all their components are loaded
+		ecs::RegistrationBatchScope registrationBatch(m_ecs);
+
 		// Iterate through each component entry in the JSON array
 		for (rapidjson::SizeType i = 0; i < doc.Size(); i++) {
 			const rapidjson::Value& entityData = doc[i];
@@ -162,6 +188,11 @@ namespace serialization{
 		}
 
 		LOGGING_INFO("Save Json Successful");
+
+		//temporary copies saved elsewhere are not loaded through the binary
+		if (targetFilePath.empty()) {
+			SaveSceneBinary(sceneName, jsonFilePath);
+		}
 	}
 
 	void Serialization::SaveEntity(ecs::EntityID entityId, rapidjson::Value& parentArray, rapidjson::Document::AllocatorType& allocator, std::unordered_set<ecs::EntityID>& savedEntities) {
@@ -227,6 +258,19 @@ namespace serialization{
 	}
 
 	void Serialization::LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName)
+	{
+		ecs::EntityID newEntityId = LoadEntityComponents(entityData, parentID, sceneName);
+
+		// Load children 
+		if (entityData.HasMember("children") && entityData["children"].IsArray()) {
+			const rapidjson::Value& childrenArray = entityData["children"];
+			for (rapidjson::SizeType i = 0; i < childrenArray.Size(); i++) {
+				LoadEntity(childrenArray[i], newEntityId, sceneName);
+			}
+		}
+	}
+
+	ecs::EntityID Serialization::LoadEntityComponents(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName)
 	{
 		ecs::EntityID newEntityId = m_ecs.CreateEntity(sceneName);
 
@@ -260,13 +304,7 @@ namespace serialization{
 			m_ecs.SetParent(parentID.value(), newEntityId);
 		}
 
-		// Load children 
-		if (entityData.HasMember("children") && entityData["children"].IsArray()) {
-			const rapidjson::Value& childrenArray = entityData["children"];
-			for (rapidjson::SizeType i = 0; i < childrenArray.Size(); i++) {
-				LoadEntity(childrenArray[i], newEntityId, sceneName);
-			}
-		}
+		return newEntityId;
 	}
 
 }
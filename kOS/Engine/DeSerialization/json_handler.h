@@ -33,11 +33,21 @@ namespace serialization {
 	public:
 		Serialization(ecs::ECS& ecs) : m_ecs(ecs) {}
 
+		//loads the compiled binary when it is up to date, otherwise the JSON
 		void LoadScene(const std::filesystem::path& jsonFilePath, const std::string sceneName = "");
+		void LoadSceneJson(const std::filesystem::path& jsonFilePath, const std::string sceneName = "");
 		void SaveScene(const std::filesystem::path& filePath, const std::filesystem::path& targetFilePath = "");
 
+		//binary scenes, see binary_scene.cpp for the layout
+		bool SaveSceneBinary(const std::string& sceneName, const std::filesystem::path& jsonFilePath);
+		bool LoadSceneBinary(const std::filesystem::path& binaryFilePath, const std::string& sceneName);
+		static std::filesystem::path GetBinaryScenePath(const std::filesystem::path& jsonFilePath);
+		static bool IsBinarySceneCurrent(const std::filesystem::path& jsonFilePath);
+
 		void SaveEntity(ecs::EntityID entityId, rapidjson::Value& parentArray, rapidjson::Document::AllocatorType& allocator, std::unordered_set<ecs::EntityID>& savedEntities);
 		void LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName);
+		//one entity without its children, scenes streamed over several frames load entity by entity
+		ecs::EntityID LoadEntityComponents(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName);
 
 			
 
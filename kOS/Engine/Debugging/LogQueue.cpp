@@ -0,0 +1,28 @@
+/******************************************************************/
+/*!
+\file      LogQueue.cpp
+\author    Rayner Tan
+\par       raynerweichen.tan@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains the implementation of the bounded lock
+           free queue used by the Logger.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "LogQueue.h"
+
+namespace logging {
+
+    LogQueue::LogQueue(size_t capacity)
+        : m_slots(std::bit_ceil(std::max<size_t>(capacity, 2)))
+    {
+        m_mask = m_slots.size() - 1;
+        for (size_t i = 0; i < m_slots.size(); ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,179 @@
+/******************************************************************/
+/*!
+\file      LogQueue.h
+\author    Rayner Tan
+\par       raynerweichen.tan@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains the bounded lock free queue that log
+           calls push their records into. The background writer of
+           the Logger drains it.
+
+Records keep the format string and the arguments instead of the
+finished text, formatting happens on the writer thread. Arguments
+that may dangle once the call returns (strings, pointers) are
+formatted by the caller instead.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+
+#ifndef LOGQUEUE_H
+#define LOGQUEUE_H
+
+#include "Config/pch.h"
+#include <atomic>
+#include <bit>
+
+namespace logging {
+
+    /******************************************************************/
+    /*!
+    \enum      LogLevel
+    \brief     Defines the different levels of logging available: DEBUG, INFO,
+               WARNING, ERROR.
+    */
+    /******************************************************************/
+    enum class LogLevel {
+        LOG_DEBUG,
+        LOG_INFO,
+        LOG_WARNING,
+        LOG_ERROR,
+        LOG_LEVEL_SIZE
+    };
+
+    /******************************************************************/
+    /*!
+    \struct    LogRecord
+    \brief     One log call as it travels from the caller to the writer.
+    \details   Either format is set and formatText/args hold the deferred
+               message, or format is null and text holds the message the
+               caller already formatted.
+    */
+    /******************************************************************/
+    struct LogRecord {
+        static constexpr size_t k_FormatCapacity = 192;
+        static constexpr size_t k_ArgCapacity = 64;
+
+        LogLevel level{ LogLevel::LOG_INFO };
+        const char* tag{};
+        const char* color{};
+        std::chrono::system_clock::time_point time{};
+        std::source_location location{};
+        bool hasLocation{ false };
+        //messages of the same category dropped by the rate limit since the last one that went through
+        uint32_t suppressed{};
+
+        void (*format)(const LogRecord& record, std::string& out) {};
+        uint16_t formatLength{};
+        char formatText[k_FormatCapacity];
+        alignas(std::max_align_t) unsigned char args[k_ArgCapacity];
+
+        std::string text;
+
+        std::string_view FormatString() const { return { formatText, formatLength }; }
+    };
+
+    /******************************************************************/
+    /*!
+    \class     LogQueue
+    \brief     Bounded multi producer queue of LogRecords.
+    \details   Every slot carries a sequence number, a producer claims a
+               slot with one compare exchange on the enqueue position and
+               publishes it by bumping the slot's sequence. Nothing
+               blocks, a full queue makes TryPush fail.
+    */
+    /******************************************************************/
+    class LogQueue {
+    public:
+        //capacity is rounded up to a power of two
+        explicit LogQueue(size_t capacity);
+
+        LogQueue(const LogQueue&) = delete;
+        LogQueue& operator=(const LogQueue&) = delete;
+
+        /******************************************************************/
+        /*!
+        \fn        bool LogQueue::TryPush(Fill&& fill)
+        \brief     Claims a slot and lets fill write the record into it.
+        \return    False if the queue is full, fill is not called then.
+        */
+        /******************************************************************/
+        template <typename Fill>
+        bool TryPush(Fill&& fill);
+
+        /******************************************************************/
+        /*!
+        \fn        size_t LogQueue::Drain(Consume&& consume)
+        \brief     Hands every published record to consume in push order.
+        \return    Number of records consumed.
+        \warning   Only one thread may drain at a time.
+        */
+        /******************************************************************/
+        template <typename Consume>
+        size_t Drain(Consume&& consume);
+
+        size_t GetCapacity() const { return m_slots.size(); }
+
+    private:
+        struct alignas(64) Slot {
+            std::atomic<size_t> sequence{};
+            LogRecord record;
+        };
+
+        std::vector<Slot> m_slots;
+        size_t m_mask{};
+
+        alignas(64) std::atomic<size_t> m_enqueuePos{ 0 };
+        alignas(64) size_t m_dequeuePos{ 0 };
+    };
+
+    template <typename Fill>
+    bool LogQueue::TryPush(Fill&& fill)
+    {
+        Slot* slot{};
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            slot = &m_slots[pos & m_mask];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (difference == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (difference < 0) {
+                //the writer has not consumed this slot from the previous lap yet
+                return false;
+            }
+            else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        fill(slot->record);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename Consume>
+    size_t LogQueue::Drain(Consume&& consume)
+    {
+        size_t count{};
+        while (true) {
+            Slot& slot = m_slots[m_dequeuePos & m_mask];
+            if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+                break;
+            }
+
+            consume(slot.record);
+            slot.sequence.store(m_dequeuePos + m_slots.size(), std::memory_order_release);
+            ++m_dequeuePos;
+            ++count;
+        }
+        return count;
+    }
+}
+
+#endif
@@ -11,7 +11,8 @@
 
 The Logger class supports different log levels, formatted log entries,
 signal handling for program crashes, and captures stack traces during
-critical events.
+critical events. Log calls are written out by a background writer
+thread, see m_WriterLoop.
 
 Copyright (C) 2024 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -49,7 +50,11 @@ namespace logging {
         m_logFile.open(filename, std::ios::out | std::ios::trunc);
         if (!m_logFile.is_open()) {
             std::cerr << "Error: Failed to open log file for writing: " << filename << std::endl;
+            return;
         }
+
+        m_bInitialized = true;
+        m_StartWriter();
     }
     /******************************************************************/
     /*!
@@ -132,6 +137,7 @@ namespace logging {
 
         // Initialize the logger and log stack trace
         auto& logger = logging::Logger::m_GetInstance();
+        std::lock_guard<std::mutex> lock(logger.m_writeMutex);
         logger.m_printer.print(st, logger.m_logFile); // Using the printer in Logger to log the stack trace
     }
     /******************************************************************/
@@ -159,6 +165,7 @@ namespace logging {
     */
     /******************************************************************/
     Logger::~Logger() { 
+        m_StopWriter();
         m_logFile.close(); 
     }
 
@@ -199,6 +206,8 @@ namespace logging {
 
         m_Setup_Abort_Handler();
         std::signal(SIGABRT, logging::Logger::m_Abort_Handler);
+
+        m_StartWriter();
     }
 
     /******************************************************************/
@@ -237,7 +246,197 @@ namespace logging {
     */
     /******************************************************************/
     std::vector<std::string> Logger::m_GetLogList() {
-        return  m_log_list;
+        std::lock_guard<std::mutex> lock(m_tailMutex);
+        return  std::vector<std::string>(m_log_list.begin(), m_log_list.end());
+    }
+
+    void Logger::m_SetTailCapacity(size_t capacity) {
+        std::lock_guard<std::mutex> lock(m_tailMutex);
+        m_tailCapacity = capacity;
+        while (m_log_list.size() > m_tailCapacity) {
+            m_log_list.pop_front();
+        }
+        m_logVersion.fetch_add(1, std::memory_order_release);
+    }
+
+    /******************************************************************/
+    /*!
+    \fn        void Logger::m_Flush()
+    \brief     Drains the queue on the calling thread and writes it out.
+    \details   Records pushed by other threads while this runs may be
+               written by the writer thread instead.
+    */
+    /******************************************************************/
+    void Logger::m_Flush() {
+        m_WriteQueued();
+    }
+
+    bool Logger::m_PassRateLimit(const std::string_view category, uint32_t& suppressed) {
+        const uint32_t limit = m_rateLimit.load(std::memory_order_relaxed);
+        if (limit == 0) {
+            return true;
+        }
+
+        // FNV-1a of the format string picks the bucket, categories sharing a bucket share the budget
+        uint32_t hash = 2166136261u;
+        for (const char c : category) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        }
+        RateBucket& bucket = m_rateBuckets[hash % k_RateBuckets];
+
+        const int64_t window = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t current = bucket.window.load(std::memory_order_relaxed);
+        if (current != window && bucket.window.compare_exchange_strong(current, window, std::memory_order_relaxed)) {
+            // Only the caller that moves the bucket into the new second resets it
+            bucket.count.store(0, std::memory_order_relaxed);
+            suppressed = bucket.suppressed.exchange(0, std::memory_order_relaxed);
+        }
+
+        if (bucket.count.fetch_add(1, std::memory_order_relaxed) < limit) {
+            return true;
+        }
+        bucket.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    void Logger::m_StartWriter() {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        if (m_writerRunning) {
+            return;
+        }
+        m_writerRunning = true;
+        m_writer = std::thread([this]() { m_WriterLoop(); });
+    }
+
+    void Logger::m_StopWriter() {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            if (!m_writerRunning) {
+                return;
+            }
+            m_writerRunning = false;
+        }
+        m_writerWake.notify_one();
+        if (m_writer.joinable()) {
+            m_writer.join();
+        }
+        m_WriteQueued();
+    }
+
+    /******************************************************************/
+    /*!
+    \fn        void Logger::m_WriterLoop()
+    \brief     Body of the writer thread.
+    \details   Producers never signal the writer, a log call stays a few
+               stores into the queue. The writer polls every couple of
+               milliseconds while the queue is empty and keeps draining
+               while it is not.
+    */
+    /******************************************************************/
+    void Logger::m_WriterLoop() {
+        while (true) {
+            if (m_WriteQueued() > 0) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            if (!m_writerRunning) {
+                break;
+            }
+            m_writerWake.wait_for(lock, std::chrono::milliseconds(2), [this]() { return m_wakeRequested || !m_writerRunning; });
+            m_wakeRequested = false;
+        }
+    }
+
+    size_t Logger::m_WriteQueued() {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+
+        const auto appendLine = [this](const char* color, std::string&& line) {
+            m_consoleBatch += color;
+            m_consoleBatch += line;
+            m_consoleBatch += s_CLOSE;
+            m_consoleBatch += '\n';
+            m_fileBatch += line;
+            m_fileBatch += '\n';
+            m_tailBatch.push_back(std::move(line));
+        };
+
+        const uint64_t dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) {
+            appendLine(s_YELLOW, "[WARN]: " + m_FormatTimestamp(std::chrono::system_clock::now())
+                + " - " + std::to_string(dropped) + " messages dropped, the log queue was full");
+        }
+
+        const size_t count = m_queue.Drain([&](LogRecord& record) {
+            std::string line = record.tag;
+            line += m_FormatTimestamp(record.time);
+            line += " - ";
+            if (record.format) {
+                record.format(record, line);
+            }
+            else {
+                line += record.text;
+                record.text.clear();
+            }
+            if (record.hasLocation) {
+                line += std::format("\nFUNC: {} LINE: {} FILE: {}", record.location.function_name(), record.location.line(), record.location.file_name());
+            }
+            if (record.suppressed > 0) {
+                line += std::format(" ({} similar messages suppressed)", record.suppressed);
+            }
+            appendLine(record.color, std::move(line));
+        });
+
+        if (m_tailBatch.empty()) {
+            return 0;
+        }
+
+        if (m_consoleOutput.load(std::memory_order_relaxed)) {
+            std::cout << m_consoleBatch;
+            std::cout.flush();
+        }
+        if (m_logFile.is_open()) {
+            m_logFile << m_fileBatch;
+            m_logFile.flush();
+        }
+
+        {
+            std::lock_guard<std::mutex> tailLock(m_tailMutex);
+            for (std::string& line : m_tailBatch) {
+                m_log_list.push_back(std::move(line));
+            }
+            while (m_log_list.size() > m_tailCapacity) {
+                m_log_list.pop_front();
+            }
+        }
+        m_logVersion.fetch_add(1, std::memory_order_release);
+
+        m_consoleBatch.clear();
+        m_fileBatch.clear();
+        m_tailBatch.clear();
+        return count;
+    }
+
+    const std::string& Logger::m_FormatTimestamp(std::chrono::system_clock::time_point time) {
+        // Only the writer calls this, consecutive records mostly share the same second
+        const std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+        if (seconds == m_timestampSecond) {
+            return m_timestampText;
+        }
+
+        std::tm local_time;
+#ifdef _WIN32
+        localtime_s(&local_time, &seconds);
+#else
+        localtime_r(&seconds, &local_time);
+#endif
+        char buffer[100];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &local_time);
+
+        m_timestampSecond = seconds;
+        m_timestampText = buffer;
+        return m_timestampText;
     }
 
     /******************************************************************/
@@ -251,18 +450,14 @@ namespace logging {
     /******************************************************************/
     void Logger::m_Log(LogLevel level, const std::string& message)
     {
-        std::string current_Time = m_GetCurrentTimestamp();
-        // Create log entry
-        std::ostringstream logEntry;
-        logEntry << "[" << current_Time << "] " << m_LevelToString(level) << ": " << message << "\n";
-
-        // Output to console
-        std::cout << m_ColorToString(level) << logEntry.str() << s_CLOSE << std::endl;
-        m_log_list.push_back(logEntry.str());
-        // Output to log file
-        if (m_logFile.is_open()) {
-            m_logFile << logEntry.str();
-            m_logFile.flush(); // Ensure immediate write to file
+        static constexpr const char* tags[] = { "[DEBUG]: ", "[INFO]: ", "[WARNING]: ", "[ERROR]: " };
+        static constexpr const char* colors[] = { s_GREEN, s_WHITE, s_YELLOW, s_RED };
+        const size_t index = std::min(static_cast<size_t>(level), std::size(tags) - 1);
+
+        // The message has no arguments, it is written as is
+        m_Enqueue(level, tags[index], colors[index], nullptr, message);
+        if (level >= LogLevel::LOG_ERROR) {
+            m_Flush();
         }
     }
 
@@ -13,6 +13,13 @@ The Logger class provides formatted output of log messages to
 both the console and file, as well as macros to easily log messages
 with varying severity.
 
+Log calls do not write anything themselves. They push a record into
+a lock free queue and return, a background writer formats the
+records and writes them to the console, the log file and the bounded
+in memory tail shown by the editor. Errors, crashes, assertions and
+popups are written out before the call returns. Messages below
+KOS_LOG_LEVEL are compiled out.
+
 Copyright (C) 2024 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
 prior written consent of DigiPen Institute of Technology is prohibited.
@@ -24,6 +31,24 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "Config/pch.h"
 #include <backward/backward.hpp>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include "LogQueue.h"
+
+/*
+* @brief Lowest level that is compiled in. Calls to lower levels expand to nothing, their arguments
+* are not evaluated. Errors, crashes, assertions and popups are never stripped.
+*/
+#define KOS_LOG_LEVEL_DEBUG 0
+#define KOS_LOG_LEVEL_INFO 1
+#define KOS_LOG_LEVEL_WARN 2
+#define KOS_LOG_LEVEL_ERROR 3
+
+#ifndef KOS_LOG_LEVEL
+#define KOS_LOG_LEVEL KOS_LOG_LEVEL_DEBUG
+#endif
 
 
 /*
@@ -32,7 +57,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 * @param Takes an std::string_view or string in the form of "This is a log value: {0}, and {1}", followed by
 * the arguments
 */
+#if KOS_LOG_LEVEL <= KOS_LOG_LEVEL_INFO
 #define LOGGING_INFO(x, ...) logging::Logger::m_GetInstance(). m_Info( x , ##__VA_ARGS__ )
+#else
+#define LOGGING_INFO(x, ...) ((void)0)
+#endif
 
 /*
 * @brief Variadic Macro for logging warnings. This macro takes in a string message, followed by the
@@ -40,7 +69,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 * @param Takes an std::string_view or string in the form of "This is a log value: {0}, and {1}", followed by
 * the arguments
 */
+#if KOS_LOG_LEVEL <= KOS_LOG_LEVEL_WARN
 #define LOGGING_WARN( x, ... ) logging::Logger::m_GetInstance().m_Warn( x , ##__VA_ARGS__ )
+#else
+#define LOGGING_WARN( x, ... ) ((void)0)
+#endif
 
 /*
 * @brief Variadic Macro for logging Errors. This macro takes in a string message, followed by the
@@ -57,7 +90,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 * @param Takes an std::string_view or string in the form of "This is a log value: {0}, and {1}", followed by
 * the arguments
 */
+#if KOS_LOG_LEVEL <= KOS_LOG_LEVEL_DEBUG
 #define LOGGING_DEBUG(x, ...) logging::Logger:: m_GetInstance().m_Debug( x, ##__VA_ARGS__)
+#else
+#define LOGGING_DEBUG(x, ...) ((void)0)
+#endif
 
 /******************************************************************/
 /*!
@@ -87,30 +124,16 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #define LOGGING_POPUP(x, ...) logging::Logger::m_GetInstance().m_Popup( x, ##__VA_ARGS__)
 #define LOGGING_TOGGLE(toggle) logging::Logger::m_GetInstance().setToggle(toggle);
+#define LOGGING_FLUSH() logging::Logger::m_GetInstance().m_Flush()
 
 namespace logging {
 
-    static const std::string s_GREEN = "\033[0;32m";
-    static const std::string s_YELLOW = "\033[0;33m";
-    static const std::string s_RED = "\033[0;31m";
-    static const std::string s_WHITE = "\033[0;30m";
-    static const std::string s_BLUE = "\033[0;36m";
-    static const std::string s_CLOSE = "\033[0m";
-
-    /******************************************************************/
-    /*!
-    \enum      LogLevel
-    \brief     Defines the different levels of logging available: DEBUG, INFO,
-               WARNING, ERROR.
-    */
-    /******************************************************************/
-    enum class LogLevel {
-        LOG_DEBUG,
-        LOG_INFO,
-        LOG_WARNING,
-        LOG_ERROR,
-        LOG_LEVEL_SIZE
-    };
+    inline constexpr const char* s_GREEN = "\033[0;32m";
+    inline constexpr const char* s_YELLOW = "\033[0;33m";
+    inline constexpr const char* s_RED = "\033[0;31m";
+    inline constexpr const char* s_WHITE = "\033[0;30m";
+    inline constexpr const char* s_BLUE = "\033[0;36m";
+    inline constexpr const char* s_CLOSE = "\033[0m";
 
     class Logger {
     public:
@@ -286,11 +309,66 @@ namespace logging {
         /******************************************************************/
         /*!
         \fn        std::vector<std::string> Logger::m_GetLogList()
-        \brief     Returns the list of logs
+        \brief     Returns the most recent logs, at most the tail capacity
         */
         /******************************************************************/
         std::vector<std::string>  m_GetLogList();
 
+        /******************************************************************/
+        /*!
+        \fn        uint64_t Logger::m_GetLogVersion()
+        \brief     Returns a counter that changes every time the log list
+                   changes, lets the log window skip copying an unchanged list.
+        */
+        /******************************************************************/
+        uint64_t m_GetLogVersion() const { return m_logVersion.load(std::memory_order_acquire); }
+
+        /******************************************************************/
+        /*!
+        \fn        void Logger::m_Flush()
+        \brief     Writes every queued message out on the calling thread
+                   before returning.
+        */
+        /******************************************************************/
+        void m_Flush();
+
+        /******************************************************************/
+        /*!
+        \fn        void Logger::m_SetRateLimit(uint32_t messagesPerSecond)
+        \brief     Sets how many messages of one category are kept per
+                   second, 0 disables the limit.
+        \details   The category of a message is its format string. Errors
+                   and above are never rate limited.
+        */
+        /******************************************************************/
+        void m_SetRateLimit(uint32_t messagesPerSecond) { m_rateLimit.store(messagesPerSecond, std::memory_order_relaxed); }
+
+        /******************************************************************/
+        /*!
+        \fn        void Logger::m_SetTailCapacity(size_t capacity)
+        \brief     Sets how many of the most recent messages are kept in memory.
+        */
+        /******************************************************************/
+        void m_SetTailCapacity(size_t capacity);
+
+        /******************************************************************/
+        /*!
+        \fn        void Logger::m_SetConsoleOutput(bool enabled)
+        \brief     Turns writing to the console on or off, the log file and
+                   the in memory list are always written.
+        */
+        /******************************************************************/
+        void m_SetConsoleOutput(bool enabled) { m_consoleOutput.store(enabled, std::memory_order_relaxed); }
+
+        /******************************************************************/
+        /*!
+        \fn        uint64_t Logger::m_GetDroppedCount()
+        \brief     Returns how many messages were dropped because the queue
+                   was full since the logger started.
+        */
+        /******************************************************************/
+        uint64_t m_GetDroppedCount() const { return m_droppedTotal.load(std::memory_order_relaxed); }
+
         /******************************************************************/
         /*!
         \fn      void Logger::m_TestingLog()
@@ -383,16 +461,168 @@ namespace logging {
 
         /******************************************************************/
         /*!
-        \var     std::vector<std::string> m_log_list
-        \brief   List of all logged messages.
-        \details This vector stores all logged messages, providing an in-memory list of log entries.
+        \fn      void Logger::m_Enqueue(LogLevel level, const char* tag, const char* color, const std::source_location* location, const std::string_view message, Args&... args)
+        \brief   Pushes one message into the queue for the writer.
+        \details Arithmetic arguments are copied into the record and formatted
+                 by the writer, any other argument may not outlive the call so
+                 the message is formatted here instead.
         */
         /******************************************************************/
-        std::vector<std::string> m_log_list;
+        template <typename... Args>
+        void m_Enqueue(LogLevel level, const char* tag, const char* color, const std::source_location* location, const std::string_view message, Args&... args);
+
+        template <typename... Args>
+        static std::string m_FormatMessage(const std::string_view message, Args&... args);
+
+        template <typename... Stored>
+        static void m_FormatRecord(const LogRecord& record, std::string& out);
+
+        /******************************************************************/
+        /*!
+        \fn      bool Logger::m_PassRateLimit(const std::string_view category, uint32_t& suppressed)
+        \brief   Counts the message against its category's budget for the
+                 current second.
+        \return  False if the message should be dropped. When a new second
+                 starts, suppressed receives the count dropped in the last one.
+        */
+        /******************************************************************/
+        bool m_PassRateLimit(const std::string_view category, uint32_t& suppressed);
+
+        void m_StartWriter();
+        void m_StopWriter();
+        void m_WriterLoop();
+        //drains the queue and writes the batch, returns the number of records written
+        size_t m_WriteQueued();
+        const std::string& m_FormatTimestamp(std::chrono::system_clock::time_point time);
+
+        static constexpr size_t k_QueueCapacity = 4096;
+        static constexpr size_t k_RateBuckets = 256;
+
+        /******************************************************************/
+        /*!
+        \var     LogQueue m_queue
+        \brief   Records pushed by log calls and not yet written.
+        */
+        /******************************************************************/
+        LogQueue m_queue{ k_QueueCapacity };
+
+        /******************************************************************/
+        /*!
+        \var     std::mutex m_writeMutex
+        \brief   Held while draining the queue and writing to the outputs,
+                 the writer thread and m_Flush take turns on it.
+        */
+        /******************************************************************/
+        std::mutex m_writeMutex;
+        std::string m_consoleBatch;
+        std::atomic<bool> m_consoleOutput{ true };
+        std::string m_fileBatch;
+        std::vector<std::string> m_tailBatch;
+        std::time_t m_timestampSecond{ -1 };
+        std::string m_timestampText;
+
+        std::thread m_writer;
+        std::mutex m_wakeMutex;
+        std::condition_variable m_writerWake;
+        bool m_writerRunning{ false };
+        bool m_wakeRequested{ false };
+
+        std::atomic<uint64_t> m_dropped{ 0 };
+        std::atomic<uint64_t> m_droppedTotal{ 0 };
+
+        struct RateBucket {
+            std::atomic<int64_t> window{ -1 };
+            std::atomic<uint32_t> count{ 0 };
+            std::atomic<uint32_t> suppressed{ 0 };
+        };
+        std::array<RateBucket, k_RateBuckets> m_rateBuckets;
+        std::atomic<uint32_t> m_rateLimit{ 200 };
+
+        /******************************************************************/
+        /*!
+        \var     std::deque<std::string> m_log_list
+        \brief   The most recent logged messages.
+        \details Holds at most m_tailCapacity entries, the oldest are dropped
+                 first. Written by the writer, read by the editor log window.
+        */
+        /******************************************************************/
+        std::deque<std::string> m_log_list;
+        size_t m_tailCapacity{ 1000 };
+        mutable std::mutex m_tailMutex;
+        std::atomic<uint64_t> m_logVersion{ 0 };
 
     };
 
 
+    template <typename... Args>
+    std::string Logger::m_FormatMessage(const std::string_view message, Args&... args)
+    {
+        try {
+            return std::vformat(message, std::make_format_args(args...));
+        }
+        catch (const std::format_error&) {
+            //a broken format string should still show up in the log
+            return std::string(message);
+        }
+    }
+
+    template <typename... Stored>
+    void Logger::m_FormatRecord(const LogRecord& record, std::string& out)
+    {
+        const auto& args = *std::launder(reinterpret_cast<const std::tuple<Stored...>*>(record.args));
+        std::apply([&](const auto&... values) { out += m_FormatMessage(record.FormatString(), values...); }, args);
+    }
+
+    template <typename... Args>
+    void Logger::m_Enqueue(LogLevel level, const char* tag, const char* color, const std::source_location* location, const std::string_view message, Args&... args)
+    {
+        uint32_t suppressed{};
+        if (level < LogLevel::LOG_ERROR && !m_PassRateLimit(message, suppressed)) {
+            return;
+        }
+
+        using Stored = std::tuple<std::decay_t<Args>...>;
+        constexpr bool deferrable = (std::is_arithmetic_v<std::decay_t<Args>> && ...)
+            && sizeof(Stored) <= LogRecord::k_ArgCapacity && alignof(Stored) <= alignof(std::max_align_t);
+        const bool defer = deferrable && message.size() <= LogRecord::k_FormatCapacity;
+
+        std::string text;
+        if (!defer) {
+            text = m_FormatMessage(message, args...);
+        }
+
+        const bool pushed = m_queue.TryPush([&](LogRecord& record) {
+            record.level = level;
+            record.tag = tag;
+            record.color = color;
+            record.time = std::chrono::system_clock::now();
+            record.hasLocation = location != nullptr;
+            if (location) {
+                record.location = *location;
+            }
+            record.suppressed = suppressed;
+
+            if constexpr (deferrable) {
+                if (defer) {
+                    record.format = &m_FormatRecord<std::decay_t<Args>...>;
+                    std::memcpy(record.formatText, message.data(), message.size());
+                    record.formatLength = static_cast<uint16_t>(message.size());
+                    new (record.args) Stored(args...);
+                    record.text.clear();
+                    return;
+                }
+            }
+            record.format = nullptr;
+            record.text = std::move(text);
+        });
+
+        if (!pushed) {
+            //never wait on the writer, the drop count is written with the next batch
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            m_droppedTotal.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
     template <typename... Args>
     void Logger::m_Info(const std::string_view message, Args&&... args)
     {
@@ -406,16 +636,7 @@ namespace logging {
             return;
         }
         if (!toggle_Debug) {
-            std::stringstream logEntry;
-            logEntry << "[INFO]: " << m_GetCurrentTimestamp() << " - " << std::vformat(message, std::make_format_args(args...));
-
-            std::cout << s_BLUE << logEntry.str() << s_CLOSE << std::endl;
-            m_log_list.push_back(logEntry.str());
-            // Output to log file
-            if (m_logFile.is_open()) {
-                m_logFile << logEntry.str() << "\n";
-                m_logFile.flush(); // Ensure immediate write to file
-            }
+            m_Enqueue(LogLevel::LOG_INFO, "[INFO]: ", s_BLUE, nullptr, message, args...);
         }
     }
 
@@ -434,21 +655,7 @@ namespace logging {
             return;
         }
         if (toggle_Debug) {
-            std::stringstream logEntry;
-            logEntry << "[WARN]: " << m_GetCurrentTimestamp() << " - " << std::vformat(message, std::make_format_args(args...));
-
-            std::cout << s_YELLOW << logEntry.str() << s_CLOSE << std::endl;
-
-            m_log_list.push_back(logEntry.str());
-
-            // Output to log file
-            if (m_logFile.is_open()) {
-                m_logFile << logEntry.str() << "\n";
-                m_logFile.flush(); // Ensure immediate write to file
-            }
-            else {
-                std::cout << "Not storing" << std::endl;
-            }
+            m_Enqueue(LogLevel::LOG_WARNING, "[WARN]: ", s_YELLOW, nullptr, message, args...);
         }
 #endif
     }
@@ -466,40 +673,24 @@ namespace logging {
             return;
         }
         if (!toggle_Debug) {
-            std::stringstream logEntry;
-            logEntry << "[ERROR]: " << m_GetCurrentTimestamp() << " - " << std::vformat(message, std::make_format_args(args...))
-                << "\nFUNC: " << location.function_name() << " LINE: " << location.line() << " FILE: " << location.file_name();
-
-            std::cout << s_RED << logEntry.str() << s_CLOSE << std::endl;
-
-
-
-            m_log_list.push_back(logEntry.str());
+            m_Enqueue(LogLevel::LOG_ERROR, "[ERROR]: ", s_RED, &location, message, args...);
+            // Everything up to the error is on disk before the popup blocks
+            m_Flush();
 
             std::string title = "Error";
             std::wstring tile_wstring = std::wstring(title.begin(), title.end());
-            std::string entry = logEntry.str();
+            std::string entry = "[ERROR]: " + m_GetCurrentTimestamp() + " - " + m_FormatMessage(message, args...)
+                + "\nFUNC: " + location.function_name() + " LINE: " + std::to_string(location.line()) + " FILE: " + location.file_name();
             std::wstring entry_W = std::wstring(entry.begin(), entry.end());
 
-            int msgboxID = MessageBoxW(
+            MessageBoxW(
                 NULL,
                 entry_W.c_str(),
                 tile_wstring.c_str(),
                 MB_ICONQUESTION | MB_OK | MB_DEFBUTTON2
             );
 
-            switch (msgboxID)
-            {
-            case IDOK:
-                // Output to log file
-                if (m_logFile.is_open()) {
-                    m_logFile << logEntry.str() << "\n";
-                    m_logFile.flush(); // Ensure immediate write to file
-                }
-                break;
-            default:
-                break;
-            }
+            std::lock_guard<std::mutex> lock(m_writeMutex);
             m_st.load_here(32);
             m_printer.print(m_st, m_logFile);
         }
@@ -522,39 +713,20 @@ namespace logging {
             return;
         }
         if (!toggle_Debug) {
-            std::stringstream logEntry;
-            logEntry << "[ERROR]: " << m_GetCurrentTimestamp() << " - " << std::vformat(message, std::make_format_args(args...));
-
-
-            std::cout << s_RED << logEntry.str() << s_CLOSE << std::endl;
-
-
-            m_log_list.push_back(logEntry.str());
+            m_Enqueue(LogLevel::LOG_ERROR, "[ERROR]: ", s_RED, nullptr, message, args...);
+            m_Flush();
 
             std::string title = "Error";
             std::wstring tile_wstring = std::wstring(title.begin(), title.end());
-            std::string entry = logEntry.str();
+            std::string entry = "[ERROR]: " + m_GetCurrentTimestamp() + " - " + m_FormatMessage(message, args...);
             std::wstring entry_W = std::wstring(entry.begin(), entry.end());
 
-            int msgboxID = MessageBoxW(
+            MessageBoxW(
                 NULL,
                 entry_W.c_str(),
                 tile_wstring.c_str(),
                 MB_ICONQUESTION | MB_OK | MB_DEFBUTTON2
             );
-
-            switch (msgboxID)
-            {
-            case IDOK:
-                // Output to log file
-                if (m_logFile.is_open()) {
-                    m_logFile << logEntry.str() << "\n";
-                    m_logFile.flush(); // Ensure immediate write to file
-                }
-                break;
-            default:
-                break;
-            }
         }
 #endif
     }
@@ -573,18 +745,9 @@ namespace logging {
         }
 
         if (!toggle_Debug) {
-            std::stringstream logEntry;
-            logEntry << "[CRASH]: " << m_GetCurrentTimestamp() << " - " << std::vformat(message, std::make_format_args(args...));
-
-            std::cout << s_RED << logEntry.str() << s_CLOSE << std::endl;
-
-            m_log_list.push_back(logEntry.str());
-
-            // Output to log file
-            if (m_logFile.is_open()) {
-                m_logFile << logEntry.str() << "\n";
-                m_logFile.flush(); // Ensure immediate write to file
-            }
+            m_Enqueue(LogLevel::LOG_ERROR, "[CRASH]: ", s_RED, nullptr, message, args...);
+            // The process may not live long enough for the writer to get to it
+            m_Flush();
         }
     }
 
@@ -602,17 +765,13 @@ namespace logging {
             return;
         }
         if (!toggle_Debug) {
-            std::stringstream logEntry;
-            logEntry << "[ASSERTION]: " << m_GetCurrentTimestamp() << " - " << std::vformat(message, std::make_format_args(args...))
-                << "\nFUNC: " << location.function_name() << " LINE: " << location.line() << " FILE: " << location.file_name();
-
-            std::cout << s_RED << logEntry.str() << s_CLOSE << std::endl;
-
-            m_log_list.push_back(logEntry.str());
+            m_Enqueue(LogLevel::LOG_ERROR, "[ASSERTION]: ", s_RED, &location, message, args...);
+            m_Flush();
 
             std::string title = "Assertion Failed";
             std::wstring tile_wstring = std::wstring(title.begin(), title.end());
-            std::string entry = logEntry.str();
+            std::string entry = "[ASSERTION]: " + m_GetCurrentTimestamp() + " - " + m_FormatMessage(message, args...)
+                + "\nFUNC: " + location.function_name() + " LINE: " + std::to_string(location.line()) + " FILE: " + location.file_name();
             std::wstring entry_W = std::wstring(entry.begin(), entry.end());
 
             int msgboxID = MessageBoxW(
@@ -625,11 +784,6 @@ namespace logging {
             switch (msgboxID)
             {
             case IDOK:
-                // Output to log file
-                if (m_logFile.is_open()) {
-                    m_logFile << logEntry.str() << "\n";
-                    m_logFile.flush(); // Ensure immediate write to file
-                }
                 //LOGGING_ASSERT(false);
                 abort();
                 break;
@@ -654,18 +808,7 @@ namespace logging {
             return;
         }
         if (!toggle_Debug) {
-            std::stringstream logEntry;
-            logEntry << "[DEBUG]: " << m_GetCurrentTimestamp() << " - " << std::vformat(message, std::make_format_args(args...));
-
-            std::cout << s_GREEN << logEntry.str() << s_CLOSE << std::endl;
-
-            m_log_list.push_back(logEntry.str());
-
-            // Output to log file
-            if (m_logFile.is_open()) {
-                m_logFile << logEntry.str() << "\n";
-                m_logFile.flush(); // Ensure immediate write to file
-            }
+            m_Enqueue(LogLevel::LOG_DEBUG, "[DEBUG]: ", s_GREEN, nullptr, message, args...);
         }
     }
 
@@ -683,39 +826,20 @@ namespace logging {
             return;
         }
         if (!toggle_Debug) {
-            std::stringstream logEntry;
-            logEntry << "[POPUP]: " << m_GetCurrentTimestamp() << " - " << std::vformat(message, std::make_format_args(args...));
-
-
-            std::cout << s_GREEN << logEntry.str() << s_CLOSE << std::endl;
-
-
-            m_log_list.push_back(logEntry.str());
+            m_Enqueue(LogLevel::LOG_INFO, "[POPUP]: ", s_GREEN, nullptr, message, args...);
+            m_Flush();
 
             std::string title = "POP UP";
             std::wstring tile_wstring = std::wstring(title.begin(), title.end());
-            std::string entry = logEntry.str();
+            std::string entry = "[POPUP]: " + m_GetCurrentTimestamp() + " - " + m_FormatMessage(message, args...);
             std::wstring entry_W = std::wstring(entry.begin(), entry.end());
 
-            int msgboxID = MessageBoxW(
+            MessageBoxW(
                 NULL,
                 entry_W.c_str(),
                 tile_wstring.c_str(),
                 MB_ICONQUESTION | MB_OK | MB_DEFBUTTON2
             );
-
-            switch (msgboxID)
-            {
-            case IDOK:
-                // Output to log file
-                if (m_logFile.is_open()) {
-                    m_logFile << logEntry.str() << "\n";
-                    m_logFile.flush(); // Ensure immediate write to file
-                }
-                break;
-            default:
-                break;
-            }
         }   
 #endif
     }
@@ -24,6 +24,12 @@ public:
         return m_SystemPerformance;
     }
 
+    // worker index each system ran on last frame, -1 is the main thread
+    const std::unordered_map<std::string, int>& GetSystemWorker() const
+    {
+        return m_SystemWorker;
+    }
+
     const std::unordered_map<std::string, float>& GetScriptPerformance() const
     {
         return m_ScriptPerformance;
@@ -54,14 +60,38 @@ public:
         m_SystemPerformance[key] = value;
     }
 
+    void SetSystemWorker(const std::string& key, int worker)
+    {
+        m_SystemWorker[key] = worker;
+    }
+
     void SetScriptValue(const std::string& key, float value)
     {
         m_ScriptPerformance[key] = value;
     }
 
+    // the entry stays at the same address, callers can keep it and write the time without a lookup
+    float& GetScriptValue(const std::string& key)
+    {
+        return m_ScriptPerformance[key];
+    }
+
+    // longest chain of dependent systems in the last frame, the lower bound of the frame's system time
+    void SetCriticalPath(float value)
+    {
+        m_criticalPath = value;
+    }
+
+    float GetCriticalPath() const
+    {
+        return m_criticalPath;
+    }
+
 private:
     std::unordered_map<std::string, float> m_SystemPerformance;
+    std::unordered_map<std::string, int> m_SystemWorker;
     std::unordered_map<std::string, float> m_ScriptPerformance;
+    float m_criticalPath{};
     float m_fps{};
     float m_detaTime{};
     
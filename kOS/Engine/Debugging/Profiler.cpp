@@ -0,0 +1,254 @@
+/******************************************************************/
+/*!
+\file      Profiler.cpp
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Hierarchical frame profiler with per thread zone rings,
+		   rolling zone statistics and Chrome trace export.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "Profiler.h"
+
+namespace profiling {
+
+	std::atomic<bool> Profiler::s_enabled{ true };
+
+	namespace {
+		//flags the buffer when the thread exits
+		struct ThreadBufferOwner {
+			std::atomic<bool>* finished{};
+			void* buffer{};
+			~ThreadBufferOwner() {
+				if (finished) finished->store(true, std::memory_order_release);
+			}
+		};
+		thread_local ThreadBufferOwner t_threadBuffer;
+		thread_local std::string t_threadName;
+
+		void WriteEscaped(std::ostream& out, std::string_view text) {
+			for (const char c : text) {
+				if (c == '"' || c == '\\') out << '\\' << c;
+				else if (static_cast<unsigned char>(c) < 0x20) out << ' ';
+				else out << c;
+			}
+		}
+	}
+
+	Profiler& Profiler::GetInstance() {
+		static Profiler instance{};
+		return instance;
+	}
+
+	Profiler::Profiler() = default;
+
+	int64_t Profiler::Now() {
+		static const auto epoch = std::chrono::steady_clock::now();
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+	}
+
+	Profiler::ThreadBuffer& Profiler::GetThreadBuffer() {
+		if (t_threadBuffer.buffer) {
+			return *static_cast<ThreadBuffer*>(t_threadBuffer.buffer);
+		}
+
+		std::lock_guard<std::mutex> lock(m_threadsMutex);
+		//nothing drains the buffers of threads that ended before the first frame (eg. tests), drop them
+		std::erase_if(m_threads, [this](const std::unique_ptr<ThreadBuffer>& thread) {
+			return thread->finished.load(std::memory_order_acquire)
+				&& (m_frameCount == 0 || thread->head.load(std::memory_order_relaxed) == thread->tail.load(std::memory_order_relaxed));
+		});
+
+		auto buffer = std::make_unique<ThreadBuffer>();
+		buffer->threadID = m_nextThreadID++;
+		buffer->name = t_threadName.empty() ? "Thread " + std::to_string(buffer->threadID) : t_threadName;
+		t_threadBuffer.buffer = buffer.get();
+		t_threadBuffer.finished = &buffer->finished;
+		m_threads.push_back(std::move(buffer));
+		return *m_threads.back();
+	}
+
+	void Profiler::SetThreadName(const std::string& name) {
+		t_threadName = name;
+		if (t_threadBuffer.buffer) {
+			std::lock_guard<std::mutex> lock(GetInstance().m_threadsMutex);
+			static_cast<ThreadBuffer*>(t_threadBuffer.buffer)->name = name;
+		}
+	}
+
+	void Profiler::BeginZone() {
+		++GetThreadBuffer().depth;
+	}
+
+	void Profiler::EndZone(const char* name, int64_t start) {
+		const int64_t end = Now();
+		ThreadBuffer& buffer = GetThreadBuffer();
+		const uint32_t depth = --buffer.depth;
+
+		const size_t head = buffer.head.load(std::memory_order_relaxed);
+		if (head - buffer.tail.load(std::memory_order_acquire) >= buffer.events.size()) {
+			buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		buffer.events[head & (buffer.events.size() - 1)] = ProfileEvent{ name, start, end, depth };
+		buffer.head.store(head + 1, std::memory_order_release);
+	}
+
+	void Profiler::SetHistoryLength(size_t frames) {
+		m_historyLength = std::max<size_t>(frames, 1);
+		m_zones.clear();
+	}
+
+	void Profiler::EndFrame() {
+		const int64_t frameEnd = Now();
+		if (m_frameCount == 0) {
+			SetThreadName("Main");
+		}
+		const uint32_t mainThreadID = GetThreadBuffer().threadID;
+
+		//buffers are only freed under the lock, draining under it keeps them alive
+		std::lock_guard<std::mutex> lock(m_threadsMutex);
+
+		const bool capture = m_capturing && m_capturedFrames < m_captureFrameLimit;
+		m_framePointerTotals.clear();
+		m_frameTotals.clear();
+		for (const auto& thread : m_threads) {
+			const size_t tail = thread->tail.load(std::memory_order_relaxed);
+			const size_t head = thread->head.load(std::memory_order_acquire);
+			for (size_t i = tail; i < head; ++i) {
+				const ProfileEvent& event = thread->events[i & (thread->events.size() - 1)];
+				auto& [milliseconds, calls] = m_framePointerTotals[event.name];
+				milliseconds += static_cast<float>(event.end - event.start) * 1e-6f;
+				++calls;
+				if (capture) {
+					m_capture.push_back(CapturedEvent{ event, thread->threadID });
+				}
+			}
+			thread->tail.store(head, std::memory_order_release);
+			if (capture && head != tail) {
+				m_captureThreadNames[thread->threadID] = thread->name;
+			}
+		}
+		std::erase_if(m_threads, [](const std::unique_ptr<ThreadBuffer>& thread) {
+			return thread->finished.load(std::memory_order_acquire)
+				&& thread->head.load(std::memory_order_acquire) == thread->tail.load(std::memory_order_relaxed);
+		});
+
+		for (const auto& [name, total] : m_framePointerTotals) {
+			auto& [milliseconds, calls] = m_frameTotals[name];
+			milliseconds += total.first;
+			calls += total.second;
+		}
+		for (const auto& [name, total] : m_frameTotals) {
+			ZoneHistory& history = m_zones[name];
+			if (history.samples.size() != m_historyLength) {
+				history.samples.assign(m_historyLength, 0.f);
+			}
+			history.samples[history.next] = total.first;
+			history.next = (history.next + 1) % m_historyLength;
+			history.count = std::min(history.count + 1, m_historyLength);
+			history.lastCalls = total.second;
+		}
+
+		if (capture) {
+			//frame bar on the main thread, the zones of the frame nest under it in the viewer
+			m_capture.push_back(CapturedEvent{ ProfileEvent{ "Frame", m_frameStart, frameEnd, 0 }, mainThreadID });
+			m_captureThreadNames.emplace(mainThreadID, "Main");
+			++m_capturedFrames;
+		}
+
+		m_frameStart = frameEnd;
+		++m_frameCount;
+	}
+
+	void Profiler::BeginCapture(size_t maxFrames) {
+		m_capture.clear();
+		m_captureThreadNames.clear();
+		m_capturedFrames = 0;
+		m_captureFrameLimit = maxFrames;
+		m_capturing = true;
+	}
+
+	bool Profiler::WriteChromeTrace(const std::filesystem::path& path) {
+		m_capturing = false;
+
+		std::ofstream out(path, std::ios::out | std::ios::trunc);
+		if (!out.is_open()) {
+			LOGGING_WARN("Profiler: cannot write trace to {}", path.string());
+			return false;
+		}
+
+		//complete events ("X") with timestamps and durations in microseconds
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		bool first = true;
+		for (const auto& [threadID, name] : m_captureThreadNames) {
+			out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadID
+				<< ",\"args\":{\"name\":\"";
+			WriteEscaped(out, name);
+			out << "\"}}";
+			first = false;
+		}
+
+		out << std::fixed << std::setprecision(3);
+		for (const CapturedEvent& captured : m_capture) {
+			out << (first ? "" : ",") << "\n{\"name\":\"";
+			WriteEscaped(out, captured.event.name);
+			out << "\",\"cat\":\"kos\",\"ph\":\"X\",\"pid\":1,\"tid\":" << captured.threadID
+				<< ",\"ts\":" << static_cast<double>(captured.event.start) * 1e-3
+				<< ",\"dur\":" << static_cast<double>(captured.event.end - captured.event.start) * 1e-3
+				<< ",\"args\":{\"depth\":" << captured.event.depth << "}}";
+			first = false;
+		}
+		out << "\n]}\n";
+
+		m_capture.clear();
+		m_capture.shrink_to_fit();
+		m_captureThreadNames.clear();
+		return out.good();
+	}
+
+	std::vector<ZoneStats> Profiler::GetZoneStats() const {
+		std::vector<ZoneStats> stats;
+		stats.reserve(m_zones.size());
+		for (const auto& [name, history] : m_zones) {
+			stats.push_back(*GetZoneStats(name));
+		}
+		std::sort(stats.begin(), stats.end(), [](const ZoneStats& a, const ZoneStats& b) { return a.mean > b.mean; });
+		return stats;
+	}
+
+	std::optional<ZoneStats> Profiler::GetZoneStats(std::string_view name) const {
+		const auto it = m_zones.find(name);
+		if (it == m_zones.end() || it->second.count == 0) {
+			return std::nullopt;
+		}
+
+		const ZoneHistory& history = it->second;
+		std::vector<float> samples(history.samples.begin(), history.samples.begin() + history.count);
+		std::sort(samples.begin(), samples.end());
+
+		ZoneStats stats;
+		stats.name = std::string(name);
+		stats.mean = std::accumulate(samples.begin(), samples.end(), 0.f) / static_cast<float>(samples.size());
+		stats.p95 = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+		stats.max = samples.back();
+		stats.calls = history.lastCalls;
+		stats.samples = samples.size();
+		return stats;
+	}
+
+	uint64_t Profiler::GetDroppedCount() const {
+		std::lock_guard<std::mutex> lock(m_threadsMutex);
+		uint64_t dropped{};
+		for (const auto& thread : m_threads) {
+			dropped += thread->dropped.load(std::memory_order_relaxed);
+		}
+		return dropped;
+	}
+}
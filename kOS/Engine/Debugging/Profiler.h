@@ -0,0 +1,196 @@
+/******************************************************************/
+/*!
+\file      Profiler.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Hierarchical frame profiler. Code is instrumented with
+		   KOS_PROFILE_SCOPE("name"), every scope records one zone
+		   with its start, end and nesting depth.
+
+		   - Each thread writes its zones into its own single producer
+			 ring, the main thread drains all rings in EndFrame.
+		   - EndFrame keeps the time of every zone over the last frames
+			 for mean/p95/max statistics.
+		   - A capture keeps every zone of the captured frames and is
+			 written out as Chrome trace event JSON, which trace viewers
+			 such as chrome://tracing and Perfetto can open.
+
+		   A disabled profiler costs one relaxed load per scope, building
+		   with KOS_PROFILING=0 removes the scopes entirely.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "Config/pch.h"
+#include <atomic>
+#include <mutex>
+
+#ifndef KOS_PROFILING
+#define KOS_PROFILING 1
+#endif
+
+#define KOS_PROFILE_CONCAT_INNER(a, b) a##b
+#define KOS_PROFILE_CONCAT(a, b) KOS_PROFILE_CONCAT_INNER(a, b)
+
+#if KOS_PROFILING
+//name must outlive the profiler, use string literals or other static strings
+#define KOS_PROFILE_SCOPE(name) profiling::ProfileScope KOS_PROFILE_CONCAT(kosProfileScope, __LINE__){ name }
+#define KOS_PROFILE_FUNCTION() KOS_PROFILE_SCOPE(__func__)
+#define KOS_PROFILE_END_FRAME() profiling::Profiler::GetInstance().EndFrame()
+#else
+#define KOS_PROFILE_SCOPE(name) ((void)0)
+#define KOS_PROFILE_FUNCTION() ((void)0)
+#define KOS_PROFILE_END_FRAME() ((void)0)
+#endif
+
+namespace profiling {
+
+	struct ProfileEvent {
+		const char* name{};
+		int64_t start{};		// nanoseconds since the profiler started
+		int64_t end{};
+		uint32_t depth{};
+	};
+
+	struct ZoneStats {
+		std::string name;
+		//milliseconds per frame the zone ran in, nested zones are included in their parent
+		float mean{};
+		float p95{};
+		float max{};
+		uint32_t calls{};		// in the last frame the zone ran in
+		size_t samples{};		// frames the statistics cover
+	};
+
+	class Profiler {
+	public:
+		static Profiler& GetInstance();
+
+		Profiler(const Profiler&) = delete;
+		Profiler& operator=(const Profiler&) = delete;
+
+		void SetEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+		static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+		//number of frames each zone's statistics cover
+		void SetHistoryLength(size_t frames);
+
+		//drains every thread's zones, call once per frame on the main thread
+		void EndFrame();
+
+		//keeps every zone of the next frames until maxFrames is reached or the capture is written
+		void BeginCapture(size_t maxFrames = 300);
+		bool IsCapturing() const { return m_capturing; }
+		size_t GetCapturedFrames() const { return m_capturedFrames; }
+		//writes the capture as Chrome trace event JSON and ends it
+		bool WriteChromeTrace(const std::filesystem::path& path);
+
+		std::vector<ZoneStats> GetZoneStats() const;
+		std::optional<ZoneStats> GetZoneStats(std::string_view name) const;
+		uint64_t GetFrameCount() const { return m_frameCount; }
+		//zones lost because a thread recorded more than its ring holds between two EndFrame calls
+		uint64_t GetDroppedCount() const;
+
+		//shown in the trace viewer, threads are "Thread N" until named. Does not allocate the thread's buffer
+		static void SetThreadName(const std::string& name);
+
+		static int64_t Now();
+		void BeginZone();
+		void EndZone(const char* name, int64_t start);
+
+	private:
+		Profiler();
+
+		static constexpr size_t k_ThreadCapacity = 8192;
+
+		struct ThreadBuffer {
+			std::vector<ProfileEvent> events = std::vector<ProfileEvent>(k_ThreadCapacity);
+			alignas(64) std::atomic<size_t> head{ 0 };		// written by the owning thread
+			alignas(64) std::atomic<size_t> tail{ 0 };		// written by EndFrame
+			std::atomic<uint64_t> dropped{ 0 };
+			//set when the owning thread exits, the buffer is freed once it is drained
+			std::atomic<bool> finished{ false };
+			uint32_t depth{};
+			uint32_t threadID{};
+			std::string name;
+		};
+
+		struct ZoneHistory {
+			std::vector<float> samples;
+			size_t next{};
+			size_t count{};
+			uint32_t lastCalls{};
+		};
+
+		struct CapturedEvent {
+			ProfileEvent event;
+			uint32_t threadID{};
+		};
+
+		ThreadBuffer& GetThreadBuffer();
+
+		static std::atomic<bool> s_enabled;
+
+		//buffers outlive their thread until EndFrame has drained them
+		mutable std::mutex m_threadsMutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> m_threads;
+		uint32_t m_nextThreadID{};
+
+		//names are static strings, zones with the same text share one entry
+		std::unordered_map<std::string_view, ZoneHistory> m_zones;
+		//summed by name pointer first, hashing the text of every zone is too slow
+		std::unordered_map<const char*, std::pair<float, uint32_t>> m_framePointerTotals;
+		std::unordered_map<std::string_view, std::pair<float, uint32_t>> m_frameTotals;
+		size_t m_historyLength{ 120 };
+
+		int64_t m_frameStart{};
+		uint64_t m_frameCount{};
+
+		bool m_capturing{ false };
+		size_t m_captureFrameLimit{};
+		size_t m_capturedFrames{};
+		std::vector<CapturedEvent> m_capture;
+		//names of the captured threads, kept here since their buffers may be gone by the time the trace is written
+		std::map<uint32_t, std::string> m_captureThreadNames;
+	};
+
+	/******************************************************************/
+	/*!
+	\class     ProfileScope
+	\brief     Records one zone from construction to destruction on the
+			   calling thread. Does nothing if the profiler was disabled
+			   when the scope started.
+	*/
+	/******************************************************************/
+	class ProfileScope {
+	public:
+		explicit ProfileScope(const char* name) {
+			if (Profiler::IsEnabled()) {
+				m_name = name;
+				Profiler::GetInstance().BeginZone();
+				m_start = Profiler::Now();
+			}
+		}
+
+		~ProfileScope() {
+			if (m_name) {
+				Profiler::GetInstance().EndZone(m_name, m_start);
+			}
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* m_name{};
+		int64_t m_start{};
+	};
+}
+
+#endif
@@ -2,12 +2,20 @@
 #define MATERIALCOMPONENT_H
 
 #include "Component.h"
+#include "Resources/ResourceHandle.h"
+
+class R_Material;
+
 namespace ecs {
 	class MaterialComponent :public Component {
 	public:
 		std::vector<utility::GUID> materialGUID{};
 		REFLECTABLE(MaterialComponent, materialGUID)
 
+		//resolved from materialGUID by the renderer
+		std::vector<utility::GUID> cachedMaterialGUID{};
+		std::vector<ResourceHandle<R_Material>> cachedMaterialHandle{};
+
 	};
 }
 #endif
\ No newline at end of file
@@ -26,6 +26,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define MESHFILTER_H
 
 #include "Component.h"
+#include "Resources/ResourceHandle.h"
+
+class R_Model;
 
 namespace ecs {
 
@@ -35,6 +38,10 @@ namespace ecs {
         utility::GUID meshGUID{};   // Path or ID for mesh asset
 
         REFLECTABLE(MeshFilterComponent, meshGUID);
+
+        //resolved from meshGUID by the renderer, stale once the mesh is unloaded
+        utility::GUID cachedMeshGUID{};
+        ResourceHandle<R_Model> cachedMeshHandle{};
     };
 
 }
@@ -11,6 +11,10 @@ namespace ecs {
 
 		float pathfinderCurrentTimer = 0.f;
 		float pathfinderMaxTimer = 3.f;
+
+		//progress along the path delivered by the path query service
+		size_t pathIndex = 0;
+		uint32_t pathVersion = 0;
 		REFLECTABLE(PathfinderComponent, pathfinderMovementSpeed, chase)
 	};
 }
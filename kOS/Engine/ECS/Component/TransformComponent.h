@@ -22,7 +22,10 @@ namespace ecs {
 	/******************************************************************/
 	/*!
 	\class     TransformComponent
-	\brief     Contains data required for transformation
+	\brief     Contains data required for transformation. The
+			   TransformSystem keeps its own structure of arrays copy of
+			   the hierarchy, this component is the facade that scripts,
+			   reflection and the editor read and write.
 	*/
 	/******************************************************************/
 	struct Transformation {
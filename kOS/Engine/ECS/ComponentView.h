@@ -0,0 +1,87 @@
+/******************************************************************/
+/*!
+\file      ComponentView.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   ComponentView is a multi-component query over the ECS
+		   component pools. The pools are resolved once when the view
+		   is created, so iterating the view only touches the sparse
+		   pages and dense arrays of each pool with no string hashing
+		   or shared_ptr casting per entity.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef COMPONENTVIEW_H
+#define COMPONENTVIEW_H
+
+#include "Config/pch.h"
+#include "ECS/ECSList.h"
+#include "ECS/SparseSet.h"
+
+namespace ecs {
+
+	template <typename... Ts>
+	class ComponentView {
+	public:
+		static_assert(sizeof...(Ts) > 0, "ComponentView requires at least one component");
+
+		//drive the view with the smallest pool
+		explicit ComponentView(SparseSet<Ts>*... pools)
+			: m_pools{ pools... }
+		{
+			size_t smallest = std::numeric_limits<size_t>::max();
+			(..., [&](ISparseSet* pool) {
+				if (pool->Size() < smallest) {
+					smallest = pool->Size();
+					m_entities = &pool->GetEntityList();
+				}
+			}(pools));
+		}
+
+		//drive the view with an external entity list (eg. system's registered entities)
+		ComponentView(const std::vector<EntityID>& entities, SparseSet<Ts>*... pools)
+			: m_pools{ pools... }
+			, m_entities{ &entities }
+		{
+		}
+
+		template <typename T>
+		T* Get(EntityID id) const {
+			return std::get<SparseSet<T>*>(m_pools)->Get(id);
+		}
+
+		bool Contains(EntityID id) const {
+			return (std::get<SparseSet<Ts>*>(m_pools)->ContainsEntity(id) && ...);
+		}
+
+		// Calls func(EntityID, Ts&...) for every entity that owns all components
+		template <typename Func>
+		void Each(Func&& func) const {
+			for (const EntityID id : *m_entities) {
+				std::tuple<Ts*...> components{ std::get<SparseSet<Ts>*>(m_pools)->Get(id)... };
+				if (((std::get<Ts*>(components) == nullptr) || ...)) continue;
+
+				func(id, *std::get<Ts*>(components)...);
+			}
+		}
+
+		const std::vector<EntityID>& Entities() const {
+			return *m_entities;
+		}
+
+		size_t SizeHint() const {
+			return m_entities->size();
+		}
+
+	private:
+		std::tuple<SparseSet<Ts>*...> m_pools;
+		const std::vector<EntityID>* m_entities{ nullptr };
+	};
+
+}
+
+#endif COMPONENTVIEW_H
@@ -3,6 +3,7 @@
 #include "ECS.h"
 #include "Component/ComponentHeader.h"
 #include "Debugging/Logging.h"
+#include "Debugging/Profiler.h"
 #include "Reflection/ReflectionInvoker.h"
 #include "Reflection/Field.h"
 #include "Scene/SceneManager.h"
@@ -12,6 +13,7 @@
 
 namespace ecs{
 	std::unordered_map<std::string, std::function<std::shared_ptr<IActionInvoker>()>> ComponentTypeRegistry::actionFactories;
+	uint32_t ECS::s_registryCount = 0;
 
 	void ECS::Load() {
 
@@ -81,6 +83,7 @@ namespace ecs{
 
 
 	void ECS::Update(float DT) {
+		KOS_PROFILE_SCOPE("ECS::Update");
 
 		//update deltatime
 		m_deltaTime = DT;
@@ -99,39 +102,48 @@ namespace ecs{
 				
 		}
 
-		//retrieve all active scenes
-		std::vector<decltype(sceneMap)::key_type> keys;
-		for (const auto& [sceneName, sceneID] : sceneMap) {
-			if (sceneID.isActive) {
-				keys.push_back(sceneName);
+		//systems only run when there is at least one active scene
+		const bool hasActiveScene = std::any_of(sceneMap.begin(), sceneMap.end(),
+			[](const auto& scene) { return scene.second.isActive; });
+
+		//each system runs once per frame.
+		//scene scoping is done through system registration, entities of inactive scenes are deregistered
+		m_runnableSystems.clear();
+		if (hasActiveScene) {
+			for (const auto& [systemName, system] : m_systemMap) {
+				if (system->TestState(m_state)) { //only run state system registered in
+					m_runnableSystems.push_back(system.get());
+				}
 			}
-			
 		}
 
+		//systems without conflicting component access run concurrently
+		m_scheduler.Build(m_runnableSystems);
+		m_scheduler.Run();
 
-		//loops through all the system
-		for (const auto& [systemName, system] : m_systemMap) {
-	
-			std::chrono::duration<float> systemDuration{};
-			auto start = std::chrono::steady_clock::now();
-			if (system->TestState(m_state)) { //only run state system registered in
-				
-				for (const auto& sceneName : keys) {
-					
-
-					system->Update();
-
-				}
+		for (ISystem* system : m_runnableSystems) {
+			system->LateUpdate();
+		}
 
+		size_t scheduled{};
+		for (const auto& [systemName, system] : m_systemMap) {
+			if (scheduled < m_runnableSystems.size() && m_runnableSystems[scheduled] == system.get()) {
+				const auto& timing = m_scheduler.GetTiming(scheduled++);
+				m_performance.SetSystemValue(systemName, timing.duration);
+				m_performance.SetSystemWorker(systemName, timing.worker);
+			}
+			else {
+				m_performance.SetSystemValue(systemName, 0.f);
+				m_performance.SetSystemWorker(systemName, -1);
 			}
-			auto end = std::chrono::steady_clock::now();
-			systemDuration = (end - start);
-			m_performance.SetSystemValue(systemName, systemDuration.count());
 		}
+		m_performance.SetCriticalPath(m_scheduler.GetCriticalPath());
 		
 	}
 
 	void ECS::EndFrame() {
+		m_commandBuffer.Flush();
+
 		if (m_deletedEntities.size() > 0) {
 			//clear and deletedEntities
 			for (EntityID id : m_deletedEntities) {
@@ -142,44 +154,200 @@ namespace ecs{
 	}
 
 	void ECS::Unload() {
-		m_combinedComponentPool.clear();
+		for (auto& pool : m_componentPools) {
+			pool.reset();
+		}
 	}
 
 	void ECS::RegisterEntity(EntityID ID) {
+		if (!m_heldScenes.empty() && m_heldScenes.count(GetSlot(ID).scene)) return;
 
-		for (auto& system : m_systemMap) {
-			if ((m_entityMap.find(ID)->second & system.second->GetSignature()) == system.second->GetSignature()) {
-
-				system.second->RegisterSystem(ID);
-
+		if (m_registrationBatch > 0) {
+			EntitySlot& slot = GetSlot(ID);
+			if (!slot.registrationPending) {
+				slot.registrationPending = true;
+				m_pendingRegistration.push_back(ID);
 			}
+			return;
 		}
+
+		UpdateSystemMembership(ID);
 	}
 
 	void ECS::DeregisterEntity(EntityID ID) {
+		GetSlot(ID).registrationPending = false;
 
 		for (auto& system : m_systemMap) {
-			if ((m_entityMap.find(ID)->second & system.second->GetSignature()) == system.second->GetSignature()) {
-
+			if (system.second->HasEntity(ID)) {
 				system.second->DeregisterSystem(ID);
+			}
+		}
+
+	}
 
+	void ECS::UpdateSystemMembership(EntityID ID) {
+		//one pass, joins the systems it now matches and leaves the ones it no longer matches
+		const ComponentSignature& signature = m_entityMap.find(ID)->second;
+		for (auto& system : m_systemMap) {
+			const ComponentSignature& systemSignature = system.second->GetSignature();
+			if ((signature & systemSignature) == systemSignature) {
+				system.second->RegisterSystem(ID);
+			}
+			else if (system.second->HasEntity(ID)) {
+				system.second->DeregisterSystem(ID);
 			}
 		}
+	}
 
+	void ECS::BeginRegistrationBatch() {
+		++m_registrationBatch;
 	}
 
-	EntityID ECS::CreateEntity(const std::string& scene) {
+	void ECS::EndRegistrationBatch() {
+		if (m_registrationBatch == 0 || --m_registrationBatch > 0) return;
+
+		std::vector<EntityID> pending;
+		pending.swap(m_pendingRegistration);
+		for (const EntityID ID : pending) {
+			EntitySlot& slot = GetSlot(ID);
+			//deleted or deregistered since it was queued
+			if (!slot.registrationPending || !slot.alive) continue;
+
+			slot.registrationPending = false;
+			if (!m_heldScenes.empty() && m_heldScenes.count(slot.scene)) continue;
+			UpdateSystemMembership(ID);
+		}
+	}
+
+	void ECS::HoldSceneRegistration(const std::string& scene) {
+		m_heldScenes.insert(InternSceneName(scene));
+	}
+
+	void ECS::ReleaseSceneRegistration(const std::string& scene) {
+		if (m_heldScenes.erase(InternSceneName(scene)) == 0) return;
+
+		const auto sceneIt = sceneMap.find(scene);
+		if (sceneIt == sceneMap.end()) return;
+
+		RegistrationBatchScope registrationBatch(*this);
+		for (const EntityID ID : sceneIt->second.sceneIDs) {
+			RegisterEntity(ID);
+		}
+	}
+
+	void ECS::TakeSnapshot(ECSSnapshot& snapshot) {
+		KOS_PROFILE_SCOPE("ECS::TakeSnapshot");
+
+		snapshot = ECSSnapshot{};
+		snapshot.m_pools.resize(m_componentPools.size());
+		for (const auto& [componentName, key] : m_componentKey) {
+			if (!m_componentPools[key]) continue;
+			snapshot.m_pools[key] = componentAction.at(componentName)->CopyPool();
+		}
+
+		//kept by the scene file but outside reflection
+		auto* transforms = static_cast<SparseSet<TransformComponent>*>(snapshot.m_pools[GetComponentKey<TransformComponent>()].get());
+		for (const EntityID id : transforms->GetEntityList()) {
+			const TransformComponent* source = GetComponent<TransformComponent>(id);
+			TransformComponent* copy = transforms->Get(id);
+			copy->m_childID = source->m_childID;
+			copy->m_parentID = source->m_parentID;
+			copy->m_haveParent = source->m_haveParent;
+		}
+		auto* names = static_cast<SparseSet<NameComponent>*>(snapshot.m_pools[GetComponentKey<NameComponent>()].get());
+		for (const EntityID id : names->GetEntityList()) {
+			names->Get(id)->entityGUID = GetComponent<NameComponent>(id)->entityGUID;
+		}
+
+		snapshot.m_entityMap = m_entityMap;
+		snapshot.m_GUIDtoEntityID = m_GUIDtoEntityID;
+		snapshot.m_sceneMap = sceneMap;
+		snapshot.m_entityCount = m_entityCount;
+		snapshot.m_availableEntityID = m_availableEntityID;
+		snapshot.m_sceneSlots.reserve(m_entityMap.size());
+		for (const auto& [id, signature] : m_entityMap) {
+			const EntitySlot& slot = GetSlot(id);
+			snapshot.m_sceneSlots.push_back({ id, slot.scene, slot.scenePosition });
+		}
+		snapshot.m_taken = true;
+	}
+
+	void ECS::RestoreSnapshot(ECSSnapshot& snapshot) {
+		if (snapshot.Empty()) return;
+		KOS_PROFILE_SCOPE("ECS::RestoreSnapshot");
+
+		//structural changes recorded during play are dropped with the play state
+		m_commandBuffer.Clear();
+		m_deletedEntities.clear();
+
+		//systems let go of their entities the same way a scene clear does
+		for (const auto& [id, signature] : m_entityMap) {
+			DeregisterEntity(id);
+		}
+		const std::unordered_map<EntityID, ComponentSignature> playEntities = std::move(m_entityMap);
+
+		for (size_t key = 0; key < m_componentPools.size(); ++key) {
+			if (!m_componentPools[key]) continue;
+			if (key < snapshot.m_pools.size() && snapshot.m_pools[key]) {
+				m_componentPools[key]->Swap(*snapshot.m_pools[key]);
+			}
+			else {
+				m_componentPools[key]->Clear();
+			}
+		}
+
+		m_entityMap = std::move(snapshot.m_entityMap);
+		m_GUIDtoEntityID = std::move(snapshot.m_GUIDtoEntityID);
+		sceneMap = std::move(snapshot.m_sceneMap);
+		m_entityCount = snapshot.m_entityCount;
+		m_availableEntityID = std::move(snapshot.m_availableEntityID);
+		m_pendingRegistration.clear();
+
+		//entities created during play are gone, handles to them go stale
+		for (const auto& [id, signature] : playEntities) {
+			if (m_entityMap.find(id) == m_entityMap.end()) ++GetSlot(id).generation;
+		}
+		for (EntitySlot& slot : m_entitySlots) {
+			slot.alive = false;
+			slot.registrationPending = false;
+			slot.scene = INVALID_SCENE;
+		}
+		for (const ECSSnapshot::SceneSlot& sceneSlot : snapshot.m_sceneSlots) {
+			EntitySlot& slot = GetSlot(sceneSlot.entity);
+			slot.alive = true;
+			slot.scene = sceneSlot.scene;
+			slot.scenePosition = sceneSlot.scenePosition;
+		}
+		++m_hierarchyVersion;
+
+		{
+			RegistrationBatchScope registrationBatch(*this);
+			for (const auto& [id, signature] : m_entityMap) {
+				RegisterEntity(id);
+			}
+		}
+
+		snapshot = ECSSnapshot{};
+	}
 
+	EntityID ECS::AllocateEntityID() {
 		EntityID ID = 0;
-		if (m_entityCount < MaxEntity) {
+		//fresh ids past MaxEntity when nothing has been recycled yet
+		if (m_entityCount < MaxEntity || m_availableEntityID.empty()) {
 			ID = m_entityCount++;
 		}
 		else {
 			ID = m_availableEntityID.top();
 			m_availableEntityID.pop();
 		}
+		return ID;
+	}
 
-		
+	EntityID ECS::CreateEntity(const std::string& scene) {
+		return CreateEntityWithID(AllocateEntityID(), scene);
+	}
+
+	EntityID ECS::CreateEntityWithID(EntityID ID, const std::string& scene) {
 
 		// set bitflag to 0
 		m_entityMap[ID] = 0;
@@ -191,7 +359,9 @@ namespace ecs{
 			throw std::runtime_error("Scene does not exits");
 		}
 
-		sceneMap.find(scene)->second.sceneIDs.push_back(ID);
+		EntitySlot& slot = GetSlot(ID);
+		slot.alive = true;
+		AddEntityToScene(ID, scene);
 
 		//add transform component and name component as default
 		AddComponent<NameComponent>(ID);
@@ -201,6 +371,10 @@ namespace ecs{
 	}
 
 	EntityID ECS::DuplicateEntity(EntityID DuplicatesID, std::string scene) {
+		return DuplicateEntityWithID(DuplicatesID, AllocateEntityID(), std::move(scene));
+	}
+
+	EntityID ECS::DuplicateEntityWithID(EntityID DuplicatesID, EntityID NewEntity, std::string scene) {
 
 		if (scene.empty()) {
 			const auto& result = GetSceneByEntityID(DuplicatesID);
@@ -215,7 +389,7 @@ namespace ecs{
 			}
 		}
 
-		EntityID NewEntity = CreateEntity(scene);
+		CreateEntityWithID(NewEntity, scene);
 		ComponentSignature DuplicateSignature = m_entityMap.find(DuplicatesID)->second;
 
 		for (const auto& [ComponentName, key] : m_componentKey) {
@@ -295,12 +469,7 @@ namespace ecs{
 
 
 		// remove entity from scene
-		const auto& result = GetSceneByEntityID(ID);
-		if (!result.empty()) {
-			auto& entityList = sceneMap.find(result)->second.sceneIDs;
-			auto it = std::find(entityList.begin(), entityList.end(), ID);
-			sceneMap.find(result)->second.sceneIDs.erase(it);
-		}
+		RemoveEntityFromScene(ID);
 
 		//get child
 		if (GetChild(ID).has_value()) {
@@ -320,14 +489,19 @@ namespace ecs{
 		
 
 		// reset all components
-		for (const auto& [ComponentName, key] : m_componentKey) {
-			if (m_entityMap.find(ID)->second.test(key)) {
-				m_combinedComponentPool[ComponentName]->Delete(ID);
+		const ComponentSignature& signature = m_entityMap.find(ID)->second;
+		for (size_t key = 0; key < m_componentPools.size(); ++key) {
+			if (signature.test(key) && m_componentPools[key]) {
+				m_componentPools[key]->Delete(ID);
 			}
 		}
 
 		//delete stored entity
-		m_entityMap.erase(ID);		
+		m_entityMap.erase(ID);
+		++m_hierarchyVersion;
+		EntitySlot& slot = GetSlot(ID);
+		slot.alive = false;
+		++slot.generation;
 		m_availableEntityID.push(ID);
 
 		return;
@@ -338,31 +512,127 @@ namespace ecs{
 
 
 	void ECS::FreeComponentPool(const std::string& componentName) {
-		if (m_combinedComponentPool.find(componentName) != m_combinedComponentPool.end()) {
-			m_combinedComponentPool.erase(componentName);
+		//key is kept reserved so a reloaded component gets the same key back
+		const auto keyIt = m_componentKey.find(componentName);
+		if (keyIt != m_componentKey.end()) {
+			m_componentPools[keyIt->second].reset();
 		}
 
 	}
 
+	ISparseSet* ECS::GetComponentPool(const std::string& componentName) {
+		const auto keyIt = m_componentKey.find(componentName);
+		if (keyIt == m_componentKey.end()) {
+			return nullptr;
+		}
+		return m_componentPools[keyIt->second].get();
+	}
+
 	const std::vector<EntityID>& ECS::GetComponentsEnties(const std::string& componentName) {
-		if (m_combinedComponentPool.find(componentName) != m_combinedComponentPool.end()) {
-			return m_combinedComponentPool.at(componentName)->GetEntityList();
+		ISparseSet* pool = GetComponentPool(componentName);
+		if (pool) {
+			return pool->GetEntityList();
 		}
 		else {
 			throw std::runtime_error("ecs get component entities");
 		}
 	}
 
+	ECS::EntitySlot& ECS::GetSlot(EntityID ID) {
+		if (static_cast<size_t>(ID) >= m_entitySlots.size()) {
+			m_entitySlots.resize(static_cast<size_t>(ID) + 1);
+		}
+		return m_entitySlots[ID];
+	}
+
+	uint32_t ECS::InternSceneName(const std::string& scene) {
+		const auto it = m_sceneNameIndex.find(scene);
+		if (it != m_sceneNameIndex.end()) return it->second;
+
+		const uint32_t index = static_cast<uint32_t>(m_sceneNames.size());
+		m_sceneNames.push_back(scene);
+		m_sceneNameIndex[scene] = index;
+		return index;
+	}
+
+	EntityHandle ECS::GetHandle(EntityID ID) const {
+		if (ID < 0 || static_cast<size_t>(ID) >= m_entitySlots.size() || !m_entitySlots[ID].alive) {
+			return EntityHandle{};
+		}
+		return EntityHandle{ ID, m_entitySlots[ID].generation };
+	}
+
+	bool ECS::IsValid(EntityHandle handle) const {
+		if (handle.id < 0 || static_cast<size_t>(handle.id) >= m_entitySlots.size()) return false;
+
+		const EntitySlot& slot = m_entitySlots[handle.id];
+		return slot.alive && slot.generation == handle.generation;
+	}
+
+	EntityID ECS::Resolve(EntityHandle handle) const {
+		return IsValid(handle) ? handle.id : -1;
+	}
+
 	std::string ECS::GetSceneByEntityID(ecs::EntityID entityID) {
+		if (entityID < 0 || static_cast<size_t>(entityID) >= m_entitySlots.size()) {
+			return std::string();
+		}
+
+		EntitySlot& slot = m_entitySlots[entityID];
+		if (slot.scene != INVALID_SCENE) {
+			const auto sceneIt = sceneMap.find(m_sceneNames[slot.scene]);
+			if (sceneIt != sceneMap.end()) {
+				const auto& entityList = sceneIt->second.sceneIDs;
+				if (slot.scenePosition < entityList.size() && entityList[slot.scenePosition] == entityID) {
+					return sceneIt->first;
+				}
+			}
+		}
+
+		//sceneIDs was edited outside of the ECS (eg. hierarchy reordering), rescan and repair the slot
 		for (const auto& [sceneName, entityList] : sceneMap) {
 			// Check if the entityID is in the current vector of entity IDs
-			if (std::find(entityList.sceneIDs.begin(), entityList.sceneIDs.end(), entityID) != entityList.sceneIDs.end()) {
+			const auto it = std::find(entityList.sceneIDs.begin(), entityList.sceneIDs.end(), entityID);
+			if (it != entityList.sceneIDs.end()) {
+				slot.scene = InternSceneName(sceneName);
+				slot.scenePosition = static_cast<uint32_t>(it - entityList.sceneIDs.begin());
 				return sceneName;  // Found the matching scene name
 			}
 		}
+
+		slot.scene = INVALID_SCENE;
 		return std::string();  // No match found
 	}
 
+	void ECS::AddEntityToScene(EntityID ID, const std::string& scene) {
+		auto& entityList = sceneMap.at(scene).sceneIDs;
+
+		EntitySlot& slot = GetSlot(ID);
+		slot.scene = InternSceneName(scene);
+		slot.scenePosition = static_cast<uint32_t>(entityList.size());
+		entityList.push_back(ID);
+	}
+
+	void ECS::RemoveEntityFromScene(EntityID ID) {
+		const std::string scene = GetSceneByEntityID(ID);
+		if (scene.empty()) return;
+
+		EntitySlot& slot = m_entitySlots[ID];
+		auto& entityList = sceneMap.find(scene)->second.sceneIDs;
+
+		//swap the last entity into the removed slot
+		const EntityID last = entityList.back();
+		entityList[slot.scenePosition] = last;
+		entityList.pop_back();
+		if (last != ID) {
+			EntitySlot& lastSlot = GetSlot(last);
+			lastSlot.scene = slot.scene;
+			lastSlot.scenePosition = slot.scenePosition;
+		}
+
+		slot.scene = INVALID_SCENE;
+	}
+
 
 	void ECS::SetParent(EntityID parent, EntityID child, bool updateTransform) {
 
@@ -388,6 +658,7 @@ namespace ecs{
 		}
 
 		parentTransform->m_childID.push_back(child);
+		++m_hierarchyVersion;
 
 		TransformComponent* childTransform = GetComponent<TransformComponent>(child);
 		childTransform->m_haveParent = true;
@@ -421,6 +692,7 @@ namespace ecs{
 		TransformComponent* childTransform = GetComponent<TransformComponent>(child);
 		childTransform->m_haveParent = false;
 		childTransform->m_parentID = -1;
+		++m_hierarchyVersion;
 		//Updating Transformation Mtxs
 		if (updateTransform) {
 			childTransform->localTransform = childTransform->transformation;
@@ -26,6 +26,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "ECS/System/System.h"
 #include "ECS/System/SystemHeader.h"
 #include "ECS/SparseSet.h"
+#include "ECS/ComponentView.h"
+#include "ECS/SystemScheduler.h"
+#include "ECS/EntityCommandBuffer.h"
+#include "ECS/ECSSnapshot.h"
+#include "Utility/JobSystem.h"
 
 
 #include "Reflection/IReflectionInvoker.h"
@@ -43,6 +48,22 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace ecs {
 
+	/******************************************************************/
+	/*!
+	\class     ComponentTypeKey
+	\brief     Per component type cache of the dense component key.
+			   The key is resolved from the ECS by classname once and
+			   reused afterwards, so pool access and signature tests
+			   are an array index and a bit op. The owner id guards
+			   against a different ECS instance (or a module that has
+			   its own copy of this static, eg. the script DLL).
+	*/
+	/******************************************************************/
+	template <typename T>
+	struct ComponentTypeKey {
+		static inline uint32_t owner{ 0 };
+		static inline size_t key{ 0 };
+	};
 
 	class ECS {
 	private:
@@ -63,7 +84,8 @@ namespace ecs {
 			m_resourceManager(rm),
 			m_inputSystem(is),
 			m_physicsManager(pm),
-			m_scriptManager(sm)
+			m_scriptManager(sm),
+			m_registryID(++s_registryCount)
 		{}
 
 		void Load();
@@ -76,6 +98,9 @@ namespace ecs {
 		EntityID DuplicateEntity(EntityID, std::string scene = {});
 		void DeleteEntity(EntityID);
 
+		//structural changes recorded here are applied once at EndFrame
+		EntityCommandBuffer& GetCommandBuffer() { return m_commandBuffer; }
+
 		template<typename T>
 		T* AddComponent(EntityID ID);
 		template<typename T>
@@ -89,6 +114,19 @@ namespace ecs {
 		template <typename T>
 		void ResetComponent(EntityID ID);
 
+		//Component Views - pools are resolved once per view instead of once per entity
+		template<typename T>
+		SparseSet<T>* GetComponentPool();
+		ISparseSet* GetComponentPool(const std::string& componentName);
+		//keys outlive their pools, nullptr while the component is unloaded
+		ISparseSet* GetComponentPool(size_t key) {
+			return key < m_componentPools.size() ? m_componentPools[key].get() : nullptr;
+		}
+		template<typename... Ts>
+		ComponentView<Ts...> View();
+		template<typename... Ts>
+		ComponentView<Ts...> View(const std::vector<EntityID>& entities);
+
 		//Hierachy Logic
 
 		void SetParent(EntityID parent, EntityID child, bool updateTransform = false);
@@ -99,6 +137,9 @@ namespace ecs {
 
 		std::optional<std::vector<EntityID>> GetChild(EntityID parent);
 
+		//changes whenever a parent/child link is made or broken
+		uint32_t GetHierarchyVersion() const { return m_hierarchyVersion; }
+
 
 
 
@@ -112,7 +153,12 @@ namespace ecs {
 
 		template<typename T>
 		size_t GetComponentKey(){
-			return m_componentKey.at(T::classname());
+			auto& cache = ComponentTypeKey<T>::key;
+			if (ComponentTypeKey<T>::owner != m_registryID) {
+				cache = m_componentKey.at(T::classname());
+				ComponentTypeKey<T>::owner = m_registryID;
+			}
+			return cache;
 		}
 		size_t GetComponentKey(const std::string& className) {
 			return m_componentKey.at(className);
@@ -159,7 +205,15 @@ namespace ecs {
 			return m_entityMap.find(ID) != m_entityMap.end();
 		}
 
+		//GENERATIONAL HANDLES
+		EntityHandle GetHandle(EntityID ID) const;
+		bool IsValid(EntityHandle handle) const;
+		EntityID Resolve(EntityHandle handle) const; // -1 if the entity is gone
+
+		//SCENE MEMBERSHIP - entities know their scene and position in sceneIDs
 		std::string GetSceneByEntityID(ecs::EntityID entityID);
+		void AddEntityToScene(EntityID ID, const std::string& scene);
+		void RemoveEntityFromScene(EntityID ID); // swap-remove, changes the order of sceneIDs
 
 
 
@@ -172,6 +226,8 @@ namespace ecs {
 		void SetState(GAMESTATE state) { m_nextState = state; }
 
 		float m_GetDeltaTime() { return m_deltaTime; }
+
+		utility::JobSystem& GetJobSystem() { return m_jobSystem; }
 		
 
 		std::unordered_map<std::string, std::shared_ptr<IActionInvoker>> componentAction;
@@ -185,14 +241,40 @@ namespace ecs {
 		const std::vector<EntityID>& GetComponentsEnties(const std::string& componentName);
 
 
+		//updates the entity's system membership to match its signature, deferred while batching
 		void RegisterEntity(EntityID);
+		//removes the entity from every system, always immediate
 		void DeregisterEntity(EntityID);
 
-		
+		//membership updates between Begin/End are applied once per entity at the end,
+		//only batch while no system is updating
+		void BeginRegistrationBatch();
+		void EndRegistrationBatch();
+
+		//entities of a held scene stay out of every system until the scene is released,
+		//used while a scene is streamed in over several frames
+		void HoldSceneRegistration(const std::string& scene);
+		void ReleaseSceneRegistration(const std::string& scene);
+
+		//PLAY MODE SNAPSHOT - see ECSSnapshot.h
+		void TakeSnapshot(ECSSnapshot& snapshot);
+		//every entity leaves its systems, the snapshot is swapped in and its entities register again,
+		//the snapshot is empty afterwards
+		void RestoreSnapshot(ECSSnapshot& snapshot);
+
 
 	private:
+		friend class EntityCommandBuffer;
 
+		EntityID AllocateEntityID();
+		EntityID CreateEntityWithID(EntityID ID, const std::string& scene);
+		EntityID DuplicateEntityWithID(EntityID DuplicatesID, EntityID NewEntity, std::string scene);
 		void DeleteEntityImmediate(EntityID);
+		void UpdateSystemMembership(EntityID ID);
+
+		template <typename... Components>
+		ComponentSignature MakeSignature(ComponentList<Components...>);
+		ComponentSignature MakeSignature(AllComponents) { return ComponentSignature{}.set(); }
 		//modify from set next state
 		GAMESTATE m_nextState{ STOP };
 		GAMESTATE m_state{ STOP };
@@ -200,14 +282,26 @@ namespace ecs {
 		float m_deltaTime{};
 
 		//COMPONENT DATA
-		std::unordered_map<std::string, std::shared_ptr<ISparseSet>> m_combinedComponentPool;
-		std::unordered_map<std::string, std::vector<std::string>> m_dependentComponent;
+		//pools and dependencies are indexed by component key, names are only kept for reflection/serialization
+		std::vector<std::shared_ptr<ISparseSet>> m_componentPools;
+		std::vector<std::vector<size_t>> m_dependentComponent;
+		std::vector<std::string> m_componentNames;
 		std::map<std::string, size_t> m_componentKey;
 		std::unordered_set<std::string> m_componentStrings;
 		size_t totalComponents = 0;
 
+		static uint32_t s_registryCount;
+		const uint32_t m_registryID;
+
 		//SYSTEMDATA
+		//declared before the systems so it outlives them, systems may have jobs in flight
+		utility::JobSystem m_jobSystem;
 		std::map<std::string, std::shared_ptr<ISystem>> m_systemMap;
+		SystemScheduler m_scheduler{ m_jobSystem };
+		std::vector<ISystem*> m_runnableSystems;
+		EntityCommandBuffer m_commandBuffer{ *this };
+		size_t m_registrationBatch{};
+		std::vector<EntityID> m_pendingRegistration;
 
 		//ENTITY DATA
 		std::unordered_map<EntityID, ComponentSignature> m_entityMap;
@@ -215,7 +309,40 @@ namespace ecs {
 		std::stack<EntityID> m_availableEntityID;
 		std::unordered_map<utility::GUID, ecs::EntityID> m_GUIDtoEntityID;
 		std::vector<EntityID> m_deletedEntities;
+		uint32_t m_hierarchyVersion{};
+
+		struct EntitySlot {
+			uint32_t generation{};
+			uint32_t scene{ INVALID_SCENE };	// index into m_sceneNames
+			uint32_t scenePosition{};			// index into the scene's sceneIDs
+			bool alive{ false };
+			bool registrationPending{ false };
+		};
+		static constexpr uint32_t INVALID_SCENE = std::numeric_limits<uint32_t>::max();
+
+		EntitySlot& GetSlot(EntityID ID);
+		uint32_t InternSceneName(const std::string& scene);
+
+		//indexed by EntityID
+		std::vector<EntitySlot> m_entitySlots;
+		//scene names are interned so slots stay valid when scenes are added/removed
+		std::vector<std::string> m_sceneNames;
+		std::unordered_map<std::string, uint32_t> m_sceneNameIndex;
+		std::unordered_set<uint32_t> m_heldScenes;
+
+	};
+
+	//keeps a registration batch open for the current scope, also closes it if loading throws
+	class RegistrationBatchScope {
+	public:
+		explicit RegistrationBatchScope(ECS& ecs) : m_ecs(ecs) { m_ecs.BeginRegistrationBatch(); }
+		~RegistrationBatchScope() { m_ecs.EndRegistrationBatch(); }
+
+		RegistrationBatchScope(const RegistrationBatchScope&) = delete;
+		RegistrationBatchScope& operator=(const RegistrationBatchScope&) = delete;
 
+	private:
+		ECS& m_ecs;
 	};
 
 	#include "Reflection/ReflectionInvoker.h" //this stays after ecs class and before component type registry, HEADER HELL
@@ -245,19 +372,40 @@ namespace ecs {
 	void ECS::RegisterComponent()
 	{
 		std::string classname = T::classname();
-		if (m_combinedComponentPool.find(classname) != m_combinedComponentPool.end()) {
-			m_combinedComponentPool.erase(classname);
+
+		//re-registering a component keeps its key so cached keys and signatures stay valid
+		size_t key{};
+		const auto keyIt = m_componentKey.find(classname);
+		if (keyIt != m_componentKey.end()) {
+			key = keyIt->second;
+		}
+		else {
+			key = ++totalComponents;
+			m_componentKey[classname] = key;
+		}
+
+		if (key >= MAXCOMPONENT) {
+			LOGGING_ERROR("Exceeded max number of components");
+			throw std::runtime_error("Exceeded max number of components");
+		}
+
+		if (m_componentPools.size() <= key) {
+			m_componentPools.resize(key + 1);
+			m_dependentComponent.resize(key + 1);
+			m_componentNames.resize(key + 1);
 		}
 
 		// Count how many dependent components were passed
 		constexpr size_t dependencyCount = sizeof...(DependentComponent);
 
 		if constexpr (dependencyCount > 0) {
-			(..., m_dependentComponent[classname].push_back(DependentComponent::classname()));
+			(..., m_dependentComponent[key].push_back(GetComponentKey<DependentComponent>()));
 		}
 		
-		m_combinedComponentPool[classname] = std::make_shared<SparseSet<T>>();
-		m_componentKey[classname] = ++totalComponents;
+		m_componentPools[key] = std::make_shared<SparseSet<T>>();
+		m_componentNames[key] = classname;
+		ComponentTypeKey<T>::key = key;
+		ComponentTypeKey<T>::owner = m_registryID;
 		m_componentStrings.insert(classname);
 
 		ComponentTypeRegistry::RegisterComponentType<T>(this);
@@ -272,11 +420,27 @@ namespace ecs {
 		ComponentSignature signature;
 
 		// reversed order expansion
-		(..., signature.set(GetComponentKey(Components::classname())));
+		(..., signature.set(GetComponentKey<Components>()));
 
 		m_systemMap[T::classname()] = std::make_shared<T>(*this, m_graphicsManager, m_resourceManager, m_inputSystem, m_physicsManager, m_scriptManager, m_performance);
 		m_systemMap[T::classname()]->AssignSignature(signature);
 
+		//access defaults to the signature on the main thread, systems can narrow it with
+		//ReadComponents/WriteComponents and opt into the worker threads with runOnWorker
+		ComponentSignature readSignature = signature;
+		ComponentSignature writeSignature = signature;
+		bool mainThread = true;
+		if constexpr (requires { typename T::ReadComponents; }) {
+			readSignature = MakeSignature(typename T::ReadComponents{});
+		}
+		if constexpr (requires { typename T::WriteComponents; }) {
+			writeSignature = MakeSignature(typename T::WriteComponents{});
+		}
+		if constexpr (requires { T::runOnWorker; }) {
+			mainThread = !T::runOnWorker;
+		}
+		m_systemMap[T::classname()]->AssignAccess(readSignature, writeSignature, mainThread);
+
 		std::bitset<GAMESTATE_COUNT> gameState;
 		if constexpr (sizeof...(states) == 0) {
 			gameState.set(); // all states enabled
@@ -291,6 +455,13 @@ namespace ecs {
 	}
 
 
+	template <typename... Components>
+	ComponentSignature ECS::MakeSignature(ComponentList<Components...>) {
+		ComponentSignature signature;
+		(..., signature.set(GetComponentKey<Components>()));
+		return signature;
+	}
+
 	template <typename T>
 	T* ECS::AddComponent(EntityID ID) {
 
@@ -302,7 +473,7 @@ namespace ecs {
 			return GetComponent<T>(ID);
 		}
 
-		T* ComponentPtr = std::static_pointer_cast<SparseSet<T>>(m_combinedComponentPool.at(T::classname()))->Set(ID, T());
+		T* ComponentPtr = GetComponentPool<T>()->Set(ID, T());
 		ComponentPtr->entity = ID;
 
 
@@ -312,13 +483,12 @@ namespace ecs {
 		RegisterEntity(ID);
 
 		//check if component has dependent component
-		if (m_dependentComponent.find(T::classname()) != m_dependentComponent.end()) {
-			for (const auto& dependentComp : m_dependentComponent[T::classname()]) {
-				if (!m_entityMap[ID].test(GetComponentKey(dependentComp))) {
-					LOGGING_INFO("Auto Adding Dependent Component: " + dependentComp);
-					auto& action = componentAction.at(dependentComp);
-					action->AddComponent(ID);
-				}
+		for (const size_t dependentKey : m_dependentComponent[GetComponentKey<T>()]) {
+			if (!m_entityMap[ID].test(dependentKey)) {
+				const std::string& dependentComp = m_componentNames[dependentKey];
+				LOGGING_INFO("Auto Adding Dependent Component: " + dependentComp);
+				auto& action = componentAction.at(dependentComp);
+				action->AddComponent(ID);
 			}
 		}
 
@@ -334,25 +504,37 @@ namespace ecs {
 			return;
 		}
 
-		m_combinedComponentPool.at(T::classname())->Delete(ID);
-
-		//deregister everthing
-		DeregisterEntity(ID);
+		GetComponentPool<T>()->Delete(ID);
 
 		m_entityMap.find(ID)->second.reset(GetComponentKey<T>());
 
-		//register everything
+		//leaves the systems that needed the component
 		RegisterEntity(ID);
 	}
 
 	template<typename T>
 	T* ECS::GetComponent(EntityID ID) {
-		return std::static_pointer_cast<SparseSet<T>>(m_combinedComponentPool.at(T::classname()))->Get(ID);
+		return GetComponentPool<T>()->Get(ID);
+	}
+
+	template<typename T>
+	SparseSet<T>* ECS::GetComponentPool() {
+		return static_cast<SparseSet<T>*>(m_componentPools[GetComponentKey<T>()].get());
+	}
+
+	template<typename... Ts>
+	ComponentView<Ts...> ECS::View() {
+		return ComponentView<Ts...>(GetComponentPool<Ts>()...);
+	}
+
+	template<typename... Ts>
+	ComponentView<Ts...> ECS::View(const std::vector<EntityID>& entities) {
+		return ComponentView<Ts...>(entities, GetComponentPool<Ts>()...);
 	}
 
 	template<typename T>
 	bool ECS::HasComponent(EntityID ID) {
-		return m_combinedComponentPool.at(T::classname())->ContainsEntity(ID);
+		return GetComponentPool<T>()->ContainsEntity(ID);
 	}
 
 
@@ -384,11 +566,25 @@ namespace ecs {
 		Component->ApplyFunctionPairwise(duplicator, EmptyComponent);
 	}
 
+	template<typename T>
+	void EntityCommandBuffer::AddComponent(EntityID ID, T component) {
+		Record([ID, component = std::move(component)](ECS& ecs) mutable {
+			T* added = ecs.AddComponent<T>(ID);
+			*added = std::move(component);
+			added->entity = ID;
+		});
+	}
+
+	template<typename T>
+	void EntityCommandBuffer::RemoveComponent(EntityID ID) {
+		Record([ID](ECS& ecs) { ecs.RemoveComponent<T>(ID); });
+	}
+
 	template <typename T>
 	T ECS::GetIComponent(const std::string& componentName, EntityID ID)
 	{
-		auto& action = componentAction.at(componentName);
-		return static_cast<T>(m_combinedComponentPool.at(componentName)->GetBase(ID));
+		ISparseSet* pool = GetComponentPool(componentName);
+		return static_cast<T>(pool ? pool->GetBase(ID) : nullptr);
 	}
 
 }
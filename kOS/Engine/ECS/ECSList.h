@@ -23,9 +23,27 @@ namespace ecs {
 	using EntityID = int;
 	using ComponentSignature = std::bitset<MAXCOMPONENT>;
 
-	// Max number of entities allowed to be created
+	// Number of fresh ids handed out before deleted ids are recycled,
+	// not a hard limit, more fresh ids are created when nothing can be recycled
 	static EntityID MaxEntity = 2000;
 
+	// Generational handle, the generation changes every time the id is deleted
+	// so a handle kept across frames can detect that its entity is gone (or the id reused)
+	struct EntityHandle {
+		EntityID id{ -1 };
+		uint32_t generation{};
+
+		bool operator==(const EntityHandle&) const = default;
+	};
+
+	// Type list used by systems to declare the components they read/write,
+	// eg. using ReadComponents = ComponentList<NameComponent>;
+	template <typename... Components>
+	struct ComponentList {};
+
+	// Marks a system that may touch any component (eg. scripts)
+	struct AllComponents {};
+
 	enum GAMESTATE {
 		START,
 		RUNNING,
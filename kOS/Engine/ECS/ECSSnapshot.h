@@ -0,0 +1,61 @@
+/******************************************************************/
+/*!
+\file      ECSSnapshot.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   In memory copy of the ECS taken when play mode starts and
+		   restored when it stops.
+
+		   Components are copied with DeepCopyComponents, so the copy
+		   holds what the scene file would hold: the reflected fields,
+		   the entity GUIDs and the hierarchy. Runtime state such as
+		   physics actors is left default and is rebuilt when the
+		   restored entities register with the systems again.
+
+		   Restoring swaps the copied pools into the live ones. Pool
+		   pointers held by systems stay valid.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef ECSSNAPSHOT_H
+#define ECSSNAPSHOT_H
+
+#include "Config/pch.h"
+#include "ECS/ECSList.h"
+#include "ECS/SparseSet.h"
+#include "Scene/SceneData.h"
+#include "Utility/GUID.h"
+
+namespace ecs {
+
+	class ECSSnapshot {
+	public:
+		bool Empty() const { return !m_taken; }
+		size_t EntityCount() const { return m_entityMap.size(); }
+
+	private:
+		friend class ECS;
+
+		struct SceneSlot {
+			EntityID entity{};
+			uint32_t scene{};
+			uint32_t scenePosition{};
+		};
+
+		bool m_taken{ false };
+		//indexed by component key, null for pools that did not exist
+		std::vector<std::shared_ptr<ISparseSet>> m_pools;
+		std::unordered_map<EntityID, ComponentSignature> m_entityMap;
+		std::unordered_map<utility::GUID, EntityID> m_GUIDtoEntityID;
+		std::unordered_map<std::string, SceneData> m_sceneMap;
+		std::vector<SceneSlot> m_sceneSlots;
+		EntityID m_entityCount{};
+		std::stack<EntityID> m_availableEntityID;
+	};
+}
+
+#endif ECSSNAPSHOT_H
@@ -0,0 +1,71 @@
+/******************************************************************/
+/*!
+\file      EntityCommandBuffer.cpp
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   Deferred structural changes applied at the end of the frame.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "EntityCommandBuffer.h"
+#include "ECS/ECS.h"
+
+namespace ecs {
+
+	void EntityCommandBuffer::Record(std::function<void(ECS&)> command) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_commands.push_back(std::move(command));
+	}
+
+	EntityID EntityCommandBuffer::CreateEntity(const std::string& scene) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		const EntityID ID = m_ecs.AllocateEntityID();
+		m_commands.push_back([ID, scene](ECS& ecs) { ecs.CreateEntityWithID(ID, scene); });
+		return ID;
+	}
+
+	EntityID EntityCommandBuffer::DuplicateEntity(EntityID source, const std::string& scene) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		const EntityID ID = m_ecs.AllocateEntityID();
+		m_commands.push_back([source, ID, scene](ECS& ecs) { ecs.DuplicateEntityWithID(source, ID, scene); });
+		return ID;
+	}
+
+	void EntityCommandBuffer::DeleteEntity(EntityID ID) {
+		Record([ID](ECS& ecs) { ecs.DeleteEntityImmediate(ID); });
+	}
+
+	void EntityCommandBuffer::Flush() {
+		std::vector<std::function<void(ECS&)>> commands;
+
+		RegistrationBatchScope batch(m_ecs);
+		while (true) {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_commands.empty()) break;
+				commands.swap(m_commands);
+			}
+
+			for (auto& command : commands) {
+				command(m_ecs);
+			}
+			commands.clear();
+		}
+	}
+
+	void EntityCommandBuffer::Clear() {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_commands.clear();
+	}
+
+	size_t EntityCommandBuffer::Size() {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_commands.size();
+	}
+
+}
@@ -0,0 +1,66 @@
+/******************************************************************/
+/*!
+\file      EntityCommandBuffer.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   Deferred structural changes (create, duplicate, add/remove
+		   component, delete) recorded during the frame and applied
+		   by ECS::EndFrame.
+
+		   Ids of created entities are reserved when the command is
+		   recorded so later commands can refer to them. The flush
+		   runs inside a registration batch, every touched entity has
+		   its system membership updated once with its final
+		   signature instead of once per component.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef ENTITYCOMMANDBUFFER_H
+#define ENTITYCOMMANDBUFFER_H
+
+#include "Config/pch.h"
+#include "ECS/ECSList.h"
+
+namespace ecs {
+
+	class ECS;
+
+	class EntityCommandBuffer {
+	public:
+		explicit EntityCommandBuffer(ECS& ecs) : m_ecs(ecs) {}
+
+		//returns the reserved id, the entity exists after the flush
+		EntityID CreateEntity(const std::string& scene);
+		//copy of source and its children, used to spawn prefab instances
+		EntityID DuplicateEntity(EntityID source, const std::string& scene = {});
+		void DeleteEntity(EntityID ID);
+
+		//component is copied in as is when the command is applied
+		template<typename T>
+		void AddComponent(EntityID ID, T component = T());
+		template<typename T>
+		void RemoveComponent(EntityID ID);
+
+		//applies commands in recording order, commands recorded while flushing run in the same flush
+		void Flush();
+		void Clear();
+
+		size_t Size();
+		bool Empty() { return Size() == 0; }
+
+	private:
+		void Record(std::function<void(ECS&)> command);
+
+		ECS& m_ecs;
+		//recording is guarded so scripts running on jobs can record concurrently
+		std::mutex m_mutex;
+		std::vector<std::function<void(ECS&)>> m_commands;
+	};
+
+}
+
+#endif ENTITYCOMMANDBUFFER_H
@@ -26,12 +26,16 @@ namespace ecs {
 		virtual bool ContainsEntity(EntityID) = 0;
 		virtual void Clear() = 0;
 		virtual size_t Size() = 0;
+		//makes room for count more components, bulk loads grow the pool once
+		virtual void Reserve(size_t count) = 0;
+		//exchanges the contents with another pool of the same component type
+		virtual void Swap(ISparseSet& other) = 0;
 		virtual std::vector<EntityID>& GetEntityList() = 0;
 		virtual void* GetBase(EntityID) = 0;
 	};
 
 	template <typename T>
-	class SparseSet : public ISparseSet {
+	class SparseSet final : public ISparseSet {
 	private:
 
 		static constexpr size_t SPARSE_MAX_SIZE = 2048; //number of entities per page
@@ -131,6 +135,18 @@ namespace ecs {
 			return m_dense.size();
 		}
 
+		void Reserve(size_t count) override {
+			m_dense.reserve(m_dense.size() + count);
+			m_denseToEntity.reserve(m_denseToEntity.size() + count);
+		}
+
+		void Swap(ISparseSet& other) override {
+			SparseSet<T>& pool = static_cast<SparseSet<T>&>(other);
+			m_sparsePages.swap(pool.m_sparsePages);
+			m_dense.swap(pool.m_dense);
+			m_denseToEntity.swap(pool.m_denseToEntity);
+		}
+
 		std::vector<EntityID>& GetEntityList() override {
 			return m_denseToEntity;
 		}
@@ -13,11 +13,11 @@ namespace ecs {
 
     void AnimatorSystem::Update()
     {
-        const auto& entities = m_entities.Data();
+        auto view = m_ecs.View<AnimatorComponent, NameComponent>(m_entities.Data());
 
-        for (const EntityID id : entities) {
-            AnimatorComponent* animator = m_ecs.GetComponent<AnimatorComponent>(id);
-            NameComponent* nameComp = m_ecs.GetComponent<NameComponent>(id);
+        for (const EntityID id : view.Entities()) {
+            AnimatorComponent* animator = view.Get<AnimatorComponent>(id);
+            NameComponent* nameComp = view.Get<NameComponent>(id);
 
             // Skip entities not in this scene or hidden
             if ( nameComp->hide)
@@ -10,6 +10,9 @@ namespace ecs {
 
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<NameComponent>;
+        using WriteComponents = ComponentList<AnimatorComponent>;
+        static constexpr bool runOnWorker = true;
 
         void Init() override;
         void Update() override;
@@ -30,6 +30,9 @@ namespace ecs {
     class AudioSystem : public ISystem {
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, NameComponent>;
+        using WriteComponents = ComponentList<AudioComponent>;
+        static constexpr bool runOnWorker = true;
         void Init() override;
         void Update() override;
 
@@ -31,13 +31,13 @@ namespace ecs {
 
 	void CameraSystem::Update() {
 
-		const auto& entities = m_entities.Data();
+		auto view = m_ecs.View<TransformComponent, NameComponent, CameraComponent>(m_entities.Data());
 
 
-		for (const EntityID id : entities) {
-			TransformComponent* transform = m_ecs.GetComponent<TransformComponent>(id);
-			NameComponent* NameComp = m_ecs.GetComponent<NameComponent>(id);
-			CameraComponent* camera = m_ecs.GetComponent<CameraComponent>(id);
+		for (const EntityID id : view.Entities()) {
+			TransformComponent* transform = view.Get<TransformComponent>(id);
+			NameComponent* NameComp = view.Get<NameComponent>(id);
+			CameraComponent* camera = view.Get<CameraComponent>(id);
 
 			//skip component not of the scene
 			if (NameComp->hide) continue;
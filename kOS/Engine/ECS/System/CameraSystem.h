@@ -27,6 +27,8 @@ namespace ecs {
 
 	public:
 		using ISystem::ISystem;
+		using ReadComponents = ComponentList<TransformComponent, NameComponent, CameraComponent>;
+		using WriteComponents = ComponentList<>;
 		void Init() override;
 		void Update() override;
 
@@ -35,6 +35,8 @@ namespace ecs {
 
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, NameComponent, CanvasRendererComponent, SpriteComponent>;
+        using WriteComponents = ComponentList<>;
         void Init() override;
         void Update() override;
 
@@ -34,6 +34,8 @@ namespace ecs {
 
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, NameComponent, CanvasRendererComponent, TextComponent>;
+        using WriteComponents = ComponentList<>;
         void Init() override;
         void Update() override;
 
@@ -16,19 +16,18 @@ namespace ecs
     void CubeRenderSystem::Update()
     {
 
-        const auto &entities = m_entities.Data();
+        auto view = m_ecs.View<TransformComponent, MaterialComponent, CubeRendererComponent, BoxColliderComponent>(m_entities.Data());
 
-        for (const EntityID id : entities)
+        for (const EntityID id : view.Entities())
         {
-            TransformComponent *transform = m_ecs.GetComponent<TransformComponent>(id);
-            MaterialComponent *matRenderer = m_ecs.GetComponent<MaterialComponent>(id);
-            if (!m_ecs.HasComponent<CubeRendererComponent>(id))
+            TransformComponent *transform = view.Get<TransformComponent>(id);
+            MaterialComponent *matRenderer = view.Get<MaterialComponent>(id);
+            if (!view.Get<CubeRendererComponent>(id))
                 continue;
             glm::mat4 model = transform->transformation;
-            if (m_ecs.HasComponent<BoxColliderComponent>(id))
+            if (BoxColliderComponent *box = view.Get<BoxColliderComponent>(id))
             {
                 // Base scale on this instead
-                BoxColliderComponent *box = m_ecs.GetComponent<BoxColliderComponent>(id);
 
                 glm::vec3 scale = transform->WorldTransformation.scale;
                 glm::vec3 size = box->box.size * scale;
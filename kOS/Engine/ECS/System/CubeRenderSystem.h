@@ -10,6 +10,8 @@ namespace ecs {
 
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, MaterialComponent, CubeRendererComponent, BoxColliderComponent>;
+        using WriteComponents = ComponentList<>;
         void Init() override;
         void Update() override;
 
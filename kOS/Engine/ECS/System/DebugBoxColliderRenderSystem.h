@@ -29,6 +29,8 @@ namespace ecs {
 
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, BoxColliderComponent>;
+        using WriteComponents = ComponentList<>;
         void Init() override;
         void Update() override;
 
@@ -8,6 +8,8 @@ namespace ecs {
     class DebugCapsuleColliderRenderSystem : public ISystem {
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, CapsuleColliderComponent>;
+        using WriteComponents = ComponentList<>;
         void Init() override;
         void Update() override;
         
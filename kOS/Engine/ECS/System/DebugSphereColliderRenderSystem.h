@@ -8,6 +8,8 @@ namespace ecs {
     class  DebugSphereColliderRenderSystem : public ISystem {
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, SphereColliderComponent>;
+        using WriteComponents = ComponentList<>;
         void Init() override;
         void Update() override;
 
@@ -38,12 +38,12 @@ namespace ecs {
 
 	void LightingSystem::Update()
 	{
-		const auto& entities = m_entities.Data();
+		auto view = m_ecs.View<TransformComponent, NameComponent, LightComponent>(m_entities.Data());
 
-		for (const EntityID id : entities) {
-			TransformComponent* transform = m_ecs.GetComponent<TransformComponent>(id);
-			NameComponent* nameComp = m_ecs.GetComponent<NameComponent>(id);
-			LightComponent* light = m_ecs.GetComponent<LightComponent>(id);
+		for (const EntityID id : view.Entities()) {
+			TransformComponent* transform = view.Get<TransformComponent>(id);
+			NameComponent* nameComp = view.Get<NameComponent>(id);
+			LightComponent* light = view.Get<LightComponent>(id);
 
 			//skip component not of the scene
 			if (nameComp->hide) continue;
@@ -37,6 +37,8 @@ namespace ecs {
 
 	public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, NameComponent, LightComponent>;
+        using WriteComponents = ComponentList<>;
 		void Init() override;
 		void Update() override;
 
@@ -40,37 +40,71 @@ namespace ecs {
 
     void MeshRenderSystem::Update(){
 
-        const auto& entities = m_entities.Data();
+        auto view = m_ecs.View<NameComponent, TransformComponent, MeshFilterComponent, MaterialComponent>(m_entities.Data());
+        std::vector<const PBRMaterial*>& materials = m_graphicsManager.gm_GetMeshMaterials();
 
-        for (const EntityID id : entities) {
-            NameComponent* nameComp = m_ecs.GetComponent<NameComponent>(id);
+        for (const EntityID id : view.Entities()) {
+            NameComponent* nameComp = view.Get<NameComponent>(id);
             if (nameComp->hide)continue;;
-            TransformComponent* transform = m_ecs.GetComponent<TransformComponent>(id);
-            MeshFilterComponent* meshFilter = m_ecs.GetComponent<MeshFilterComponent>(id);
-
-            if (m_ecs.HasComponent<MaterialComponent>(id)) {
-                MaterialComponent* matRenderer = m_ecs.GetComponent<MaterialComponent>(id);
-                //Initialize each material
-                std::shared_ptr<R_Model> mesh = m_resourceManager.GetResource<R_Model>(meshFilter->meshGUID);
-                std::vector<PBRMaterial>pbrTmpList;
+            TransformComponent* transform = view.Get<TransformComponent>(id);
+            MeshFilterComponent* meshFilter = view.Get<MeshFilterComponent>(id);
+
+            if (MaterialComponent* matRenderer = view.Get<MaterialComponent>(id)) {
+                //handles are looked up once and cached on the components, after that a frame only compares versions
+                if (meshFilter->cachedMeshGUID != meshFilter->meshGUID || !m_resourceManager.Resolve(meshFilter->cachedMeshHandle)) {
+                    meshFilter->cachedMeshGUID = meshFilter->meshGUID;
+                    meshFilter->cachedMeshHandle = m_resourceManager.GetHandle<R_Model>(meshFilter->meshGUID);
+                }
+                R_Model* mesh = m_resourceManager.Resolve(meshFilter->cachedMeshHandle);
+
                 if (!matRenderer->materialGUID.size())continue;;
-                for (utility::GUID guid : matRenderer->materialGUID) {
-                    std::shared_ptr<R_Material> mat = m_resourceManager.GetResource<R_Material>(guid);
-                    if (!mat)return;;
-                    //Initialize all materials in the list
-                    std::shared_ptr<R_Texture> diff = m_resourceManager.GetResource<R_Texture>(mat->md.diffuseMaterialGUID);
-                    std::shared_ptr<R_Texture> spec = m_resourceManager.GetResource<R_Texture>(mat->md.specularMaterialGUID);
-                    std::shared_ptr<R_Texture> norm = m_resourceManager.GetResource<R_Texture>(mat->md.normalMaterialGUID);
-                    std::shared_ptr<R_Texture> ao = m_resourceManager.GetResource<R_Texture>(mat->md.ambientOcclusionMaterialGUID);
-                    std::shared_ptr<R_Texture> rough = m_resourceManager.GetResource<R_Texture>(mat->md.roughnessMaterialGUID);
-                    pbrTmpList.push_back(PBRMaterial{ diff,spec,rough,ao,norm });
+                if (matRenderer->cachedMaterialGUID != matRenderer->materialGUID) {
+                    matRenderer->cachedMaterialGUID = matRenderer->materialGUID;
+                    matRenderer->cachedMaterialHandle.assign(matRenderer->materialGUID.size(), ResourceHandle<R_Material>{});
                 }
-                if (mesh)
-                    m_graphicsManager.gm_PushMeshData(MeshData{ mesh,std::make_shared<PBRMaterialList>(pbrTmpList,true), transform->transformation,id });
+
+                const size_t firstMaterial = materials.size();
+                for (size_t i = 0; i < matRenderer->materialGUID.size(); ++i) {
+                    ResourceHandle<R_Material>& handle = matRenderer->cachedMaterialHandle[i];
+                    R_Material* mat = m_resourceManager.Resolve(handle);
+                    if (!mat) {
+                        handle = m_resourceManager.GetHandle<R_Material>(matRenderer->materialGUID[i]);
+                        mat = m_resourceManager.Resolve(handle);
+                    }
+                    if (!mat) {
+                        materials.resize(firstMaterial);
+                        return;
+                    }
+                    materials.push_back(GetPBRMaterial(*mat));
+                }
+
+                //still loading, drawn once it is uploaded
+                if (mesh && mesh->IsReady())
+                    m_graphicsManager.gm_PushMeshData(MeshData{ mesh, static_cast<uint32_t>(firstMaterial), static_cast<uint32_t>(materials.size() - firstMaterial), transform->transformation, id });
+                else
+                    materials.resize(firstMaterial);
 
             }
             // Skip entities not in this scene or hidden
         }
     }
 
-}
\ No newline at end of file
+    const PBRMaterial* MeshRenderSystem::GetPBRMaterial(R_Material& material)
+    {
+        //the texture GUIDs are only known once the material is loaded, textures still loading draw as unbound
+        static const PBRMaterial s_placeholder{};
+        if (!material.IsReady()) return &s_placeholder;
+
+        if (!material.pbrMaterialBuilt) {
+            std::shared_ptr<R_Texture> diff = m_resourceManager.GetResourceAsync<R_Texture>(material.md.diffuseMaterialGUID);
+            std::shared_ptr<R_Texture> spec = m_resourceManager.GetResourceAsync<R_Texture>(material.md.specularMaterialGUID);
+            std::shared_ptr<R_Texture> norm = m_resourceManager.GetResourceAsync<R_Texture>(material.md.normalMaterialGUID);
+            std::shared_ptr<R_Texture> ao = m_resourceManager.GetResourceAsync<R_Texture>(material.md.ambientOcclusionMaterialGUID);
+            std::shared_ptr<R_Texture> rough = m_resourceManager.GetResourceAsync<R_Texture>(material.md.roughnessMaterialGUID);
+            material.pbrMaterial = PBRMaterial{ diff,spec,rough,ao,norm };
+            material.pbrMaterialBuilt = true;
+        }
+        return &material.pbrMaterial;
+    }
+
+}
@@ -12,6 +12,8 @@
              MeshRendererComponent.
            - Submits mesh draw calls to the rendering pipeline.
            - Supports material and texture binding for PBR rendering.
+           - Caches resource handles on the components, a frame
+             resolves them without hashing or refcounting.
 
 Copyright (C) 2025 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -32,10 +34,16 @@ namespace ecs {
 
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<NameComponent, TransformComponent>;
+        //the cached resource handles
+        using WriteComponents = ComponentList<MeshFilterComponent, MaterialComponent>;
         void Init() override;
         void Update() override;
 
         REFLECTABLE(MeshRenderSystem)
+
+    private:
+        const PBRMaterial* GetPBRMaterial(R_Material& material);
     };
 
 }
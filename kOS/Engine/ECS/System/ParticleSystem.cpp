@@ -2,6 +2,7 @@
 #include "ParticleSystem.h"
 #include "glm/glm.hpp"
 #include "Graphics/GraphicsManager.h"
+#include "Debugging/Profiler.h"
 
 
 namespace ecs {
@@ -206,63 +207,55 @@ namespace ecs {
             //===========================================
             //STEP 0: Update emitter
             //===========================================
-            std::chrono::duration<float> systemDuration{};
-            auto start = std::chrono::steady_clock::now();
-            UpdateEmitters(dt,id , particle, transform);
-            auto end = std::chrono::steady_clock::now();
-            systemDuration = (end - start);
-            //std::cout << "UpdateEmitter " << systemDuration.count() << std::endl;
+            {
+                KOS_PROFILE_SCOPE("ParticleSystem::UpdateEmitters");
+                UpdateEmitters(dt,id , particle, transform);
+            }
             // ==========================================
             // STEP 1: Update Lifetimes (modifies alive_Particles)
             // ==========================================
 
-            start = std::chrono::steady_clock::now();
-            UpdateParticleLifetimes(dt, particle, positions);
-            end = std::chrono::steady_clock::now();
-            systemDuration = (end - start);
-            //std::cout << "UpdateParticle " << systemDuration.count() << std::endl;
+            {
+                KOS_PROFILE_SCOPE("ParticleSystem::UpdateLifetimes");
+                UpdateParticleLifetimes(dt, particle, positions);
+            }
             // ==========================================
             // STEP 2: Sync Active Buffer to GPU
             // ==========================================
-            start = std::chrono::steady_clock::now();
-            SyncActiveBuffer(particle);
-            end = std::chrono::steady_clock::now();
-            systemDuration = (end - start);
-            //std::cout << "Active " << systemDuration.count() << std::endl;
+            {
+                KOS_PROFILE_SCOPE("ParticleSystem::SyncActiveBuffer");
+                SyncActiveBuffer(particle);
+            }
             // ==========================================
             // STEP 3: Sync Particle Data to Flex
             // ==========================================
-            start = std::chrono::steady_clock::now();
-            NvFlexSetParticles((NvFlexSolver*)particle->solver, (NvFlexBuffer*)particle->pointers[0], nullptr);
-            NvFlexSetVelocities((NvFlexSolver*)particle->solver, (NvFlexBuffer*)particle->pointers[1], nullptr);
-            end = std::chrono::steady_clock::now();
-            systemDuration = (end - start);
-            //std::cout << "Step 3 " << systemDuration.count() << std::endl;
+            {
+                KOS_PROFILE_SCOPE("ParticleSystem::SetFlexParticles");
+                NvFlexSetParticles((NvFlexSolver*)particle->solver, (NvFlexBuffer*)particle->pointers[0], nullptr);
+                NvFlexSetVelocities((NvFlexSolver*)particle->solver, (NvFlexBuffer*)particle->pointers[1], nullptr);
+            }
             // ==========================================
             // STEP 4: Run Flex Simulation
             // ==========================================
-            start = std::chrono::steady_clock::now();
-            NvFlexUpdateSolver((NvFlexSolver*)particle->solver, dt, 1, false);
-            end = std::chrono::steady_clock::now();
-            systemDuration = (end - start);
-            //std::cout << "Step 4 " << systemDuration.count() << std::endl;
+            {
+                KOS_PROFILE_SCOPE("ParticleSystem::UpdateSolver");
+                NvFlexUpdateSolver((NvFlexSolver*)particle->solver, dt, 1, false);
+            }
             // ==========================================
             // STEP 5: Retrieve Results
             // ==========================================
-            start = std::chrono::steady_clock::now();
-            NvFlexGetParticles((NvFlexSolver*)particle->solver, (NvFlexBuffer*)particle->pointers[0], nullptr);
-            end = std::chrono::steady_clock::now();
-            systemDuration = (end - start);
-            //std::cout << "Step 5 " << systemDuration.count() << std::endl;
+            {
+                KOS_PROFILE_SCOPE("ParticleSystem::GetFlexParticles");
+                NvFlexGetParticles((NvFlexSolver*)particle->solver, (NvFlexBuffer*)particle->pointers[0], nullptr);
+            }
             // ==========================================
             // STEP 6: Extract Positions for Rendering (OPTIMIZED)
             // ==========================================
             ParticleInstance sending;
-            start = std::chrono::steady_clock::now();
-            ExtractParticlePositionsOptimized(particle, sending.positions_Particle, positions);
-            end = std::chrono::steady_clock::now();
-            systemDuration = (end - start);
-            //std::cout << "Step 6 " << systemDuration.count() << std::endl;
+            {
+                KOS_PROFILE_SCOPE("ParticleSystem::ExtractInstances");
+                ExtractParticlePositionsOptimized(particle, sending.positions_Particle, positions);
+            }
             sending.color = particle->color;
             sending.scale = glm::vec3(particle->size);
             sending.rotate = particle->rotation;
@@ -20,168 +20,90 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Pathfinding/OctreeGrid.h"
 #include "Graphics/GraphicsManager.h"
 
-#include <random>
+#include "Pathfinding/PathQueryService.h"
 
 namespace ecs {
-	Octrees::Graph waypoints;
-	Octrees::Octree octree;
-
-
-	bool testing = true;
-
-	//float maxTimer = 3.f;
-	//float currentTimer = 0.f;
-
-	// REMOVE THIS AFTER M2
-	int currentPathCount = 0;
-	float proximityCheck = 0.1f;
+	namespace {
+		constexpr float OCTREE_MIN_NODE_SIZE = 2.f;
+		constexpr float PROXIMITY_CHECK = 0.1f;
+	}
 
 	void PathfindingSystem::Init() {
-		octree.InjectDependency(&m_ecs);
+		m_pathQueries = std::make_shared<Octrees::PathQueryService>(m_ecs.GetJobSystem());
+
+		onDeregister.Add([this](EntityID id) {
+			if (m_pathQueries) m_pathQueries->RemoveAgent(id);
+		});
 	}
 
 	void PathfindingSystem::Update() {
-		// Creating octree
-		//const auto& entities = m_entities.Data();
-
-		//EntityID pathfinderTargetID = 9999999;
-		//std::vector<EntityID> pathfindersID;
-
-		//for (EntityID id : entities) {
-		//	if (auto* octreeGenerator = m_ecs.GetComponent<OctreeGeneratorComponent>(id)) {
-		//		// Creating the Octree
-		//		if (testing) {
-		//			octree = Octrees::Octree(2.f, waypoints, &m_ecs);
-		//			testing = false;
-		//		}
-
-		//		// Drawing the Octree
-		//		if (octreeGenerator->drawWireframe) {
-		//			if (octreeGenerator->drawBound) octree.root.DrawNode(&m_graphicsManager);
-		//			if (octreeGenerator->drawNodes) octree.graph.DrawGraph(&m_graphicsManager);
-		//		}
-
-		//		continue;
-		//	}
-		//	else if (auto* pathfinderTarget = m_ecs.GetComponent<PathfinderTargetComponent>(id)) {
-		//		pathfinderTargetID = id;
-		//		continue;
-		//	}
-		//	else if (auto* pathfinder = m_ecs.GetComponent<PathfinderComponent>(id)) {
-		//		pathfindersID.push_back(id);
-		//		continue;
-		//	}
-		//}
-
-		//if (m_ecs.GetState() != GAMESTATE::RUNNING || pathfinderTargetID == 9999999 || pathfindersID.empty()) {
-		//	return;
-		//}
-
-		//Octrees::OctreeNode closestNodeFrom;
-		//Octrees::OctreeNode closestNodeTarget = octree.FindClosestNode(m_ecs.GetComponent<TransformComponent>(pathfinderTargetID)->LocalTransformation.position);
-
-		//for (EntityID pathfinder : pathfindersID) {
-		//	auto* pathfinderComp = m_ecs.GetComponent<PathfinderComponent>(pathfinder);
-		//	auto* pathfinderTrans = m_ecs.GetComponent<TransformComponent>(pathfinder);
-		//	if (pathfinderComp->pathfinderCurrentTimer >= pathfinderComp->pathfinderMaxTimer) {
-		//		closestNodeFrom = octree.FindClosestNode(pathfinderTrans->LocalTransformation.position);
-
-		//		// THIS PART IS NOT FOR MULTIPLE PATHFINDERS
-		//		octree.graph.AStar(&closestNodeFrom, &closestNodeTarget);
-		//		currentPathCount = 0;
-		//		//
-
-		//		pathfinderComp->pathfinderCurrentTimer = 0.f;
-		//	}
-
-		//	//if (octree.graph.pathList.size() && currentPathCount < octree.graph.pathList.size()) {
-		//	//	
-		//	//	glm::vec3 direction = octree.graph.pathList[currentPathCount].octreeNode.bounds.center - pathfinderTrans->WorldTransformation.position;
-		//	//	direction = glm::normalize(direction);
-
-		//	//	pathfinderTrans->LocalTransformation.position += direction * pathfinderComp->pathfinderMovementSpeed * m_ecs.m_GetDeltaTime();
-		//	//	if (glm::distance(pathfinderTrans->WorldTransformation.position, octree.graph.pathList[currentPathCount].octreeNode.bounds.center) <= proximityCheck) {
-		//	//		++currentPathCount;
-		//	//	}
-		//	//}
-
-		//	if (pathfinderComp->pathfinderCurrentTimer < pathfinderComp->pathfinderMaxTimer) {
-		//		pathfinderComp->pathfinderCurrentTimer += m_ecs.m_GetDeltaTime();
-		//	}
-		//}
-
-
-
-
-
-
-
-		//const auto& entities = m_entities.Data();
-		//for (EntityID id : entities) {
-		//	TransformComponent* trans = m_ecs.GetComponent<TransformComponent>(id);
-		//	NameComponent* name = m_ecs.GetComponent<NameComponent>(id);
-		//	//OctreeGeneratorComponent* oct = m_ecs.GetComponent<OctreeGeneratorComponent>(id);
-
-		//	if (name->hide) { continue; }
-
-		//	// Move all pathfinders
-		//	//const auto& otherEntities = m_entities.Data();
-		//	//for (EntityID otherId : otherEntities) {
-		//	//	if (m_ecs.GetState() != GAMESTATE::RUNNING) {
-		//	//		continue;
-		//	//	}
-
-		//	//	auto* pathfinderTarget = m_ecs.GetComponent<PathfinderTargetComponent>(otherId);
-		//	//	auto* pathfinderComp = m_ecs.GetComponent<PathfinderComponent>(id);
-		//	//	auto* pathfinderTrans = m_ecs.GetComponent<TransformComponent>(id);
-		//	//	auto* pathfinderTargetTrans = m_ecs.GetComponent<TransformComponent>(otherId);
-
-		//	//	Octrees::OctreeNode closestNodeFrom;
-		//	//	Octrees::OctreeNode closestNodeTarget;
-
-		//	//	if (!pathfinderTarget || !pathfinderComp || !pathfinderTrans || !pathfinderTargetTrans || !pathfinderComp->chase) {
-		//	//		continue;
-		//	//	}
-
-		//	//	if (currentTimer >= maxTimer) {
-		//	//		closestNodeFrom = octree.FindClosestNode(pathfinderTrans->LocalTransformation.position);
-		//	//		closestNodeTarget = octree.FindClosestNode(pathfinderTargetTrans->LocalTransformation.position);
-		//	//		octree.graph.AStar(&closestNodeFrom, &closestNodeTarget);
-		//	//		currentPathCount = 0;
-
-		//	//		currentTimer = 0.f;
-		//	//	}
-
-		//	//	if (octree.graph.pathList.size() && currentPathCount < octree.graph.pathList.size()) {
-		//	//		glm::vec3 direction = octree.graph.pathList[currentPathCount].octreeNode.bounds.center - pathfinderTrans->WorldTransformation.position;
-		//	//		direction = glm::normalize(direction);
-
-		//	//		pathfinderTrans->LocalTransformation.position += direction * pathfinderComp->pathfinderMovementSpeed * m_ecs.m_GetDeltaTime();
-		//	//		if (glm::distance(pathfinderTrans->WorldTransformation.position, octree.graph.pathList[currentPathCount].octreeNode.bounds.center) <= proximityCheck) {
-		//	//			++currentPathCount;
-		//	//		}
-		//	//	}
-		//	//	else {
-		//	//		if (closestNodeFrom == closestNodeTarget) {
-
-		//	//		}
-		//	//	}
-
-		//	//	break;
-		//	//}
-
-		//	// Octree creation and drawing
-		//	if (auto* oct = m_ecs.GetComponent<OctreeGeneratorComponent>(id)) {
-		//		if (testing) { // this wont work with DI
-		//			octree = Octrees::Octree(2.f, waypoints, &m_ecs);
-		//			testing = false;
-		//		}
-
-		//		if (oct->drawWireframe) {
-		//			if (oct->drawBound) octree.root.DrawNode(&m_graphicsManager);
-		//			if (oct->drawNodes) octree.graph.DrawGraph(&m_graphicsManager);
-		//		}
-		//	}
-		//}
+		// Creating and drawing the octree
+		m_ecs.View<OctreeGeneratorComponent>().Each([&](EntityID id, OctreeGeneratorComponent& octreeGenerator) {
+			if (!HasEntity(id)) return;
+
+			if (!m_octree) {
+				m_octree = std::make_shared<Octrees::Octree>(OCTREE_MIN_NODE_SIZE, Octrees::Graph{}, &m_ecs);
+				m_pathQueries->SetGraph(m_octree);
+			}
+
+			if (octreeGenerator.drawWireframe) {
+				if (octreeGenerator.drawBound) m_octree->root.DrawNode(&m_graphicsManager);
+				if (octreeGenerator.drawNodes) m_octree->graph.DrawGraph(&m_graphicsManager);
+			}
+		});
+
+		if (m_ecs.GetState() != GAMESTATE::RUNNING || !m_octree) {
+			return;
+		}
+
+		std::vector<glm::vec3> targets;
+		m_ecs.View<PathfinderTargetComponent, TransformComponent>().Each([&](EntityID id, PathfinderTargetComponent&, TransformComponent& transform) {
+			if (HasEntity(id)) targets.push_back(transform.WorldTransformation.position);
+		});
+
+		if (targets.empty()) {
+			return;
+		}
+
+		const float deltaTime = m_ecs.m_GetDeltaTime();
+		m_ecs.View<PathfinderComponent, TransformComponent>().Each([&](EntityID id, PathfinderComponent& pathfinder, TransformComponent& transform) {
+			if (!HasEntity(id) || !pathfinder.chase) return;
+
+			const glm::vec3 position = transform.WorldTransformation.position;
+
+			// Repath to the closest target, agents sharing a target are searched together
+			if (pathfinder.pathfinderCurrentTimer >= pathfinder.pathfinderMaxTimer) {
+				const glm::vec3 target = *std::min_element(targets.begin(), targets.end(), [&](const glm::vec3& a, const glm::vec3& b) {
+					return glm::distance2(a, position) < glm::distance2(b, position);
+				});
+				m_pathQueries->Request(id, position, target);
+				pathfinder.pathfinderCurrentTimer = 0.f;
+			}
+			else {
+				pathfinder.pathfinderCurrentTimer += deltaTime;
+			}
+
+			const Octrees::PathBuffer* path = m_pathQueries->GetPath(id);
+			if (!path || !path->found) return;
+
+			if (pathfinder.pathVersion != path->version) {
+				pathfinder.pathVersion = path->version;
+				pathfinder.pathIndex = 0;
+			}
+
+			if (pathfinder.pathIndex >= path->points.size()) return;
+
+			const glm::vec3 waypoint = path->points[pathfinder.pathIndex];
+			const glm::vec3 offset = waypoint - position;
+			if (glm::length(offset) <= PROXIMITY_CHECK) {
+				++pathfinder.pathIndex;
+				return;
+			}
+
+			transform.LocalTransformation.position += glm::normalize(offset) * pathfinder.pathfinderMovementSpeed * deltaTime;
+		});
+
+		//results from earlier frames are published, new searches start within the frame budget
+		m_pathQueries->Update();
 	}
-}
\ No newline at end of file
+}
@@ -22,6 +22,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "System.h"
 
 
+namespace Octrees {
+	struct Octree;
+	class PathQueryService;
+}
+
 namespace ecs {
 	class PathfindingSystem : public ISystem {
 
@@ -31,7 +36,15 @@ namespace ecs {
 		
 		void Init() override;
 		void Update() override;
+
+		Octrees::PathQueryService* GetPathQueries() { return m_pathQueries.get(); }
+
 		REFLECTABLE(PathfindingSystem)
+
+	private:
+		//graph snapshot shared with the path query jobs
+		std::shared_ptr<Octrees::Octree> m_octree;
+		std::shared_ptr<Octrees::PathQueryService> m_pathQueries;
 	};
 }
 
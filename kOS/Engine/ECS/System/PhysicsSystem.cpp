@@ -10,11 +10,23 @@ namespace ecs {
         m_physicsManager.Init();
     }
 
-    void PhysicsSystem::Update() {
-
+    namespace {
+        //the ECS keeps rotations as euler degrees, a round trip through them is not exact
+        constexpr float POSITION_EPSILON = 1e-4f;
+        constexpr float ROTATION_EPSILON = 1e-6f;
+
+        bool PoseChanged(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& syncedPosition, const glm::quat& syncedRotation) {
+            if (glm::any(glm::greaterThan(glm::abs(position - syncedPosition), glm::vec3{ POSITION_EPSILON }))) { return true; }
+            return std::abs(glm::dot(rotation, syncedRotation)) < 1.f - ROTATION_EPSILON;
+        }
+    }
 
+    void PhysicsSystem::Update() {
         const auto& entities = m_entities.Data();
+        m_pushedCount = 0;
+        m_readbackCount = 0;
 
+        //only bodies moved in the ECS since they were last synced are pushed, a teleport wakes the actor
         for (EntityID id : entities) {
             auto* rb = m_ecs.GetComponent<RigidbodyComponent>(id);
             auto* trans = m_ecs.GetComponent<TransformComponent>(id);
@@ -22,33 +34,54 @@ namespace ecs {
 
             if (name->hide || !rb->actor) { continue; }
 
-            PxRigidDynamic* actor = static_cast<PxRigidDynamic*>(rb->actor);
+            if (id >= m_syncedPoses.size()) { m_syncedPoses.resize(id + 1); }
+            SyncedPose& synced = m_syncedPoses[id];
+
+            const glm::vec3 pos = trans->WorldTransformation.position;
+            const glm::quat rot = glm::quat(glm::radians(trans->WorldTransformation.rotation));
+            if (synced.actor == rb->actor && !PoseChanged(pos, rot, synced.position, synced.rotation)) { continue; }
 
-            glm::vec3 pos = trans->WorldTransformation.position;
-            glm::quat rot = glm::quat(glm::radians(trans->WorldTransformation.rotation));
+            PxRigidDynamic* actor = static_cast<PxRigidDynamic*>(rb->actor);
             PxTransform pxTrans{ PxVec3{ pos.x, pos.y, pos.z }, PxQuat{ rot.x, rot.y, rot.z, rot.w } };
 
             if (rb->isKinematic) { actor->setKinematicTarget(pxTrans); }
             else { actor->setGlobalPose(pxTrans); }
+
+            synced = SyncedPose{ rb->actor, pos, rot };
+            ++m_pushedCount;
         }
 
         m_physicsManager.Update(m_ecs.m_GetDeltaTime());
+        //queries queued last frame see this step's poses
+        m_physicsManager.ExecuteSceneQueries(&m_ecs.GetJobSystem());
+
+        //sleeping and static actors are never listed, so resting bodies cost nothing here
+        for (PxActor* activeActor : m_physicsManager.GetActiveActors()) {
+            PxRigidDynamic* actor = activeActor->is<PxRigidDynamic>();
+            if (!actor) { continue; }
+
+            const EntityID id = ToEntityID(actor);
+            if (!HasEntity(id)) { continue; }
 
-        for (EntityID id : entities) {
             auto* rb = m_ecs.GetComponent<RigidbodyComponent>(id);
             auto* trans = m_ecs.GetComponent<TransformComponent>(id);
             auto* name = m_ecs.GetComponent<NameComponent>(id);
 
-            if (name->hide || !rb->actor) { continue; }
+            //character controllers share the id but own a different actor
+            if (name->hide || rb->actor != actor || rb->isKinematic) { continue; }
+
+            if (id >= m_syncedPoses.size()) { m_syncedPoses.resize(id + 1); }
+            SyncedPose& synced = m_syncedPoses[id];
 
-            PxRigidActor* actor = static_cast<PxRigidActor*>(rb->actor);
+            const PxTransform pxTrans = actor->getGlobalPose();
+            const glm::vec3 pos{ pxTrans.p.x, pxTrans.p.y, pxTrans.p.z };
+            const glm::quat rot{ pxTrans.q.w, pxTrans.q.x, pxTrans.q.y, pxTrans.q.z };
+            //an actor moved by several steps is listed once per step
+            if (synced.actor == rb->actor && !PoseChanged(pos, rot, synced.position, synced.rotation)) { continue; }
 
-            if (!rb->isKinematic) {
-                PxTransform pxTrans = actor->getGlobalPose();
-                TransformSystem::SetImmediateWorldPosition(m_ecs, trans, glm::vec3{ pxTrans.p.x, pxTrans.p.y, pxTrans.p.z });
-                glm::quat q{ pxTrans.q.w, pxTrans.q.x, pxTrans.q.y, pxTrans.q.z };
-                TransformSystem::SetImmediateWorldRotation(m_ecs, trans, glm::degrees(glm::eulerAngles(q)));
-            }
+            TransformSystem::SetImmediateWorldPose(m_ecs, trans, pos, glm::degrees(glm::eulerAngles(rot)));
+            synced = SyncedPose{ rb->actor, pos, rot };
+            ++m_readbackCount;
         }
     }
 }
\ No newline at end of file
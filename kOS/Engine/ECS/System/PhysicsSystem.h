@@ -8,9 +8,27 @@ namespace ecs {
 	class PhysicsSystem : public ISystem {
 	public:
 		using ISystem::ISystem;
+		//the fixed step runs the scripts' FixedUpdate, which can touch any component
+		using WriteComponents = AllComponents;
 		void Init() override;
 		void Update() override;
+
+		//bodies whose pose was pushed to PhysX and read back in the last update
+		size_t GetPushedCount() const { return m_pushedCount; }
+		size_t GetReadbackCount() const { return m_readbackCount; }
 		REFLECTABLE(PhysicsSystem)
+
+	private:
+		//pose last pushed to or read back from the actor
+		struct SyncedPose {
+			void* actor{ nullptr };
+			glm::vec3 position{};
+			glm::quat rotation{ 1.f, 0.f, 0.f, 0.f };
+		};
+
+		std::vector<SyncedPose> m_syncedPoses;     // indexed by entity id
+		size_t m_pushedCount{};
+		size_t m_readbackCount{};
 	};
 }
 
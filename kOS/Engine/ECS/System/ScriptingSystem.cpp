@@ -1,4 +1,3 @@
-
 #include "Config/pch.h"
 #include "ECS/ECS.h"
 #include "ScriptingSystem.h"
@@ -6,61 +5,169 @@
 #include "ECS/Component/ScriptComponent.h"
 #include "Resources/ResourceManager.h"
 #include "Debugging/Performance.h"
+#include "Debugging/Profiler.h"
 
 namespace ecs {
 
-
+	//job script instances per chunk
+	constexpr size_t SCRIPT_JOB_GRAIN_SIZE = 64;
 
 	void ScriptingSystem::Init()
 	{
 		
 		//Use The DLL
+		if (!m_fixedUpdateID) {
+			m_fixedUpdateID = m_physicsManager.onFixedUpdate.Add([this, lifetime = std::weak_ptr<bool>(m_lifetime)]() {
+				if (!lifetime.expired()) FixedUpdate();
+			});
+		}
 	}
 
-	void ScriptingSystem::Update()
+	void ScriptingSystem::BuildScriptPools()
 	{
+		const auto& scriptList = m_scriptManager.GetScriptList();
+		const auto& componentKeys = m_ecs.GetComponentKeyData();
 
-		const auto& entities = m_entities.Data();
-		
-		auto scriptList = m_scriptManager.GetScriptList();
+		m_scriptPools.clear();
 		for (const std::string& scriptName : scriptList) {
+			const auto keyIt = componentKeys.find(scriptName);
+			if (keyIt == componentKeys.end()) continue;
+			m_scriptPools.push_back(ScriptPool{ keyIt->second, &m_performance.GetScriptValue(scriptName) });
+		}
+		m_builtScriptList = scriptList;
+	}
 
-			std::chrono::duration<float> scriptDuration{};
-			auto start = std::chrono::steady_clock::now();
+	void ScriptingSystem::MarkActiveEntities()
+	{
+		std::fill(m_activeEntities.begin(), m_activeEntities.end(), uint8_t{ 0 });
+		for (const auto& [sceneName, sceneData] : m_ecs.sceneMap) {
+			if (!sceneData.isActive) continue;
+			for (const EntityID id : sceneData.sceneIDs) {
+				if (static_cast<size_t>(id) >= m_activeEntities.size()) {
+					m_activeEntities.resize(static_cast<size_t>(id) + 1);
+				}
+				m_activeEntities[id] = 1;
+			}
+		}
+	}
+
+	bool ScriptingSystem::IsRunnable(EntityID id)
+	{
+		//left every system, eg. a pooled prefab instance
+		if (!HasEntity(id)) return false;
+		//spawned this frame or in an inactive scene
+		return static_cast<size_t>(id) < m_activeEntities.size() && m_activeEntities[id];
+	}
+
+	void ScriptingSystem::Update()
+	{
+		//a hot reload unloads and re-registers the scripts, component keys stay the same
+		if (m_builtScriptList != m_scriptManager.GetScriptList()) {
+			BuildScriptPools();
+		}
+		MarkActiveEntities();
+
+		RunScripts(ScriptPhase::UPDATE);
+	}
+
+	void ScriptingSystem::LateUpdate()
+	{
+		KOS_PROFILE_SCOPE("ScriptingSystem::LateUpdate");
+		RunScripts(ScriptPhase::LATE_UPDATE);
+	}
 
-			auto action = m_ecs.componentAction.at(scriptName);
+	void ScriptingSystem::FixedUpdate()
+	{
+		KOS_PROFILE_SCOPE("ScriptingSystem::FixedUpdate");
+		//physics steps before the scripts update on the first frame
+		if (m_builtScriptList != m_scriptManager.GetScriptList()) {
+			BuildScriptPools();
+		}
+		MarkActiveEntities();
+
+		RunScripts(ScriptPhase::FIXED_UPDATE);
+	}
+
+	void ScriptingSystem::RunScripts(ScriptPhase phase)
+	{
+		for (const ScriptPool& script : m_scriptPools) {
+			ISparseSet* scriptPool = m_ecs.GetComponentPool(script.key);
+			if (!scriptPool || scriptPool->GetEntityList().empty()) continue;
+
+			auto start = std::chrono::steady_clock::now();
 			try {
-				auto& entityList = m_ecs.GetComponentsEnties(scriptName);
-				for (const EntityID id : entityList) {
+				const auto& entityList = scriptPool->GetEntityList();
+				if (phase == ScriptPhase::UPDATE && static_cast<ScriptClass*>(scriptPool->GetBase(entityList.front()))->IsJob()) {
+					RunJobScript(*scriptPool);
+				}
+				else {
+					//indexed, a script may spawn entities with the same script and grow the list
+					for (size_t i = 0; i < entityList.size(); ++i) {
+						const EntityID id = entityList[i];
+						if (!IsRunnable(id)) continue;
 
-					//TODO - find better way to go about this
-					SceneData sceneData = m_ecs.GetSceneData(m_ecs.GetSceneByEntityID(id));
-					if (!sceneData.isActive) continue;
+						auto* scriptClass = static_cast<ScriptClass*>(scriptPool->GetBase(id));
 
-					auto script = static_cast<ScriptClass*>(m_ecs.GetIComponent<void*>(scriptName, id));
+						if (!scriptClass->isStart) {
+							scriptClass->isStart = true;
+							scriptClass->Start();
 
-					if (!script->isStart) {
-						script->isStart = true;
-						script->Start();
-						
-					}
+						}
 
-					script->Update();
+						switch (phase) {
+						case ScriptPhase::FIXED_UPDATE: scriptClass->FixedUpdate(); break;
+						case ScriptPhase::UPDATE: scriptClass->Update(); break;
+						case ScriptPhase::LATE_UPDATE: scriptClass->LateUpdate(); break;
+						}
+					}
 				}
 			}
 			catch (...) {
 				continue;
 			}
-			auto end = std::chrono::steady_clock::now();
-			scriptDuration = (end - start);
-			m_performance.SetScriptValue(scriptName, scriptDuration.count());
-			
-		}
-		
 
+			//the fixed steps run before Update resets the time, late update adds on to it
+			const float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+			if (phase == ScriptPhase::UPDATE) *script.time = elapsed;
+			else if (phase == ScriptPhase::LATE_UPDATE) *script.time += elapsed;
+		}
+	}
 
+	void ScriptingSystem::RunJobScript(ISparseSet& scriptPool)
+	{
+		//Start may spawn or delete entities, it stays on the main thread
+		m_jobScripts.clear();
+		const auto& entityList = scriptPool.GetEntityList();
+		for (size_t i = 0; i < entityList.size(); ++i) {
+			const EntityID id = entityList[i];
+			if (!IsRunnable(id)) continue;
+
+			auto* scriptClass = static_cast<ScriptClass*>(scriptPool.GetBase(id));
+			if (!scriptClass->isStart) {
+				scriptClass->isStart = true;
+				scriptClass->Start();
+			}
+			m_jobScripts.push_back(scriptClass);
+		}
+		if (m_jobScripts.empty()) return;
 
+		m_jobScripts.front()->PrepareJob();
 
+		//nothing else runs while the scripts do, the chunks only share components they read
+		std::atomic<bool> failed{ false };
+		m_ecs.GetJobSystem().ParallelFor(m_jobScripts.size(), SCRIPT_JOB_GRAIN_SIZE, [&](size_t begin, size_t end) {
+			try {
+				for (size_t i = begin; i < end; ++i) {
+					m_jobScripts[i]->Update();
+				}
+			}
+			catch (...) {
+				failed = true;
+			}
+		});
+		if (failed) {
+			LOGGING_ERROR("Job script threw during Update");
+		}
 	}
 
 
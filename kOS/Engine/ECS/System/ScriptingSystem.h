@@ -13,12 +13,44 @@ namespace ecs {
 
 	public:
 		using ISystem::ISystem;
+		//scripts can touch any component
+		using WriteComponents = AllComponents;
 
 		void Init() override;
 		void Update() override;
+		void LateUpdate() override;
+		//called by the physics fixed step, once per step simulated this frame
+		void FixedUpdate();
 
 		REFLECTABLE(ScriptingSystem)
 	private:
+		enum class ScriptPhase {
+			FIXED_UPDATE,
+			UPDATE,
+			LATE_UPDATE
+		};
+
+		//component key and timing entry of each script, resolved when the script list changes
+		struct ScriptPool {
+			size_t key{};
+			float* time{};
+		};
+
+		void BuildScriptPools();
+		void MarkActiveEntities();
+		void RunScripts(ScriptPhase phase);
+		//Update of a job script, split across the workers
+		void RunJobScript(ISparseSet& scriptPool);
+		bool IsRunnable(EntityID id);
+
+		std::vector<std::string> m_builtScriptList;
+		std::vector<ScriptPool> m_scriptPools;
+		//indexed by entity id, 1 when the entity's scene is active this frame
+		std::vector<uint8_t> m_activeEntities;
+		std::vector<ScriptClass*> m_jobScripts;
+		Delegate<>::ID m_fixedUpdateID{};
+		//the physics manager may outlive the system, its callback checks this first
+		std::shared_ptr<bool> m_lifetime{ std::make_shared<bool>(true) };
 	};
 }
 
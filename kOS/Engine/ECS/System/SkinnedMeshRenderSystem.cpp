@@ -39,14 +39,14 @@ namespace ecs
     void SkinnedMeshRenderSystem::Update()
     {
 
-        const auto &entities = m_entities.Data();
+        auto view = m_ecs.View<TransformComponent, NameComponent, SkinnedMeshRendererComponent, AnimatorComponent>(m_entities.Data());
 
-        for (const EntityID id : entities)
+        for (const EntityID id : view.Entities())
         {
-            TransformComponent *transform = m_ecs.GetComponent<TransformComponent>(id);
-            NameComponent *nameComp = m_ecs.GetComponent<NameComponent>(id);
-            SkinnedMeshRendererComponent *skinnedMesh = m_ecs.GetComponent<SkinnedMeshRendererComponent>(id);
-            AnimatorComponent *anim = m_ecs.GetComponent<AnimatorComponent>(id);
+            TransformComponent *transform = view.Get<TransformComponent>(id);
+            NameComponent *nameComp = view.Get<NameComponent>(id);
+            SkinnedMeshRendererComponent *skinnedMesh = view.Get<SkinnedMeshRendererComponent>(id);
+            AnimatorComponent *anim = view.Get<AnimatorComponent>(id);
             // Skip entities not in this scene or hidden
             if (nameComp->hide)
                 continue;
@@ -59,23 +59,29 @@ namespace ecs
                 skinnedMesh->cachedSkinnedMeshGUID = skinnedMesh->skinnedMeshGUID;
                 skinnedMesh->cachedSkinnedMeshResource = static_cast<void *>(mesh);
 
-                std::shared_ptr<R_Material> mat = m_resourceManager.GetResource<R_Material>(skinnedMesh->materialGUID);
+                //resources still loading are placeholders, the mesh is drawn once it is uploaded
+                std::shared_ptr<R_Material> mat = m_resourceManager.GetResourceAsync<R_Material>(skinnedMesh->materialGUID);
                 if (!mat)
                     return;
                 ;
-                skeleton = m_resourceManager.GetResource<R_Animation>(skinnedMesh->skeletonGUID).get();
-                mesh = m_resourceManager.GetResource<R_Model>(skinnedMesh->skinnedMeshGUID).get();
+                std::shared_ptr<R_Animation> skeletonResource = m_resourceManager.GetResourceAsync<R_Animation>(skinnedMesh->skeletonGUID);
+                std::shared_ptr<R_Model> meshResource = m_resourceManager.GetResourceAsync<R_Model>(skinnedMesh->skinnedMeshGUID);
+                skeleton = (skeletonResource && skeletonResource->IsReady()) ? skeletonResource.get() : nullptr;
+                mesh = (meshResource && meshResource->IsReady()) ? meshResource.get() : nullptr;
 
                 if (skeleton && anim->m_IsPlaying)
                 {
                     anim->m_CurrentTime += skeleton->GetTicksPerSecond() * m_ecs.m_GetDeltaTime() * anim->m_PlaybackSpeed;
                     anim->m_CurrentTime = fmod(anim->m_CurrentTime, skeleton->GetDuration());
                 }
-                std::shared_ptr<R_Texture> diff = m_resourceManager.GetResource<R_Texture>(mat->md.diffuseMaterialGUID);
-                std::shared_ptr<R_Texture> spec = m_resourceManager.GetResource<R_Texture>(mat->md.specularMaterialGUID);
-                std::shared_ptr<R_Texture> norm = m_resourceManager.GetResource<R_Texture>(mat->md.normalMaterialGUID);
-                std::shared_ptr<R_Texture> ao = m_resourceManager.GetResource<R_Texture>(mat->md.ambientOcclusionMaterialGUID);
-                std::shared_ptr<R_Texture> rough = m_resourceManager.GetResource<R_Texture>(mat->md.roughnessMaterialGUID);
+                std::shared_ptr<R_Texture> diff, spec, norm, ao, rough;
+                if (mat->IsReady()) {
+                    diff = m_resourceManager.GetResourceAsync<R_Texture>(mat->md.diffuseMaterialGUID);
+                    spec = m_resourceManager.GetResourceAsync<R_Texture>(mat->md.specularMaterialGUID);
+                    norm = m_resourceManager.GetResourceAsync<R_Texture>(mat->md.normalMaterialGUID);
+                    ao = m_resourceManager.GetResourceAsync<R_Texture>(mat->md.ambientOcclusionMaterialGUID);
+                    rough = m_resourceManager.GetResourceAsync<R_Texture>(mat->md.roughnessMaterialGUID);
+                }
 
                 // std::shared_ptr<R_Texture> diff = m_resourceManager.GetResource<R_Texture>(skinnedMesh->diffuseMaterialGUID);
                 // std::shared_ptr<R_Texture> spec = m_resourceManager.GetResource<R_Texture>(skinnedMesh->specularMaterialGUID);
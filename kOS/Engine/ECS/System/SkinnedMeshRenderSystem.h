@@ -31,6 +31,8 @@ namespace ecs {
 
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, NameComponent, SkinnedMeshRendererComponent, AnimatorComponent>;
+        using WriteComponents = ComponentList<>;
         void Init() override;
         void Update() override;
 
@@ -15,16 +15,15 @@ namespace ecs {
 
     void SphereRenderSystem::Update()
     {
-        const auto& entities = m_entities.Data();
+        auto view = m_ecs.View<TransformComponent, MaterialComponent, SphereRendererComponent, SphereColliderComponent>(m_entities.Data());
 
-        for (const EntityID id : entities) {
-            TransformComponent* transform = m_ecs.GetComponent<TransformComponent>(id);
-            MaterialComponent* matRenderer = m_ecs.GetComponent<MaterialComponent>(id);
-            if (!m_ecs.HasComponent<SphereRendererComponent>(id))continue;
+        for (const EntityID id : view.Entities()) {
+            TransformComponent* transform = view.Get<TransformComponent>(id);
+            MaterialComponent* matRenderer = view.Get<MaterialComponent>(id);
+            if (!view.Get<SphereRendererComponent>(id))continue;
             glm::mat4 model = transform->transformation;
-            if (m_ecs.HasComponent<SphereColliderComponent>(id)) {
+            if (SphereColliderComponent* sphere = view.Get<SphereColliderComponent>(id)) {
                 //Base scale on this instead
-                SphereColliderComponent* sphere = m_ecs.GetComponent<SphereColliderComponent>(id);
 
                 glm::vec3 scale = transform->WorldTransformation.scale;
                 glm::vec3 size = sphere->sphere.radius* scale;
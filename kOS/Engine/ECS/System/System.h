@@ -69,15 +69,26 @@ namespace ecs {
 
 			if(!m_entities.ContainsEntity(ID)){
 				m_entities.Set(ID, ID);
+				++m_membershipVersion;
 				onRegister.Invoke(ID);
 			}
 		}
 
 		inline void DeregisterSystem(EntityID ID) {
 			m_entities.Delete(ID);
+			++m_membershipVersion;
 			onDeregister.Invoke(ID);
 		}
 
+		inline bool HasEntity(EntityID ID) {
+			return m_entities.ContainsEntity(ID);
+		}
+
+		//changes whenever an entity is registered/deregistered, for systems that cache data per entity set
+		uint32_t GetMembershipVersion() const {
+			return m_membershipVersion;
+		}
+
 		inline void SetState(const std::bitset<GAMESTATE_COUNT>& state) {
 			m_systemGameState = state;
 		}
@@ -90,8 +101,30 @@ namespace ecs {
 			return m_systemSignature;
 		}
 
+		//component access used by the scheduler to decide which systems can run concurrently
+		inline void AssignAccess(ComponentSignature read, ComponentSignature write, bool mainThread) {
+			m_readSignature = read;
+			m_writeSignature = write;
+			m_mainThread = mainThread;
+		}
+
+		ComponentSignature GetReadSignature() const {
+			return m_readSignature;
+		}
+
+		ComponentSignature GetWriteSignature() const {
+			return m_writeSignature;
+		}
+
+		// Worker systems must not create/delete entities or add/remove components
+		bool RunsOnMainThread() const {
+			return m_mainThread;
+		}
+
 		virtual void Init() = 0;
 		virtual void Update() = 0;
+		//runs on the main thread once every system of the frame has updated, eg. after transforms
+		virtual void LateUpdate() {}
 
 		Delegate<EntityID> onRegister;
 		Delegate<EntityID> onDeregister;
@@ -101,6 +134,10 @@ namespace ecs {
 		SparseSet<EntityID> m_entities;
 		ComponentSignature m_systemSignature; // set signature based on what component the systems need
 		std::bitset<GAMESTATE_COUNT> m_systemGameState;
+		ComponentSignature m_readSignature;
+		ComponentSignature m_writeSignature;
+		bool m_mainThread{ true };
+		uint32_t m_membershipVersion{};
 	};
 
 }
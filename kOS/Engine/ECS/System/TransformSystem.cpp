@@ -27,17 +27,125 @@ namespace ecs {
 
 	}
 
+	namespace {
+		//entities per job when the store is split across the job system
+		constexpr size_t TRANSFORM_GRAIN_SIZE = 256;
+	}
+
 	void TransformSystem::Update() {
-		const auto& entities = m_entities.Data();
-		for (const EntityID id : entities) {
-			TransformComponent* transformComp = m_ecs.GetComponent<TransformComponent>(id);
-			if (transformComp->m_haveParent) continue;
-
-			NameComponent* NameComp = m_ecs.GetComponent<NameComponent>(id);
-			if (NameComp->hide) continue;
-			
-			CalculateAllTransform(m_ecs, transformComp);
+		//rebuilt on parenting/entity changes, everything is recomputed once afterwards
+		if (!m_hierarchyBuilt
+			|| m_builtHierarchyVersion != m_ecs.GetHierarchyVersion()
+			|| m_builtMembershipVersion != GetMembershipVersion()) {
+			RebuildHierarchy();
+		}
+
+		m_updatedCount = 0;
+		if (m_store.Size() == 0) return;
+
+		//hidden roots skip their whole subtree, dirty flags stay set until the root is shown
+		SparseSet<NameComponent>* namePool = m_ecs.GetComponentPool<NameComponent>();
+		for (uint32_t root = m_store.LevelBegin(0); root < m_store.LevelEnd(0); ++root) {
+			const NameComponent* nameComp = namePool->Get(m_store.GetEntity(root));
+			m_rootActive[root] = nameComp && !nameComp->hide;
 		}
+
+		SparseSet<TransformComponent>* transformPool = m_ecs.GetComponentPool<TransformComponent>();
+		utility::JobSystem& jobSystem = m_ecs.GetJobSystem();
+
+		//sync changed local TRS from the components and compose their local matrices
+		jobSystem.ParallelFor(m_store.Size(), TRANSFORM_GRAIN_SIZE, [&](size_t begin, size_t end) {
+			std::array<uint32_t, TRANSFORM_GRAIN_SIZE> dirty;
+			size_t dirtyCount{};
+			for (uint32_t i = static_cast<uint32_t>(begin); i < end; ++i) {
+				if (!m_rootActive[m_store.GetRoot(i)]) continue;
+
+				const TransformComponent* transformComp = transformPool->Get(m_store.GetEntity(i));
+				if (transformComp && m_store.SyncLocal(i, transformComp->LocalTransformation)) {
+					m_store.SetLocalDirty(i, true);
+				}
+				if (m_store.IsLocalDirty(i)) dirty[dirtyCount++] = i;
+			}
+			m_store.ComposeLocal(dirty.data(), dirtyCount);
+		});
+
+		//world matrices, depth by depth. A parent pushes to its contiguous child range
+		jobSystem.ParallelFor(m_store.LevelEnd(0), TRANSFORM_GRAIN_SIZE, [&](size_t begin, size_t end) {
+			for (uint32_t root = static_cast<uint32_t>(begin); root < end; ++root) {
+				if (m_rootActive[root] && m_store.IsLocalDirty(root)) {
+					m_store.ComposeWorld(root);
+					m_store.SetWorldDirty(root, true);
+				}
+			}
+		});
+		for (size_t level = 0; level + 1 < m_store.LevelCount(); ++level) {
+			const uint32_t levelBegin = m_store.LevelBegin(level);
+			jobSystem.ParallelFor(m_store.LevelEnd(level) - levelBegin, TRANSFORM_GRAIN_SIZE, [&](size_t begin, size_t end) {
+				for (uint32_t parent = levelBegin + static_cast<uint32_t>(begin); parent < levelBegin + end; ++parent) {
+					if (!m_rootActive[m_store.GetRoot(parent)]) continue;
+
+					const bool parentChanged = m_store.IsWorldDirty(parent);
+					for (uint32_t child = m_store.ChildBegin(parent); child < m_store.ChildEnd(parent); ++child) {
+						if (parentChanged || m_store.IsLocalDirty(child)) {
+							m_store.ComposeWorld(child);
+							m_store.SetWorldDirty(child, true);
+						}
+					}
+				}
+			});
+		}
+
+		//write changed matrices back to the components, world TRS is only decomposed when the world matrix changed
+		jobSystem.ParallelFor(m_store.Size(), TRANSFORM_GRAIN_SIZE, [&](size_t begin, size_t end) {
+			size_t updated{};
+			for (uint32_t i = static_cast<uint32_t>(begin); i < end; ++i) {
+				if (!m_store.IsWorldDirty(i)) continue;
+
+				if (TransformComponent* transformComp = transformPool->Get(m_store.GetEntity(i))) {
+					transformComp->localTransform = m_store.GetLocal(i);
+					transformComp->transformation = m_store.GetWorld(i);
+					utility::DecomposeMtxIntoTRS(transformComp->transformation, transformComp->WorldTransformation.position, transformComp->WorldTransformation.rotation, transformComp->WorldTransformation.scale);
+					++updated;
+				}
+				m_store.SetLocalDirty(i, false);
+				m_store.SetWorldDirty(i, false);
+			}
+			m_updatedCount.fetch_add(updated, std::memory_order_relaxed);
+		});
+	}
+
+	void TransformSystem::RebuildHierarchy() {
+		m_store.Clear();
+
+		SparseSet<TransformComponent>* transformPool = m_ecs.GetComponentPool<TransformComponent>();
+		m_store.BeginLevel();
+		for (const EntityID id : m_entities.Data()) {
+			const TransformComponent* transformComp = transformPool->Get(id);
+			if (transformComp && !transformComp->m_haveParent) {
+				m_store.Push(id, TransformStore::INVALID_INDEX, TransformStore::INVALID_INDEX, transformComp->LocalTransformation);
+			}
+		}
+		m_rootActive.assign(m_store.Size(), 1);
+
+		//breadth first, children are only reachable from their parent
+		uint32_t levelBegin = 0;
+		uint32_t levelEnd = static_cast<uint32_t>(m_store.Size());
+		while (levelBegin < levelEnd) {
+			m_store.BeginLevel();
+			for (uint32_t parent = levelBegin; parent < levelEnd; ++parent) {
+				for (const EntityID childID : transformPool->Get(m_store.GetEntity(parent))->m_childID) {
+					if (const TransformComponent* child = transformPool->Get(childID)) {
+						m_store.Push(childID, parent, m_store.GetRoot(parent), child->LocalTransformation);
+					}
+				}
+			}
+			levelBegin = levelEnd;
+			levelEnd = static_cast<uint32_t>(m_store.Size());
+		}
+
+		m_builtHierarchyVersion = m_ecs.GetHierarchyVersion();
+		m_builtMembershipVersion = GetMembershipVersion();
+		m_hierarchyBuilt = true;
 	}
 
 	void TransformSystem::CalculateAllTransform(ECS& ecs, TransformComponent* transformComp, const glm::mat4& parentWorldMtx) {
@@ -121,6 +229,27 @@ namespace ecs {
 		}
 	}
 
+	void TransformSystem::SetImmediateWorldPose(ECS& ecs, TransformComponent* transformComp, const glm::vec3& pos, const glm::vec3& rot){
+		if (!transformComp) return;
+		constexpr glm::mat4 identity(1.0f);
+		transformComp->WorldTransformation.position = pos;
+		transformComp->WorldTransformation.rotation = rot;
+		transformComp->transformation = glm::translate(identity, transformComp->WorldTransformation.position) *
+										glm::mat4_cast(glm::quat(glm::radians(transformComp->WorldTransformation.rotation))) *
+										glm::scale(identity, transformComp->WorldTransformation.scale);
+
+		TransformComponent* parentTrans = ecs.GetComponent<TransformComponent>(transformComp->m_parentID);
+		if (parentTrans) {
+			transformComp->localTransform = glm::inverse(parentTrans->transformation) * transformComp->transformation;
+			utility::DecomposeMtxIntoTRS(transformComp->localTransform, transformComp->LocalTransformation.position, transformComp->LocalTransformation.rotation, transformComp->LocalTransformation.scale);
+		}
+		else {
+			transformComp->LocalTransformation.position = transformComp->WorldTransformation.position;
+			transformComp->LocalTransformation.rotation = transformComp->WorldTransformation.rotation;
+			transformComp->localTransform = transformComp->transformation;
+		}
+	}
+
 	void TransformSystem::SetImmediateLocalPosition(ECS& ecs, TransformComponent* transformComp, glm::vec3&& pos){
 		if (!transformComp) return;
 		transformComp->LocalTransformation.position = pos;
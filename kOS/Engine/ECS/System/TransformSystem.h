@@ -17,15 +17,21 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "System.h"
 #include "ECS/ECSList.h"
+#include "ECS/TransformStore.h"
 
 namespace ecs {
 
     class TransformSystem : public ISystem {
     public:
         using ISystem::ISystem;
+        using ReadComponents = ComponentList<TransformComponent, NameComponent>;
+        using WriteComponents = ComponentList<TransformComponent>;
         void Init() override;
         void Update() override;
 
+        //number of world matrices rebuilt in the last update
+        size_t GetUpdatedCount() const { return m_updatedCount.load(std::memory_order_relaxed); }
+
 
 
 		//TODO,find a better way of impelementing this
@@ -34,10 +40,22 @@ namespace ecs {
         static void SetImmediateWorldPosition(ECS& ecs, TransformComponent* transformComp, glm::vec3&& pos);
         static void SetImmediateWorldRotation(ECS& ecs, TransformComponent* transformComp, glm::vec3&& rot);
         static void SetImmediateWorldScale(ECS& ecs, TransformComponent* transformComp, glm::vec3&& scale);
+        //position and rotation together, the matrix is built and the parent inverted once
+        static void SetImmediateWorldPose(ECS& ecs, TransformComponent* transformComp, const glm::vec3& pos, const glm::vec3& rot);
         static void SetImmediateLocalPosition(ECS& ecs, TransformComponent* transformComp, glm::vec3&& pos);
         static void SetImmediateLocalRotation(ECS& ecs, TransformComponent* transformComp, glm::vec3&& rot);
         static void SetImmediateLocalScale(ECS& ecs, TransformComponent* transformComp, glm::vec3&& scale);
         REFLECTABLE(TransformSystem)
+
+    private:
+        void RebuildHierarchy();
+
+        TransformStore m_store;
+        std::vector<char> m_rootActive;     // indexed by root's store index
+        uint32_t m_builtHierarchyVersion{};
+        uint32_t m_builtMembershipVersion{};
+        bool m_hierarchyBuilt{ false };
+        std::atomic<size_t> m_updatedCount{ 0 };
     };
 
 }
@@ -0,0 +1,170 @@
+/******************************************************************/
+/*!
+\file      SystemScheduler.cpp
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   Builds and runs the per frame system dependency graph.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "SystemScheduler.h"
+#include "ECS/ECS.h"
+#include "Debugging/Profiler.h"
+
+namespace ecs {
+
+	bool SystemScheduler::Conflicts(const ISystem& first, const ISystem& second) {
+		const ComponentSignature firstAccess = first.GetReadSignature() | first.GetWriteSignature();
+		const ComponentSignature secondAccess = second.GetReadSignature() | second.GetWriteSignature();
+
+		return (first.GetWriteSignature() & secondAccess).any() || (second.GetWriteSignature() & firstAccess).any();
+	}
+
+	void SystemScheduler::Build(const std::vector<ISystem*>& systems) {
+		if (systems == m_builtSystems && m_nodes.size() == systems.size()) return;
+
+		m_builtSystems = systems;
+		m_nodes.assign(systems.size(), Node{});
+		m_timings.assign(systems.size(), SystemTiming{});
+		m_remainingDependencies = std::make_unique<std::atomic<size_t>[]>(systems.size());
+
+		size_t lastMainThread = systems.size();
+		for (size_t i = 0; i < systems.size(); ++i) {
+			m_nodes[i].system = systems[i];
+
+			for (size_t j = 0; j < i; ++j) {
+				//main thread systems are chained below, skip the duplicate edge
+				const bool chained = (j == lastMainThread) && systems[i]->RunsOnMainThread();
+				if (!chained && Conflicts(*systems[j], *systems[i])) {
+					m_nodes[j].dependents.push_back(i);
+					++m_nodes[i].dependencyCount;
+				}
+			}
+
+			//main thread systems keep their registration order (render push order, graphics/physics state)
+			if (systems[i]->RunsOnMainThread()) {
+				if (lastMainThread < systems.size()) {
+					m_nodes[lastMainThread].dependents.push_back(i);
+					++m_nodes[i].dependencyCount;
+				}
+				lastMainThread = i;
+			}
+		}
+	}
+
+	std::vector<size_t> SystemScheduler::GetDependencies(size_t index) const {
+		std::vector<size_t> dependencies;
+		for (size_t i = 0; i < m_nodes.size(); ++i) {
+			const auto& dependents = m_nodes[i].dependents;
+			if (std::find(dependents.begin(), dependents.end(), index) != dependents.end()) {
+				dependencies.push_back(i);
+			}
+		}
+		return dependencies;
+	}
+
+	void SystemScheduler::Run() {
+		const size_t count = m_nodes.size();
+		if (count == 0) {
+			m_criticalPath = 0.f;
+			return;
+		}
+
+		m_completed = 0;
+		m_exception = nullptr;
+		m_mainQueue.clear();
+		for (size_t i = 0; i < count; ++i) {
+			m_remainingDependencies[i].store(m_nodes[i].dependencyCount, std::memory_order_relaxed);
+		}
+
+		for (size_t i = 0; i < count; ++i) {
+			if (m_nodes[i].dependencyCount == 0) {
+				Dispatch(i);
+			}
+		}
+
+		//main thread runs its own systems and helps with worker jobs while waiting
+		while (m_completed.load(std::memory_order_acquire) < count) {
+			std::unique_lock<std::mutex> lock(m_mainMutex);
+			if (!m_mainQueue.empty()) {
+				const size_t index = m_mainQueue.front();
+				m_mainQueue.pop_front();
+				lock.unlock();
+				Execute(index);
+				continue;
+			}
+			lock.unlock();
+
+			if (m_jobSystem.RunPendingJob()) continue;
+
+			lock.lock();
+			m_mainCV.wait(lock, [this, count]() {
+				return !m_mainQueue.empty() || m_completed.load(std::memory_order_acquire) == count;
+			});
+		}
+
+		//nodes are already in topological order since edges only point forward
+		std::vector<float> finish(count, 0.f);
+		m_criticalPath = 0.f;
+		for (size_t i = 0; i < count; ++i) {
+			finish[i] += m_timings[i].duration;
+			m_criticalPath = std::max(m_criticalPath, finish[i]);
+			for (const size_t dependent : m_nodes[i].dependents) {
+				finish[dependent] = std::max(finish[dependent], finish[i]);
+			}
+		}
+
+		if (m_exception) {
+			std::rethrow_exception(m_exception);
+		}
+	}
+
+	void SystemScheduler::Dispatch(size_t index) {
+		if (m_nodes[index].system->RunsOnMainThread() || m_jobSystem.GetWorkerCount() == 0) {
+			{
+				std::lock_guard<std::mutex> lock(m_mainMutex);
+				m_mainQueue.push_back(index);
+			}
+			m_mainCV.notify_one();
+			return;
+		}
+
+		m_jobSystem.Submit([this, index]() { Execute(index); });
+	}
+
+	void SystemScheduler::Execute(size_t index) {
+		auto start = std::chrono::steady_clock::now();
+		try {
+			//typeid names are static, the zone is named after the system's class
+			KOS_PROFILE_SCOPE(typeid(*m_nodes[index].system).name());
+			m_nodes[index].system->Update();
+		}
+		catch (...) {
+			std::lock_guard<std::mutex> lock(m_exceptionMutex);
+			if (!m_exception) m_exception = std::current_exception();
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		m_timings[index].duration = std::chrono::duration<float>(end - start).count();
+		m_timings[index].worker = utility::JobSystem::GetCurrentWorkerIndex();
+
+		for (const size_t dependent : m_nodes[index].dependents) {
+			if (m_remainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				Dispatch(dependent);
+			}
+		}
+
+		{
+			//under the lock so the main thread cannot miss the last completion
+			std::lock_guard<std::mutex> lock(m_mainMutex);
+			m_completed.fetch_add(1, std::memory_order_acq_rel);
+		}
+		m_mainCV.notify_one();
+	}
+
+}
@@ -0,0 +1,91 @@
+/******************************************************************/
+/*!
+\file      SystemScheduler.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   SystemScheduler runs the systems of a frame as a dependency
+		   graph. Two systems depend on each other when one writes a
+		   component the other reads or writes, the earlier system in
+		   registration order runs first. Systems without a conflict
+		   run concurrently on the job system, systems that touch the
+		   graphics/physics/script state stay on the main thread and
+		   keep their relative order.
+
+		   Each run records the duration and worker of every system
+		   and the critical path (longest chain of dependent systems)
+		   of the frame.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef SYSTEMSCHEDULER_H
+#define SYSTEMSCHEDULER_H
+
+#include "Config/pch.h"
+#include "Utility/JobSystem.h"
+
+namespace ecs {
+
+	class ISystem;
+
+	class SystemScheduler {
+	public:
+		struct SystemTiming {
+			float duration{};		// seconds
+			int worker{ -1 };		// -1 is the main thread
+		};
+
+		explicit SystemScheduler(utility::JobSystem& jobSystem)
+			: m_jobSystem(jobSystem)
+		{
+		}
+
+		//rebuilds the dependency graph if the systems differ from the last build
+		void Build(const std::vector<ISystem*>& systems);
+
+		//runs every built system once, blocks until all systems are done
+		void Run();
+
+		const SystemTiming& GetTiming(size_t index) const { return m_timings[index]; }
+		float GetCriticalPath() const { return m_criticalPath; }
+
+		//indices of the systems that have to finish before system index starts
+		std::vector<size_t> GetDependencies(size_t index) const;
+
+		static bool Conflicts(const ISystem& first, const ISystem& second);
+
+	private:
+		struct Node {
+			ISystem* system{ nullptr };
+			std::vector<size_t> dependents;
+			size_t dependencyCount{};
+		};
+
+		void Dispatch(size_t index);
+		void Execute(size_t index);
+
+		utility::JobSystem& m_jobSystem;
+
+		std::vector<ISystem*> m_builtSystems;
+		std::vector<Node> m_nodes;
+		std::unique_ptr<std::atomic<size_t>[]> m_remainingDependencies;
+		std::vector<SystemTiming> m_timings;
+		float m_criticalPath{};
+
+		//ready queue of main thread systems
+		std::mutex m_mainMutex;
+		std::condition_variable m_mainCV;
+		std::deque<size_t> m_mainQueue;
+		std::atomic<size_t> m_completed{ 0 };
+
+		//first exception thrown by a system, rethrown on the main thread after the frame
+		std::mutex m_exceptionMutex;
+		std::exception_ptr m_exception;
+	};
+
+}
+
+#endif SYSTEMSCHEDULER_H
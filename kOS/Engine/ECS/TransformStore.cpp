@@ -0,0 +1,98 @@
+/******************************************************************/
+/*!
+\file      TransformStore.cpp
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   Structure of arrays transform hierarchy.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "TransformStore.h"
+
+namespace ecs {
+
+	void TransformStore::Clear() {
+		m_positionX.clear(); m_positionY.clear(); m_positionZ.clear();
+		m_rotationX.clear(); m_rotationY.clear(); m_rotationZ.clear();
+		m_scaleX.clear(); m_scaleY.clear(); m_scaleZ.clear();
+		m_local.clear();
+		m_world.clear();
+
+		m_entity.clear();
+		m_parent.clear();
+		m_root.clear();
+		m_childBegin.clear();
+		m_childCount.clear();
+		m_localDirty.clear();
+		m_worldDirty.clear();
+		m_levelBegin.clear();
+	}
+
+	void TransformStore::BeginLevel() {
+		m_levelBegin.push_back(static_cast<uint32_t>(Size()));
+	}
+
+	uint32_t TransformStore::Push(EntityID id, uint32_t parent, uint32_t root, const Transformation& local) {
+		const uint32_t index = static_cast<uint32_t>(Size());
+
+		m_positionX.push_back(local.position.x); m_positionY.push_back(local.position.y); m_positionZ.push_back(local.position.z);
+		m_rotationX.push_back(local.rotation.x); m_rotationY.push_back(local.rotation.y); m_rotationZ.push_back(local.rotation.z);
+		m_scaleX.push_back(local.scale.x); m_scaleY.push_back(local.scale.y); m_scaleZ.push_back(local.scale.z);
+		m_local.emplace_back(1.f);
+		m_world.emplace_back(1.f);
+
+		m_entity.push_back(id);
+		m_parent.push_back(parent);
+		m_root.push_back(root == INVALID_INDEX ? index : root);
+		m_childBegin.push_back(0);
+		m_childCount.push_back(0);
+		m_localDirty.push_back(1);
+		m_worldDirty.push_back(0);
+
+		//breadth first order keeps the children of a parent next to each other
+		if (parent != INVALID_INDEX) {
+			if (m_childCount[parent] == 0) m_childBegin[parent] = index;
+			++m_childCount[parent];
+		}
+
+		return index;
+	}
+
+	bool TransformStore::SyncLocal(uint32_t index, const Transformation& local) {
+		if (m_positionX[index] == local.position.x && m_positionY[index] == local.position.y && m_positionZ[index] == local.position.z &&
+			m_rotationX[index] == local.rotation.x && m_rotationY[index] == local.rotation.y && m_rotationZ[index] == local.rotation.z &&
+			m_scaleX[index] == local.scale.x && m_scaleY[index] == local.scale.y && m_scaleZ[index] == local.scale.z) {
+			return false;
+		}
+
+		m_positionX[index] = local.position.x; m_positionY[index] = local.position.y; m_positionZ[index] = local.position.z;
+		m_rotationX[index] = local.rotation.x; m_rotationY[index] = local.rotation.y; m_rotationZ[index] = local.rotation.z;
+		m_scaleX[index] = local.scale.x; m_scaleY[index] = local.scale.y; m_scaleZ[index] = local.scale.z;
+		return true;
+	}
+
+	void TransformStore::ComposeLocal(const uint32_t* indices, size_t count) {
+		const utility::TRSArrays trs{
+			m_positionX.data(), m_positionY.data(), m_positionZ.data(),
+			m_rotationX.data(), m_rotationY.data(), m_rotationZ.data(),
+			m_scaleX.data(), m_scaleY.data(), m_scaleZ.data()
+		};
+		utility::ComposeTRS(trs, indices, count, m_local.data());
+	}
+
+	void TransformStore::ComposeWorld(uint32_t index) {
+		const uint32_t parent = m_parent[index];
+		if (parent == INVALID_INDEX) {
+			m_world[index] = m_local[index];
+		}
+		else {
+			utility::MultiplyMat4(m_world[parent], m_local[index], m_world[index]);
+		}
+	}
+
+}
@@ -0,0 +1,91 @@
+/******************************************************************/
+/*!
+\file      TransformStore.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief	   Structure of arrays copy of the transform hierarchy used by
+		   the TransformSystem. Local TRS, local and world matrices
+		   live in separate aligned arrays, nodes are stored breadth
+		   first so every hierarchy depth is a contiguous range and the
+		   children of a node are a contiguous index range in the next
+		   depth.
+
+		   TransformComponent stays the facade for reflection, the
+		   editor and scripts. The store is synced from the component's
+		   LocalTransformation and writes the world matrix back only
+		   when it changed.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef TRANSFORMSTORE_H
+#define TRANSFORMSTORE_H
+
+#include "Config/pch.h"
+#include "ECS/ECSList.h"
+#include "ECS/Component/TransformComponent.h"
+#include "Utility/SimdMath.h"
+
+namespace ecs {
+
+	class TransformStore {
+	public:
+		static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+		void Clear();
+
+		//nodes must be pushed breadth first, BeginLevel starts the next hierarchy depth
+		void BeginLevel();
+		uint32_t Push(EntityID id, uint32_t parent, uint32_t root, const Transformation& local);
+
+		size_t Size() const { return m_entity.size(); }
+		size_t LevelCount() const { return m_levelBegin.size(); }
+		uint32_t LevelBegin(size_t level) const { return m_levelBegin[level]; }
+		uint32_t LevelEnd(size_t level) const { return level + 1 < m_levelBegin.size() ? m_levelBegin[level + 1] : static_cast<uint32_t>(Size()); }
+
+		EntityID GetEntity(uint32_t index) const { return m_entity[index]; }
+		uint32_t GetRoot(uint32_t index) const { return m_root[index]; }
+		uint32_t GetParent(uint32_t index) const { return m_parent[index]; }
+		uint32_t ChildBegin(uint32_t index) const { return m_childBegin[index]; }
+		uint32_t ChildEnd(uint32_t index) const { return m_childBegin[index] + m_childCount[index]; }
+
+		//copies the local TRS into the store if it differs, returns true when it changed
+		bool SyncLocal(uint32_t index, const Transformation& local);
+
+		//local = T * R * S for the given nodes
+		void ComposeLocal(const uint32_t* indices, size_t count);
+
+		//world = parent world * local, roots copy their local
+		void ComposeWorld(uint32_t index);
+
+		const glm::mat4& GetLocal(uint32_t index) const { return m_local[index]; }
+		const glm::mat4& GetWorld(uint32_t index) const { return m_world[index]; }
+
+		bool IsLocalDirty(uint32_t index) const { return m_localDirty[index] != 0; }
+		bool IsWorldDirty(uint32_t index) const { return m_worldDirty[index] != 0; }
+		void SetLocalDirty(uint32_t index, bool dirty) { m_localDirty[index] = dirty; }
+		void SetWorldDirty(uint32_t index, bool dirty) { m_worldDirty[index] = dirty; }
+
+	private:
+		utility::AlignedVector<float> m_positionX, m_positionY, m_positionZ;
+		utility::AlignedVector<float> m_rotationX, m_rotationY, m_rotationZ;
+		utility::AlignedVector<float> m_scaleX, m_scaleY, m_scaleZ;
+		utility::AlignedVector<glm::mat4> m_local;
+		utility::AlignedVector<glm::mat4> m_world;
+
+		std::vector<EntityID> m_entity;
+		std::vector<uint32_t> m_parent;
+		std::vector<uint32_t> m_root;
+		std::vector<uint32_t> m_childBegin;
+		std::vector<uint32_t> m_childCount;
+		std::vector<uint8_t> m_localDirty;
+		std::vector<uint8_t> m_worldDirty;
+		std::vector<uint32_t> m_levelBegin;
+	};
+
+}
+
+#endif TRANSFORMSTORE_H
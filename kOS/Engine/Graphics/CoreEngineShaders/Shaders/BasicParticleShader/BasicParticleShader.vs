@@ -9,8 +9,13 @@ layout(location = 5) in float instanceRot; // per-particle rotation (around view
 
 out vec4 vColor;
 
-uniform mat4 view;
-uniform mat4 projection;
+//FrameBlock in UniformBlocks.h
+layout(std140, binding = 0) uniform FrameBlock
+{
+    mat4 projection;
+    mat4 view;
+    vec3 cameraPosition;
+};
 
 void main()
 {
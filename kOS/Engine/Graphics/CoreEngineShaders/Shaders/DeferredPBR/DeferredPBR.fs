@@ -15,60 +15,67 @@ layout(binding=6)   uniform sampler2D shadowMap;
 
 
 
+//Members are ordered so each vec3 shares its 16 bytes with the float after it,
+//the C++ side of the blocks is in UniformBlocks.h and has to match
 struct Light 
 {
     vec3 position;      // Position of the light source in the world space
-    vec3 color;
-    vec3 La;            // Ambient light intensity
-    vec3 Ld;            // Diffuse light intensity
-    vec3 Ls;            // Specular light intensity
     float linear;
+    vec3 color;
     float quadratic;
+    vec3 La;            // Ambient light intensity
     float radius;
+    vec3 Ld;            // Diffuse light intensity
     float intensity;
+    vec3 Ls;            // Specular light intensity
     bool shadowCon;
     bool bakedCon;
 };
 struct SpotLight 
 {
     vec3 position;      // Position of the light source in the world space
-    vec3 color;
-    vec3 La;            // Ambient light intensity
-    vec3 Ld;            // Diffuse light intensity
-    vec3 Ls;            // Specular light intensity
     float linear;
+    vec3 color;
     float quadratic;
+    vec3 La;            // Ambient light intensity
     float radius;
+    vec3 Ld;            // Diffuse light intensity
     float cutOff;
+    vec3 Ls;            // Specular light intensity
     float outerCutOff;
-    vec3 direction;      // Position of the light source in the world space
-        float intensity;
-
-
+    vec3 direction;
+    float intensity;
 };
 
 struct DirectionalLight 
 {
-    vec3 direction;      // Position of the light source in the world space
+    mat4 shadowMtx;
+    vec3 direction;
+    float intensity;
     vec3 color;
     vec3 La;            // Ambient light intensity
     vec3 Ld;            // Diffuse light intensity
     vec3 Ls;            // Specular light intensity
-    mat4 shadowMtx;
-        float intensity;
 };
 
-uniform int pointLightNo;
-uniform int dirLightNo;
-uniform int spotLightNo;
-
-uniform Light light[32];
-uniform DirectionalLight directionalLight[10];
-uniform SpotLight spotLight[32];
-uniform vec3 lightAmbience;
+layout(std140, binding = 0) uniform FrameBlock
+{
+    mat4 projection;
+    mat4 view;
+    vec3 cameraPosition;
+};
 
+layout(std140, binding = 1) uniform LightBlock
+{
+    Light light[32];
+    DirectionalLight directionalLight[10];
+    SpotLight spotLight[32];
+    vec3 lightAmbience;
+    int pointLightNo;
+    int dirLightNo;
+    int spotLightNo;
+};
 
-uniform mat4 view;  
 vec3 diffuseColor;
 float specularColor;
 float shadow=0.f;
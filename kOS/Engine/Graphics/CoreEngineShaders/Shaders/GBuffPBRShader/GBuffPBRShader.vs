@@ -25,9 +25,13 @@ out mat3 tangentToWorld;
 out float shaderType;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
-uniform vec3 cameraPosition;
+//FrameBlock in UniformBlocks.h
+layout(std140, binding = 0) uniform FrameBlock
+{
+    mat4 projection;
+    mat4 view;
+    vec3 cameraPosition;
+};
 uniform int isNotRigged;
 
 const int MAX_BONES = 200;
@@ -74,7 +74,10 @@ void CubeMap::LoadCubeTextureDDS(std::vector<std::string> faces) {
 
     gli::gl GL(gli::gl::PROFILE_GL33);
     gli::texture Texture = gli::load(faces[0]); // Use first face to get format & size
-    if (Texture.format() == gli::FORMAT_UNDEFINED)    std::cout << "BAD JUJU\n"<<faces[0];
+    if (Texture.empty()) {
+        std::cout << "BAD JUJU\n"<<faces[0];
+        return;
+    }
     gli::gl::format Format = GL.translate(Texture.format(), Texture.swizzles());
     glm::tvec3<GLsizei> Extent(Texture.extent(0));
 
@@ -116,7 +116,7 @@ struct FrameBuffer {
 		//texID = AssetManager::currentManager.GetTexture("CEO")->RetrieveTexture();
 		glActiveTexture(GL_TEXTURE7);
 		glBindTexture(GL_TEXTURE_2D, this->texID);
-		glUniform1i(glGetUniformLocation(shader->ID, "screenTexture"), 7);
+		shader->SetInt("screenTexture", 7);
 		glDrawElements(GL_TRIANGLE_STRIP, drawCount, GL_UNSIGNED_SHORT, NULL);
 		glBindVertexArray(0);
 	}
@@ -23,6 +23,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Config/pch.h"
 #include "GraphicsManager.h"
 #include "Camera.h"
+#include "Debugging/Profiler.h"
 
 //Variables to debug graphics
 namespace DebugGraphics {
@@ -55,6 +56,8 @@ void GraphicsManager::gm_Initialize(float width, float height) {
 	gm_InitializeMeshes();
 	framebufferManager.Initialize(static_cast<int>(this->windowWidth), static_cast<int>(this->windowHeight));
 	shaderManager.Initialize();
+	frameUniforms.Initialize(uniformblock::FRAME_BINDING);
+	lightUniforms.Initialize(uniformblock::LIGHT_BINDING);
 
 	//Bind shader to editor buffer
 	framebufferManager.editorBuffer.shader = &shaderManager.engineShaders.find("FrameBufferShader")->second;
@@ -77,6 +80,7 @@ void GraphicsManager::gm_Update()
 
 void GraphicsManager::gm_Render()
 {
+	KOS_PROFILE_SCOPE("GraphicsManager::gm_Render");
 	glViewport(0, 0, static_cast<GLsizei>(windowWidth), static_cast<GLsizei>(windowHeight));
 
 	//Force only first camera to be active for now
@@ -106,6 +110,11 @@ void GraphicsManager::gm_RenderDebug()
 void GraphicsManager::gm_Clear()
 {
 	gm_ClearGBuffer();
+	gm_ClearSubmissions();
+}
+
+void GraphicsManager::gm_ClearSubmissions()
+{
 	textRenderer.Clear();
 	spriteRenderer.Clear();
 	meshRenderer.Clear();
@@ -119,6 +128,24 @@ void GraphicsManager::gm_Clear()
 	//editorCameraActive = false;
 }
 
+SubmissionCounts GraphicsManager::gm_GetSubmissionCounts() const
+{
+	SubmissionCounts counts;
+	for (const std::vector<MeshData>& layer : meshRenderer.meshesToDraw) {
+		counts.meshes += layer.size();
+	}
+	counts.skinnedMeshes = skinnedMeshRenderer.skinnedMeshesToDraw.size();
+	counts.cubes = cubeRenderer.cubesToDraw.size();
+	counts.spheres = sphereRenderer.spheresToDraw.size();
+	counts.lights = lightRenderer.pointLightsToDraw.size() + lightRenderer.directionLightsToDraw.size() + lightRenderer.spotLightsToDraw.size();
+	counts.screenText = textRenderer.screenTextToDraw.size();
+	counts.screenSprites = spriteRenderer.screenSpritesToDraw.size();
+	counts.debugShapes = debugRenderer.basicDebugCubes.size() + debugRenderer.basicDebugCapsules.size() + debugRenderer.basicDebugSpheres.size();
+	counts.particles = particleRenderer.particlesToDraw.size();
+	counts.gameCameras = gameCameras.size();
+	return counts;
+}
+
 void GraphicsManager::gm_ResetFrameBuffer() {
 	glBindVertexArray(framebufferManager.frameBuffer.vaoId);
 	glDisable(GL_BLEND);
@@ -181,14 +208,29 @@ void GraphicsManager::gm_RenderToGameFrameBuffer()
 
 
 
+void GraphicsManager::gm_UploadUniformBlocks(const CameraData& camera)
+{
+	FrameBlock frame;
+	frame.projection = camera.GetPerspMtx();
+	frame.view = camera.GetViewMtx();
+	frame.cameraPosition = camera.position;
+	frameUniforms.Upload(frame);
+
+	lightRenderer.FillLightBlock(lightBlock);
+	lightBlock.lightAmbience = PointLightData::ambientStrength;
+	lightUniforms.Upload(lightBlock);
+}
+
 void GraphicsManager::gm_FillDataBuffers(const CameraData& camera)
 {
+	gm_UploadUniformBlocks(camera);
 	gm_FillGBuffer(camera);
 	gm_FillDepthBuffer(camera);
 	gm_FillDepthCube(camera);
 }
 void GraphicsManager::gm_FillDataBuffersGame(const CameraData& camera)
 {
+	gm_UploadUniformBlocks(camera);
 	gm_FillGBufferGame(camera);
 	gm_FillDepthBuffer(camera);
 	gm_FillDepthCube(camera);
@@ -203,9 +245,6 @@ void GraphicsManager::gm_FillGBuffer(const CameraData& camera)
 	Shader* gBufferDebugShader{ &shaderManager.engineShaders.find("GBufferDebugShader")->second };
 
 	gBufferPBRShader->Use();
-	gBufferPBRShader->SetTrans("projection", camera.GetPerspMtx()); // note: currently we set the projection matrix each frame, but since the projection matrix rarely changes it's often best practice to set it outside the main loop only once.
-	gBufferPBRShader->SetTrans("view", camera.GetViewMtx());
-	gBufferPBRShader->SetVec3("cameraPosition", camera.position);
 	gBufferPBRShader->SetFloat("uShaderType", 0.f);
 
 	//Render all meshes
@@ -219,8 +258,6 @@ void GraphicsManager::gm_FillGBuffer(const CameraData& camera)
 	gBufferPBRShader->Disuse();
 
 	gBufferDebugShader->Use();
-	gBufferDebugShader->SetTrans("view", camera.GetViewMtx());
-	gBufferDebugShader->SetTrans("projection", camera.GetPerspMtx()); // note: currently we set the projection matrix each frame, but since the projection matrix rarely changes it's often best practice to set it outside the main loop only once.
 	//Render debug objects if any
 	debugRenderer.RenderDebugCubes(camera, *gBufferDebugShader);
 	debugRenderer.RenderDebugSpheres(camera, *gBufferDebugShader);
@@ -238,9 +275,6 @@ void GraphicsManager::gm_FillGBufferGame(const CameraData& camera) {
 	Shader* gBufferDebugShader{ &shaderManager.engineShaders.find("GBufferDebugShader")->second };
 
 	gBufferPBRShader->Use();
-	gBufferPBRShader->SetTrans("projection", camera.GetPerspMtx()); // note: currently we set the projection matrix each frame, but since the projection matrix rarely changes it's often best practice to set it outside the main loop only once.
-	gBufferPBRShader->SetTrans("view", camera.GetViewMtx());
-	gBufferPBRShader->SetVec3("cameraPosition", camera.position);
 	gBufferPBRShader->SetFloat("uShaderType", 0.f);
 
 	//Render all meshes
@@ -256,9 +290,9 @@ void GraphicsManager::gm_FillDepthBuffer(const CameraData& camera)
 	//Render to Depth buffer
 	glCullFace(GL_FRONT);
 	Shader* depthMapShader{ &shaderManager.engineShaders.find("DepthMapShader")->second };
-	lightRenderer.RenderAllLights(camera, *depthMapShader);
 
 	depthMapShader->Use();
+	depthMapShader->SetTrans("lightSpaceMatrix", lightBlock.dirLightNo ? lightBlock.directionalLight[0].shadowMtx : glm::mat4{ 1.f });
 
 	//Manual bind
 	glBindFramebuffer(GL_FRAMEBUFFER, framebufferManager.depthBuffer.depthMapFBO);
@@ -320,16 +354,14 @@ void GraphicsManager::gm_FillDepthCube(const CameraData& camera) {
 		glClear(GL_DEPTH_BUFFER_BIT);
 		pointShadowShader->Use();
 		lightRenderer.dcm[i].FillMap(lightRenderer.pointLightsToDraw[i].position);
-		for (unsigned int j = 0; j < 6; ++j) {
-			pointShadowShader->SetMat4("shadowMatrices[" + std::to_string(j) + "]", lightRenderer.dcm[i].shadowTransforms[j]);
-		}
+		pointShadowShader->SetMat4Array("shadowMatrices", lightRenderer.dcm[i].shadowTransforms[0], 6);
 		pointShadowShader->SetFloat("far_plane", lightRenderer.dcm[i].far_plane);
 		pointShadowShader->SetVec3("lightPos", lightRenderer.pointLightsToDraw[i].position);
 		for (std::vector<MeshData>& meshData : meshRenderer.meshesToDraw) {
 			for (MeshData& md : meshData)
 			{
 				pointShadowShader->SetTrans("model", md.transformation);
-				md.meshToUse->PBRDraw(*pointShadowShader, md.meshMaterial);
+				meshRenderer.DrawMesh(*pointShadowShader, md);
 			}
 
 		}
@@ -356,16 +388,14 @@ void GraphicsManager::gm_FillDepthCube(const CameraData& camera, int index,glm::
 	glClear(GL_DEPTH_BUFFER_BIT);
 	pointShadowShader->Use();
 	lightRenderer.dcm[index].FillMap(lighPos);
-	for (unsigned int j = 0; j < 6; ++j) {
-		pointShadowShader->SetMat4("shadowMatrices[" + std::to_string(j) + "]", lightRenderer.dcm[index].shadowTransforms[j]);
-	}
+	pointShadowShader->SetMat4Array("shadowMatrices", lightRenderer.dcm[index].shadowTransforms[0], 6);
 	pointShadowShader->SetFloat("far_plane", lightRenderer.dcm[index].far_plane);
 	pointShadowShader->SetVec3("lightPos", lighPos);
 	for (std::vector<MeshData>& meshData : meshRenderer.meshesToDraw) {
 		for (MeshData& md : meshData)
 		{
 			pointShadowShader->SetTrans("model", md.transformation);
-			md.meshToUse->PBRDraw(*pointShadowShader, md.meshMaterial);
+			meshRenderer.DrawMesh(*pointShadowShader, md);
 		}
 
 	}
@@ -470,18 +500,8 @@ void GraphicsManager::gm_RenderDeferredObjects(const CameraData& camera)
 
 	Shader* deferredPBRShader{ &shaderManager.engineShaders.find("DeferredPBRShader")->second };
 
-
-	lightRenderer.RenderAllLights(camera, *deferredPBRShader);
-
-	//Render everything else
+	//Lights and the view matrix are in the uniform blocks uploaded for this camera
 	deferredPBRShader->Use();
-	deferredPBRShader->SetVec3("lightAmbience", PointLightData::ambientStrength);
-	deferredPBRShader->SetTrans("view", camera.GetViewMtx());
-
-
-	deferredPBRShader->SetInt("pointLightNo", static_cast<int>(lightRenderer.pointLightsToDraw.size()));
-	deferredPBRShader->SetInt("dirLightNo", static_cast<int>(lightRenderer.directionLightsToDraw.size()));
-	deferredPBRShader->SetInt("spotLightNo", static_cast<int>(lightRenderer.spotLightsToDraw.size()));
 
 	//Set depth cube maps Sean pls kill me 
 
@@ -512,11 +532,11 @@ void GraphicsManager::gm_RenderDeferredObjects(const CameraData& camera)
 	}
 	deferredPBRShader->SetIntArray("depthMap", samplerUnits, 16);
 
-	glUniform1i(glGetUniformLocation(deferredPBRShader->ID, "gPosition"), 0);  // Bind to GL_TEXTURE0
-	glUniform1i(glGetUniformLocation(deferredPBRShader->ID, "gNormal"), 1);    // Bind to GL_TEXTURE1
-	glUniform1i(glGetUniformLocation(deferredPBRShader->ID, "gAlbedoSpec"), 2); // Bind to GL_TEXTURE2
-	glUniform1i(glGetUniformLocation(deferredPBRShader->ID, "gReflect"), 3);
-	glUniform1i(glGetUniformLocation(deferredPBRShader->ID, "gMaterial"), 4);
+	deferredPBRShader->SetInt("gPosition", 0);  // Bind to GL_TEXTURE0
+	deferredPBRShader->SetInt("gNormal", 1);    // Bind to GL_TEXTURE1
+	deferredPBRShader->SetInt("gAlbedoSpec", 2); // Bind to GL_TEXTURE2
+	deferredPBRShader->SetInt("gReflect", 3);
+	deferredPBRShader->SetInt("gMaterial", 4);
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	glBindVertexArray(framebufferManager.frameBuffer.vaoId);
@@ -536,11 +556,11 @@ void GraphicsManager::gm_RenderDebugObjects(const CameraData& camera)
 	//glBindTexture(GL_TEXTURE_CUBE_MAP, testIrradiance.RetrieveID());
 	glActiveTexture(GL_TEXTURE6);
 	glBindTexture(GL_TEXTURE_2D, framebufferManager.depthBuffer.RetrieveBuffer());
-	glUniform1i(glGetUniformLocation(defaultDraw->ID, "gPosition"), 0);  // Bind to GL_TEXTURE0
-	glUniform1i(glGetUniformLocation(defaultDraw->ID, "gNormal"), 1);    // Bind to GL_TEXTURE1
-	glUniform1i(glGetUniformLocation(defaultDraw->ID, "gAlbedoSpec"), 2); // Bind to GL_TEXTURE2
-	glUniform1i(glGetUniformLocation(defaultDraw->ID, "gReflect"), 3);
-	glUniform1i(glGetUniformLocation(defaultDraw->ID, "gMaterial"), 4);
+	defaultDraw->SetInt("gPosition", 0);  // Bind to GL_TEXTURE0
+	defaultDraw->SetInt("gNormal", 1);    // Bind to GL_TEXTURE1
+	defaultDraw->SetInt("gAlbedoSpec", 2); // Bind to GL_TEXTURE2
+	defaultDraw->SetInt("gReflect", 3);
+	defaultDraw->SetInt("gMaterial", 4);
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	glBindVertexArray(framebufferManager.frameBuffer.vaoId);
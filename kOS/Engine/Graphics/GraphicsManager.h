@@ -30,9 +30,28 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Camera.h"
 #include "Renderer.h"
 #include "ShaderManager.h"
+#include "UniformBlocks.h"
 #include "FramebufferManager.h"
 #include "Resources/ResourceManager.h"
 
+//draw data submitted by the systems since the last clear
+struct SubmissionCounts {
+	size_t meshes{};
+	size_t skinnedMeshes{};
+	size_t cubes{};
+	size_t spheres{};
+	size_t lights{};
+	size_t screenText{};
+	size_t screenSprites{};
+	size_t debugShapes{};
+	size_t particles{};
+	size_t gameCameras{};
+
+	size_t Total() const {
+		return meshes + skinnedMeshes + cubes + spheres + lights + screenText + screenSprites + debugShapes + particles + gameCameras;
+	}
+};
+
 class GraphicsManager
 {
 public:
@@ -51,6 +70,9 @@ public:
 	void gm_RenderDebug();
 	void gm_Clear();
 	void gm_ClearGBuffer();
+	//drops the submitted draw data without touching GL, lets headless runs reuse the frame's queues
+	void gm_ClearSubmissions();
+	SubmissionCounts gm_GetSubmissionCounts() const;
 	void gm_RenderDeferredObjects(const CameraData& camera);
 	void gm_ResetFrameBuffer();
 	FramebufferManager* gm_GetFBM() { return &framebufferManager;; }
@@ -59,6 +81,8 @@ public:
 	inline void gm_PushScreenTextData(ScreenTextData&& fontData) { textRenderer.screenTextToDraw.emplace_back(std::move(fontData)); };
 	inline void gm_PushMeshData(MeshData&& meshData) { meshRenderer.meshesToDraw[0].emplace_back(std::move(meshData)); };
 	inline void gm_PushMeshData(MeshData&& meshData,layer::LAYERS index) { meshRenderer.meshesToDraw[index].emplace_back(std::move(meshData)); };
+	//MeshData::firstMaterial indexes into this, cleared with the frame
+	inline std::vector<const PBRMaterial*>& gm_GetMeshMaterials() { return meshRenderer.materialsToDraw; };
 	inline void gm_PushScreenSpriteData(ScreenSpriteData&& spriteData) { spriteRenderer.screenSpritesToDraw.emplace_back(std::move(spriteData)); };
 	inline void gm_PushPointLightData(PointLightData&& pointLightData) { lightRenderer.pointLightsToDraw.emplace_back(std::move(pointLightData)); };
 	inline void gm_PushDirectionalLightData(DirectionalLightData&& directionalLightData) { lightRenderer.directionLightsToDraw.emplace_back(std::move(directionalLightData)); };
@@ -95,6 +119,7 @@ private:
 	//Render functions
 	void gm_RenderToEditorFrameBuffer();
 	void gm_RenderToGameFrameBuffer();
+	void gm_UploadUniformBlocks(const CameraData& camera);
 	void gm_FillDataBuffers(const CameraData& camera);
 	void gm_FillDataBuffersGame(const CameraData& camera);
 	void gm_FillGBuffer(const CameraData& camera);
@@ -121,6 +146,10 @@ private:
 	CubeRenderer cubeRenderer;
 	SphereRenderer sphereRenderer;
 	ParticleRenderer particleRenderer;
+	//Per camera shader data, shared by every engine shader
+	UniformBuffer<FrameBlock> frameUniforms;
+	UniformBuffer<LightBlock> lightUniforms;
+	LightBlock lightBlock{};
 	//Managers
 	ShaderManager shaderManager;
 	FramebufferManager framebufferManager;
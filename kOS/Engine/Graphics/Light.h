@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #pragma once
 #include "GraphicsReferences.h"
 #include "Shader.h"
+#include "UniformBlocks.h"
 
 enum LightType {
 	LIGHT		=0,
@@ -48,8 +49,7 @@ struct PointLightData {
 	bool bakedCon;
 	utility::GUID bakedmapGUID;
 	static glm::vec3  ambientStrength;
-	virtual void SetUniform(Shader* shader, size_t number);
-	virtual void SetShaderMtrx(Shader* shader, size_t number);
+	PointLightBlock ToBlock() const;
 };
 
 struct DirectionalLightData :public PointLightData {
@@ -62,8 +62,8 @@ struct DirectionalLightData :public PointLightData {
 
 	glm::vec3 direction{ 0.f,0.f,1.f };
 	float intensity;
-	void SetUniform(Shader* shader, size_t number);
-	void SetShaderMtrx(Shader* shader, size_t number);
+	DirectionalLightBlock ToBlock() const;
+	glm::mat4 GetShadowMatrix() const;
 };
 
 struct SpotLightData :public PointLightData {
@@ -76,5 +76,5 @@ struct SpotLightData :public PointLightData {
 	glm::vec3 direction{0.f,0.f,1.f};
 	float cutOff{5.5f};
 	float outerCutOff{10.5f};
-	void SetUniform(Shader* shader, size_t number);
+	SpotLightBlock ToBlock() const;
 };
\ No newline at end of file
@@ -50,8 +50,10 @@ struct SkinnedMeshData
 
 struct MeshData
 {
-    std::shared_ptr<R_Model> meshToUse;
-    std::shared_ptr<PBRMaterial> meshMaterial;
+    R_Model* meshToUse{ nullptr };
+    //range in MeshRenderer::materialsToDraw
+    uint32_t firstMaterial{};
+    uint32_t materialCount{};
     glm::mat4 transformation{ 1.f };
     int entityID{ -1 };
 };
@@ -0,0 +1,188 @@
+/********************************************************************/
+/*!
+\file      NullGL.cpp
+\author    Gabe Ng 2301290
+\par       gabe.ng@digipen.edu
+\date      Oct 18 2026
+\brief     Null OpenGL backend, counting stubs installed in place of
+		   the glad function pointers.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "Config/pch.h"
+#include "NullGL.h"
+#include "GraphicsReferences.h"
+#include <atomic>
+
+//every gl function the engine calls, add new ones here
+#define KOS_NULLGL_FUNCTIONS(X) \
+	X(glActiveTexture) X(glAttachShader) X(glBindBuffer) X(glBindBufferBase) X(glBindFramebuffer) X(glBindRenderbuffer) \
+	X(glBindTexture) X(glBindVertexArray) X(glBlendFunc) X(glBlitFramebuffer) X(glBufferData) \
+	X(glBufferSubData) X(glCheckFramebufferStatus) X(glClear) X(glClearBufferfv) X(glClearColor) \
+	X(glCompileShader) X(glCompressedTexSubImage2D) X(glCreateProgram) X(glCreateShader) X(glCullFace) \
+	X(glDeleteFramebuffers) X(glDeleteProgram) X(glDeleteRenderbuffers) X(glDeleteShader) X(glDeleteTextures) \
+	X(glDeleteBuffers) X(glDeleteVertexArrays) X(glDepthFunc) X(glDepthMask) X(glDisable) \
+	X(glDrawArrays) X(glDrawArraysInstanced) X(glDrawBuffer) X(glDrawBuffers) X(glDrawElements) \
+	X(glEnable) X(glEnableVertexAttribArray) X(glFramebufferRenderbuffer) X(glFramebufferTexture) X(glFramebufferTexture2D) \
+	X(glGenBuffers) X(glGenFramebuffers) X(glGenRenderbuffers) X(glGenTextures) X(glGenVertexArrays) \
+	X(glGenerateMipmap) X(glGetActiveUniform) X(glGetError) X(glGetIntegerv) X(glGetProgramInfoLog) X(glGetProgramiv) \
+	X(glGetShaderInfoLog) X(glGetShaderiv) X(glGetString) X(glGetTexImage) X(glGetUniformLocation) \
+	X(glHint) X(glLineWidth) X(glLinkProgram) X(glPolygonMode) X(glReadBuffer) \
+	X(glRenderbufferStorage) X(glShaderSource) X(glTexImage2D) X(glTexParameterfv) X(glTexParameteri) \
+	X(glTexParameteriv) X(glTexStorage2D) X(glTexSubImage2D) X(glUniform1f) X(glUniform1i) \
+	X(glUniform1iv) X(glUniform2f) X(glUniform3f) X(glUniform4f) X(glUniformMatrix3fv) \
+	X(glUniformMatrix4fv) X(glUseProgram) X(glVertexAttribDivisor) X(glVertexAttribIPointer) X(glVertexAttribPointer) \
+	X(glViewport)
+
+namespace nullgl {
+
+	namespace {
+		//## and # keep the glad macros (glViewport -> glad_glViewport) from expanding the names
+#define KOS_NULLGL_INDEX(name) k_##name,
+		enum FunctionIndex : size_t {
+			KOS_NULLGL_FUNCTIONS(KOS_NULLGL_INDEX)
+			k_FunctionCount
+		};
+#undef KOS_NULLGL_INDEX
+
+#define KOS_NULLGL_NAME(name) #name,
+		constexpr std::string_view k_FunctionNames[] = {
+			KOS_NULLGL_FUNCTIONS(KOS_NULLGL_NAME)
+		};
+#undef KOS_NULLGL_NAME
+
+		std::array<std::atomic<uint64_t>, k_FunctionCount> s_calls{};
+		std::atomic<GLuint> s_nextName{ 1 };
+		std::atomic<bool> s_installed{ false };
+
+		void Count(size_t index) {
+			s_calls[index].fetch_add(1, std::memory_order_relaxed);
+		}
+
+		//counts the call and returns a zero value of the function's return type
+		template <size_t Index, typename Pointer>
+		struct Stub;
+
+		template <size_t Index, typename Return, typename... Args>
+		struct Stub<Index, Return(APIENTRY*)(Args...)> {
+			static Return APIENTRY Call(Args...) {
+				Count(Index);
+				if constexpr (!std::is_void_v<Return>) {
+					return Return{};
+				}
+			}
+		};
+
+		template <size_t Index>
+		void APIENTRY GenNames(GLsizei count, GLuint* names) {
+			Count(Index);
+			for (GLsizei i = 0; i < count; ++i) {
+				names[i] = s_nextName.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		template <size_t Index>
+		void APIENTRY GetObjectParameter(GLuint, GLenum pname, GLint* params) {
+			Count(Index);
+			//compile and link always succeed, logs are empty
+			*params = (pname == GL_COMPILE_STATUS || pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS) ? GL_TRUE : 0;
+		}
+
+		template <size_t Index>
+		void APIENTRY GetInfoLog(GLuint, GLsizei bufSize, GLsizei* length, GLchar* infoLog) {
+			Count(Index);
+			if (length) *length = 0;
+			if (infoLog && bufSize > 0) infoLog[0] = '\0';
+		}
+
+		void APIENTRY GetIntegerv(GLenum, GLint* data) {
+			Count(k_glGetIntegerv);
+			*data = 0;
+		}
+
+		GLenum APIENTRY CheckFramebufferStatus(GLenum) {
+			Count(k_glCheckFramebufferStatus);
+			return GL_FRAMEBUFFER_COMPLETE;
+		}
+
+		const GLubyte* APIENTRY GetString(GLenum) {
+			Count(k_glGetString);
+			return reinterpret_cast<const GLubyte*>("4.6 NullGL");
+		}
+
+		GLuint APIENTRY CreateShader(GLenum) {
+			Count(k_glCreateShader);
+			return s_nextName.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		GLuint APIENTRY CreateProgram() {
+			Count(k_glCreateProgram);
+			return s_nextName.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void Install() {
+#define KOS_NULLGL_INSTALL(name) glad_##name = &Stub<k_##name, decltype(glad_##name)>::Call;
+		KOS_NULLGL_FUNCTIONS(KOS_NULLGL_INSTALL)
+#undef KOS_NULLGL_INSTALL
+
+		glad_glGenBuffers = &GenNames<k_glGenBuffers>;
+		glad_glGenFramebuffers = &GenNames<k_glGenFramebuffers>;
+		glad_glGenRenderbuffers = &GenNames<k_glGenRenderbuffers>;
+		glad_glGenTextures = &GenNames<k_glGenTextures>;
+		glad_glGenVertexArrays = &GenNames<k_glGenVertexArrays>;
+		glad_glCreateShader = &CreateShader;
+		glad_glCreateProgram = &CreateProgram;
+		glad_glGetShaderiv = &GetObjectParameter<k_glGetShaderiv>;
+		glad_glGetProgramiv = &GetObjectParameter<k_glGetProgramiv>;
+		glad_glGetShaderInfoLog = &GetInfoLog<k_glGetShaderInfoLog>;
+		glad_glGetProgramInfoLog = &GetInfoLog<k_glGetProgramInfoLog>;
+		glad_glGetIntegerv = &GetIntegerv;
+		glad_glCheckFramebufferStatus = &CheckFramebufferStatus;
+		glad_glGetString = &GetString;
+
+		s_installed.store(true, std::memory_order_release);
+	}
+
+	bool IsInstalled() {
+		return s_installed.load(std::memory_order_acquire);
+	}
+
+	uint64_t GetCallCount(std::string_view function) {
+		for (size_t i = 0; i < k_FunctionCount; ++i) {
+			if (k_FunctionNames[i] == function) {
+				return s_calls[i].load(std::memory_order_relaxed);
+			}
+		}
+		return 0;
+	}
+
+	uint64_t GetTotalCallCount() {
+		uint64_t total{};
+		for (const auto& calls : s_calls) {
+			total += calls.load(std::memory_order_relaxed);
+		}
+		return total;
+	}
+
+	std::vector<std::pair<std::string_view, uint64_t>> GetCallCounts() {
+		std::vector<std::pair<std::string_view, uint64_t>> counts;
+		for (size_t i = 0; i < k_FunctionCount; ++i) {
+			if (const uint64_t calls = s_calls[i].load(std::memory_order_relaxed)) {
+				counts.emplace_back(k_FunctionNames[i], calls);
+			}
+		}
+		std::sort(counts.begin(), counts.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+		return counts;
+	}
+
+	void ResetCallCounts() {
+		for (auto& calls : s_calls) {
+			calls.store(0, std::memory_order_relaxed);
+		}
+	}
+}
@@ -0,0 +1,39 @@
+/********************************************************************/
+/*!
+\file      NullGL.h
+\author    Gabe Ng 2301290
+\par       gabe.ng@digipen.edu
+\date      Oct 18 2026
+\brief     Null OpenGL backend for running the engine without a
+		   window or context (headless runs, tests).
+
+		   Install points every glad function the engine calls at a
+		   stub that counts the call and does nothing else.
+		   - glGen* and glCreate* hand out increasing object names
+		   - shader/program status queries report success
+		   - framebuffer status reports complete
+		   - every other query returns zero
+
+		   Install replaces whatever glad loaded, only install it when
+		   there is no real context.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#pragma once
+#include "Config/pch.h"
+
+namespace nullgl {
+
+	void Install();
+	bool IsInstalled();
+
+	//calls made to one function since the last reset, name as in the GL api eg. "glDrawElements"
+	uint64_t GetCallCount(std::string_view function);
+	uint64_t GetTotalCallCount();
+	//every function called at least once since the last reset, most called first
+	std::vector<std::pair<std::string_view, uint64_t>> GetCallCounts();
+	void ResetCallCounts();
+}
@@ -174,13 +174,18 @@ void MeshRenderer::Render(const CameraData& camera, Shader& shader)
 		{
 			shader.SetTrans("model", mesh.transformation);
 			shader.SetInt("entityID", mesh.entityID + 1);
-			mesh.meshToUse->PBRDraw(shader, mesh.meshMaterial);
+			DrawMesh(shader, mesh);
 		}
 	}
 
 
 }
 
+void MeshRenderer::DrawMesh(Shader& shader, const MeshData& mesh) const
+{
+	mesh.meshToUse->PBRDraw(shader, materialsToDraw.data() + mesh.firstMaterial, mesh.materialCount);
+}
+
 void SkinnedMeshRenderer::Render(const CameraData& camera, Shader& shader)
 {
 	shader.SetBool("isNotRigged", false);
@@ -218,34 +223,30 @@ void LightRenderer::UpdateDCM() {
 		}
 	}
 }
-void LightRenderer::RenderAllLights(const CameraData& camera, Shader& shader)
+void LightRenderer::FillLightBlock(LightBlock& block) const
 {
-	for (size_t i = 0; i < pointLightsToDraw.size(); i++)
+	//lights past the shader's array size are dropped
+	const size_t pointCount = std::min(pointLightsToDraw.size(), uniformblock::MAX_POINT_LIGHTS);
+	for (size_t i = 0; i < pointCount; i++)
 	{
-		PointLightData& pointLight = pointLightsToDraw[i];
-		if (pointLight.shadowCon) {
-			//FIll up with uniform data
-		}
-		pointLight.SetUniform(&shader, i);
-		//pointLight.SetShaderMtrx(&shader, i);
-
+		block.light[i] = pointLightsToDraw[i].ToBlock();
 	}
 
-	for (size_t i = 0; i < directionLightsToDraw.size(); i++)
+	const size_t directionalCount = std::min(directionLightsToDraw.size(), uniformblock::MAX_DIRECTIONAL_LIGHTS);
+	for (size_t i = 0; i < directionalCount; i++)
 	{
-		DirectionalLightData& directionLight = directionLightsToDraw[i];
-		directionLight.SetShaderMtrx(&shader, i);
-		directionLight.SetUniform(&shader, i);
-
+		block.directionalLight[i] = directionLightsToDraw[i].ToBlock();
 	}
 
-	for (size_t i = 0; i < spotLightsToDraw.size(); i++)
+	const size_t spotCount = std::min(spotLightsToDraw.size(), uniformblock::MAX_SPOT_LIGHTS);
+	for (size_t i = 0; i < spotCount; i++)
 	{
-		SpotLightData& spotLight = spotLightsToDraw[i];
-		//spotLight.SetShaderMtrx(&shader, i);
-		spotLight.SetUniform(&shader, i);
+		block.spotLight[i] = spotLightsToDraw[i].ToBlock();
 	}
-	//std::cout << "D LIGHT SIZE" << directionLightsToDraw.size() << '\n';
+
+	block.pointLightNo = static_cast<int32_t>(pointCount);
+	block.dirLightNo = static_cast<int32_t>(directionalCount);
+	block.spotLightNo = static_cast<int32_t>(spotCount);
 }
 void LightRenderer::DebugRender(const CameraData& camera, Shader& shader) {
 	for (size_t i = 0; i < pointLightsToDraw.size(); i++)
@@ -261,6 +262,7 @@ void MeshRenderer::Clear()
 	for (std::vector<MeshData>& md : meshesToDraw) {
 		md.clear();
 	}
+	materialsToDraw.clear();
 }
 
 void SkinnedMeshRenderer::Clear()
@@ -579,9 +581,8 @@ void ParticleRenderer::Render(const CameraData& camera, Shader& shader)
 		}
 		particlesToDraw.clear();
 	}
+	//view and projection come from the FrameBlock
 	shader.Use();
-	shader.SetTrans("projection", camera.GetPerspMtx());
-	shader.SetTrans("view", camera.GetViewMtx());
 	if (!instancedBasicParticles.empty())
 	{
 		GLenum err = glGetError();
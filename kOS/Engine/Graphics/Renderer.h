@@ -47,8 +47,11 @@ struct BasicRenderer
 struct MeshRenderer : BasicRenderer
 {
 	void Render(const CameraData& camera, Shader& shader);
+	void DrawMesh(Shader& shader, const MeshData& mesh) const;
 	void Clear() override;
 	std::array<std::vector<MeshData>, layer::MAXLAYER> meshesToDraw{};
+	//materials of every mesh this frame, owned by their R_Material
+	std::vector<const PBRMaterial*> materialsToDraw{};
 	//std::array
 };
 
@@ -108,7 +111,7 @@ struct LightRenderer : BasicRenderer
 {
 	void InitializeLightRenderer();
 	void UpdateDCM();
-	void RenderAllLights(const CameraData& camera, Shader& shader);
+	void FillLightBlock(LightBlock& block) const;
 	void DebugRender(const CameraData& camera, Shader& shader);
 	void Clear() override;
 	std::vector<PointLightData> pointLightsToDraw{};
@@ -7,6 +7,10 @@ AUTHOR(S):  Gabe (100%)
 BRIEF:      Manages to creation of shaders from file path
 			Able to use helper functions to access shader properties easily
 
+			Uniform locations are read once after the program links and
+			looked up by UniformID, a hash of the name. Setting a uniform
+			never calls glGetUniformLocation and never builds a string.
+
 All content  2024 DigiPen Institute of Technology Singapore. All
 rights reserved.
 ******************************************************************/
@@ -18,18 +22,64 @@ rights reserved.
 #include <glm/gtc/type_ptr.hpp>
 #include <unordered_map>
 #include "Debugging/Logging.h"
+
+//uniform name hashed with FNV-1a, string literals hash at compile time
+struct UniformID {
+	uint32_t hash{};
+
+	constexpr UniformID(const char* name) : hash{ Hash(std::string_view{ name }) } {}
+	constexpr UniformID(std::string_view name) : hash{ Hash(name) } {}
+	UniformID(const std::string& name) : hash{ Hash(name) } {}
+
+	//"array[index]" or "array[index].member" without building the string
+	static constexpr UniformID Element(std::string_view array, size_t index, std::string_view member = {}) {
+		char digits[20]{};
+		size_t count{};
+		do {
+			digits[count++] = static_cast<char>('0' + index % 10);
+			index /= 10;
+		} while (index > 0);
+
+		uint32_t hash = Append(k_offset, array);
+		hash = Append(hash, "[");
+		while (count > 0) {
+			hash = (hash ^ static_cast<unsigned char>(digits[--count])) * k_prime;
+		}
+		hash = Append(hash, "]");
+		if (!member.empty()) {
+			hash = Append(Append(hash, "."), member);
+		}
+		return UniformID{ hash, 0 };
+	}
+
+	static constexpr uint32_t Hash(std::string_view name) { return Append(k_offset, name); }
+
+	constexpr bool operator==(const UniformID&) const = default;
+
+private:
+	static constexpr uint32_t k_offset = 2166136261u;
+	static constexpr uint32_t k_prime = 16777619u;
+
+	constexpr UniformID(uint32_t value, int) : hash{ value } {}
+
+	static constexpr uint32_t Append(uint32_t hash, std::string_view text) {
+		for (const char c : text) {
+			hash = (hash ^ static_cast<unsigned char>(c)) * k_prime;
+		}
+		return hash;
+	}
+};
+
 class Shader {
 
 public:
 	unsigned int ID{ 0 };
-	std::unordered_map<std::string, GLint> uniformLocationCache;
-	GLint GetLocation(const std::string& ss) {
-		auto it = uniformLocationCache.find(ss);
-		if (it == uniformLocationCache.end()) {
-			uniformLocationCache[ss] = glGetUniformLocation(ID, ss.c_str());
-			return uniformLocationCache[ss];;
-		}
-		return it->second;;
+
+	//-1 for a uniform the program does not use, same as glGetUniformLocation
+	GLint GetLocation(UniformID name) const {
+		auto it = std::lower_bound(uniformLocations.begin(), uniformLocations.end(), name.hash,
+			[](const std::pair<uint32_t, GLint>& entry, uint32_t hash) { return entry.first < hash; });
+		return (it != uniformLocations.end() && it->first == name.hash) ? it->second : -1;
 	}
 
 	/************************************************************************/
@@ -116,6 +166,7 @@ public:
 			return;
 		}
 
+		CacheUniformLocations();
 		glDeleteShader(vertex);
 		glDeleteShader(fragment);
 		LOGGING_INFO("Created shader");
@@ -181,6 +232,7 @@ public:
 			return;
 		}
 
+		CacheUniformLocations();
 		glDeleteShader(vertex);
 		glDeleteShader(fragment);
 		glDeleteShader(geometry);
@@ -189,7 +241,7 @@ public:
 
 	Shader(Shader const& shad) {
 		this->ID = shad.ID;
-		this->uniformLocationCache = shad.uniformLocationCache;
+		this->uniformLocations = shad.uniformLocations;
 	}
 	/************************************************************************/
 	/*!
@@ -226,7 +278,7 @@ public:
 	\brief
 	Sets a boolean uniform variable in the shader.
 
-	\param const std::string& name
+	\param UniformID name
 	The name of the uniform variable in the shader.
 	\param bool value
 	The boolean value to set.
@@ -235,17 +287,16 @@ public:
 	NIL
 	*/
 	/************************************************************************/
-	void SetBool(const std::string& name, bool value) const
+	void SetBool(UniformID name, bool value) const
 	{
-		GLint location = glGetUniformLocation(ID, name.c_str());
-		glUniform1i(location, static_cast<int>(value));
+		glUniform1i(GetLocation(name), static_cast<int>(value));
 	};
 	/************************************************************************/
 	/*!
 	\brief
 	Sets a transformation matrix uniform in the shader.
 
-	\param const std::string& name
+	\param UniformID name
 	The name of the uniform variable in the shader.
 	\param const glm::mat4& trans
 	The transformation matrix to set.
@@ -254,15 +305,15 @@ public:
 	NIL
 	*/
 	/************************************************************************/
-	void SetTrans(const std::string& name, const glm::mat4& trans) {
+	void SetTrans(UniformID name, const glm::mat4& trans) {
 		glUniformMatrix4fv(GetLocation(name), 1, GL_FALSE, glm::value_ptr(trans));
 	}
 
-	void SetVec2(const std::string& name, const glm::vec2& vec2) {
+	void SetVec2(UniformID name, const glm::vec2& vec2) {
 		glUniform2f(GetLocation(name), vec2.x, vec2.y);
 	}
 
-	void SetVec3(const std::string& name, const glm::vec3& vec3) {
+	void SetVec3(UniformID name, const glm::vec3& vec3) {
 		glUniform3f(GetLocation(name), vec3.x, vec3.y, vec3.z);
 	}
 
@@ -271,7 +322,7 @@ public:
 	\brief
 	Sets a 4D vector uniform in the shader.
 
-	\param const std::string& name
+	\param UniformID name
 	The name of the uniform variable in the shader.
 	\param const glm::vec4& vec4
 	The 4D vector to set.
@@ -280,7 +331,7 @@ public:
 	NIL
 	*/
 	/************************************************************************/
-	void SetVec4(const std::string& name, const glm::vec4& vec4) {
+	void SetVec4(UniformID name, const glm::vec4& vec4) {
 		glUniform4f(GetLocation(name), vec4.r, vec4.g, vec4.b, vec4.a);
 	}
 	/************************************************************************/
@@ -288,7 +339,7 @@ public:
 	\brief
 	Sets an integer uniform in the shader.
 
-	\param const std::string& name
+	\param UniformID name
 	The name of the uniform variable in the shader.
 	\param int value
 	The integer value to set.
@@ -297,7 +348,7 @@ public:
 	NIL
 	*/
 	/************************************************************************/
-	void SetInt(const std::string& name, int value) {
+	void SetInt(UniformID name, int value) {
 		glUniform1i(GetLocation(name), value);
 	}
 	/************************************************************************/
@@ -305,7 +356,7 @@ public:
 	\brief
 	Sets a float uniform in the shader.
 
-	\param const std::string& name
+	\param UniformID name
 	The name of the uniform variable in the shader.
 	\param float value
 	The float value to set.
@@ -314,24 +365,63 @@ public:
 	NIL
 	*/
 	/************************************************************************/
-	void SetFloat(const std::string& name, float value) {
+	void SetFloat(UniformID name, float value) {
 		glUniform1f(GetLocation(name), value);
 	}
 
-	void SetMat4(const std::string& name, const glm::mat4& value) {
+	void SetMat4(UniformID name, const glm::mat4& value) {
 		glUniformMatrix4fv(GetLocation(name), 1, GL_FALSE, glm::value_ptr(value));
 	}
 
-	void SetMat4Array(const std::string& name, const glm::mat4& value, size_t arraySize) {
+	void SetMat4Array(UniformID name, const glm::mat4& value, size_t arraySize) {
 		glUniformMatrix4fv(GetLocation(name), static_cast<GLsizei>(arraySize), GL_FALSE, glm::value_ptr(value));
 	}
 
-	void SetMat3(const std::string& name, const glm::mat3& value) {
+	void SetMat3(UniformID name, const glm::mat3& value) {
 		glUniformMatrix3fv(GetLocation(name), 1, GL_FALSE, glm::value_ptr(value));
 	}
 
-	void SetIntArray(const std::string& name, int* values, int count) {
+	void SetIntArray(UniformID name, int* values, int count) {
 		glUniform1iv(GetLocation(name), count, values);
 	}
+
+private:
+	//sorted by hash
+	std::vector<std::pair<uint32_t, GLint>> uniformLocations;
+
+	void AddUniformLocation(std::string_view name, GLint location) {
+		if (location < 0) return;
+		uniformLocations.emplace_back(UniformID::Hash(name), location);
+	}
+
+	//called once the program linked, uniforms inside blocks have no location and are skipped
+	void CacheUniformLocations() {
+		uniformLocations.clear();
+		GLint uniformCount{}, maxNameLength{};
+		glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &uniformCount);
+		glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+		std::string name(static_cast<size_t>(std::max(maxNameLength, 1)), '\0');
+		for (GLint i = 0; i < uniformCount; ++i) {
+			GLsizei length{};
+			GLint size{};
+			GLenum type{};
+			glGetActiveUniform(ID, static_cast<GLuint>(i), static_cast<GLsizei>(name.size()), &length, &size, &type, name.data());
+			const std::string_view uniformName{ name.data(), static_cast<size_t>(length) };
+			AddUniformLocation(uniformName, glGetUniformLocation(ID, name.c_str()));
+
+			//arrays are listed once as "name[0]", the plain name and every element are looked up too
+			if (size > 1 && uniformName.ends_with("[0]")) {
+				const std::string arrayName{ uniformName.substr(0, uniformName.size() - 3) };
+				AddUniformLocation(arrayName, glGetUniformLocation(ID, arrayName.c_str()));
+				for (GLint element = 1; element < size; ++element) {
+					const std::string elementName = arrayName + "[" + std::to_string(element) + "]";
+					AddUniformLocation(elementName, glGetUniformLocation(ID, elementName.c_str()));
+				}
+			}
+		}
+		std::sort(uniformLocations.begin(), uniformLocations.end());
+		uniformLocations.erase(std::unique(uniformLocations.begin(), uniformLocations.end()), uniformLocations.end());
+	}
 };
 #endif // ! SHADER_H
@@ -0,0 +1,127 @@
+/********************************************************************/
+/*!
+\file      UniformBlocks.h
+\author    Gabe Ng 2301290
+\par       gabe.ng@digipen.edu
+\date      Oct 18 2026
+\brief     Uniform buffers for the data every engine shader shares,
+		   uploaded once per camera pass instead of set on each shader.
+		   - FrameBlock, binding 0: projection, view and camera position
+		   - LightBlock, binding 1: every light drawn this frame
+
+		   The structs are laid out by hand to match std140, the GLSL
+		   declarations are in the shaders that use them and have to be
+		   kept in the same order.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#pragma once
+#include "GraphicsReferences.h"
+
+namespace uniformblock {
+	constexpr GLuint FRAME_BINDING = 0;
+	constexpr GLuint LIGHT_BINDING = 1;
+
+	//array sizes declared in the shaders
+	constexpr size_t MAX_POINT_LIGHTS = 32;
+	constexpr size_t MAX_DIRECTIONAL_LIGHTS = 10;
+	constexpr size_t MAX_SPOT_LIGHTS = 32;
+}
+
+//std140: a vec3 takes 16 bytes unless a float follows it, bools are 4 bytes
+struct FrameBlock {
+	glm::mat4 projection{ 1.f };
+	glm::mat4 view{ 1.f };
+	glm::vec3 cameraPosition{};
+	float padding{};
+};
+static_assert(sizeof(FrameBlock) == 144);
+
+struct PointLightBlock {
+	glm::vec3 position{};
+	float linear{};
+	glm::vec3 color{};
+	float quadratic{};
+	glm::vec3 La{};
+	float radius{};
+	glm::vec3 Ld{};
+	float intensity{};
+	glm::vec3 Ls{};
+	uint32_t shadowCon{};
+	uint32_t bakedCon{};
+	float padding[3]{};
+};
+static_assert(sizeof(PointLightBlock) == 96);
+
+struct DirectionalLightBlock {
+	glm::mat4 shadowMtx{ 1.f };
+	glm::vec3 direction{};
+	float intensity{};
+	glm::vec3 color{};
+	float padding0{};
+	glm::vec3 La{};
+	float padding1{};
+	glm::vec3 Ld{};
+	float padding2{};
+	glm::vec3 Ls{};
+	float padding3{};
+};
+static_assert(sizeof(DirectionalLightBlock) == 144);
+
+struct SpotLightBlock {
+	glm::vec3 position{};
+	float linear{};
+	glm::vec3 color{};
+	float quadratic{};
+	glm::vec3 La{};
+	float radius{};
+	glm::vec3 Ld{};
+	float cutOff{};
+	glm::vec3 Ls{};
+	float outerCutOff{};
+	glm::vec3 direction{};
+	float intensity{};
+};
+static_assert(sizeof(SpotLightBlock) == 96);
+
+struct LightBlock {
+	PointLightBlock light[uniformblock::MAX_POINT_LIGHTS]{};
+	DirectionalLightBlock directionalLight[uniformblock::MAX_DIRECTIONAL_LIGHTS]{};
+	SpotLightBlock spotLight[uniformblock::MAX_SPOT_LIGHTS]{};
+	glm::vec3 lightAmbience{};
+	int32_t pointLightNo{};
+	int32_t dirLightNo{};
+	int32_t spotLightNo{};
+	float padding[2]{};
+};
+static_assert(sizeof(LightBlock) % 16 == 0);
+
+//one buffer bound to its binding point for the lifetime of the context
+template <typename T>
+class UniformBuffer {
+public:
+	void Initialize(GLuint binding) {
+		glGenBuffers(1, &m_buffer);
+		glBindBuffer(GL_UNIFORM_BUFFER, m_buffer);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(T), nullptr, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, binding, m_buffer);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	void Upload(const T& data) {
+		glBindBuffer(GL_UNIFORM_BUFFER, m_buffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(T), &data);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	void Delete() {
+		if (m_buffer) glDeleteBuffers(1, &m_buffer);
+		m_buffer = 0;
+	}
+
+private:
+	GLuint m_buffer{};
+};
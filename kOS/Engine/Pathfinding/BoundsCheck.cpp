@@ -10,7 +10,7 @@ namespace Octrees {
 		max = boundMax;
 	}
 
-	bool Bounds::Intersects(Bounds otherBounds) {
+	bool Bounds::Intersects(Bounds otherBounds) const {
 		return ((std::abs(center.x - otherBounds.center.x) < (size.x + otherBounds.size.x)) &&
 			(std::abs(center.y - otherBounds.center.y) < (size.y + otherBounds.size.y)) &&
 			(std::abs(center.z - otherBounds.center.z) < (size.z + otherBounds.size.z)));
@@ -23,7 +23,7 @@ namespace Octrees {
 		//size = (max - min);
 	}
 
-	bool Bounds::Contains(glm::vec3 point) {
+	bool Bounds::Contains(glm::vec3 point) const {
 		//glm::vec3 d = point - center;
 
 		//glm::vec3 rotationInDegrees(rotation);
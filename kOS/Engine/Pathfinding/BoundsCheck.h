@@ -13,9 +13,9 @@ namespace Octrees {
 
 		glm::vec3 center, size, min, max;
 
-		bool Intersects(Bounds otherBounds);
+		bool Intersects(Bounds otherBounds) const;
 		void SetMinMax(glm::vec3 _min, glm::vec3 _max);
-		bool Contains(glm::vec3 point);
+		bool Contains(glm::vec3 point) const;
 	};
 }
 
@@ -17,233 +17,314 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Graph.h"
 #include "OctreeGrid.h"
 
-#include <queue>
-
 namespace Octrees {
-	int Node::nextNodeId = 0;
 
-	Node::Node() {
-		id = -1;
+	void IndexedHeap::Reset(size_t nodeCount) {
+		if (m_slot.size() != nodeCount) {
+			m_slot.assign(nodeCount, INVALID_NODE);
+			m_key.resize(nodeCount);
+		}
+		else {
+			//a search that stopped early leaves nodes behind
+			for (const NodeIndex node : m_heap) m_slot[node] = INVALID_NODE;
+		}
+		m_heap.clear();
 	}
 
-	Node::Node(OctreeNode _octreeNode) {
-		id = nextNodeId++;
-		octreeNode = _octreeNode;
-		fromID = -1;
-	}
+	void IndexedHeap::Push(NodeIndex node, float key) {
+		if (Contains(node)) {
+			//only ever called with a cheaper path
+			m_key[node] = key;
+			SiftUp(m_slot[node]);
+			return;
+		}
 
-	//Edge& Edge::operator=(Edge const& other) {
-	//	if (other.a != nullptr && other.b != nullptr) {
-	//		a = new Node(*other.a);
-	//		b = new Node(*other.b);
-	//	}
-	//	else {
-	//		a = nullptr;
-	//		b = nullptr;
-	//	}
+		m_key[node] = key;
+		m_slot[node] = static_cast<NodeIndex>(m_heap.size());
+		m_heap.push_back(node);
+		SiftUp(m_heap.size() - 1);
+	}
 
-	//	return *this;
-	//}
+	NodeIndex IndexedHeap::Pop() {
+		const NodeIndex top = m_heap.front();
+		Swap(0, m_heap.size() - 1);
+		m_heap.pop_back();
+		m_slot[top] = INVALID_NODE;
+		if (!m_heap.empty()) SiftDown(0);
+		return top;
+	}
 
-	//Edge::~Edge() {
-	//	if(a)
-	//		delete a;
+	void IndexedHeap::SiftUp(size_t slot) {
+		while (slot > 0) {
+			const size_t parent = (slot - 1) / 2;
+			if (m_key[m_heap[parent]] <= m_key[m_heap[slot]]) break;
+			Swap(parent, slot);
+			slot = parent;
+		}
+	}
 
-	//	if (b)
-	//		delete b;
-	//}
+	void IndexedHeap::SiftDown(size_t slot) {
+		const size_t size = m_heap.size();
+		while (true) {
+			const size_t left = slot * 2 + 1;
+			const size_t right = left + 1;
+			size_t smallest = slot;
+			if (left < size && m_key[m_heap[left]] < m_key[m_heap[smallest]]) smallest = left;
+			if (right < size && m_key[m_heap[right]] < m_key[m_heap[smallest]]) smallest = right;
+			if (smallest == slot) break;
+			Swap(slot, smallest);
+			slot = smallest;
+		}
+	}
 
-	bool Node::operator==(Node const& other) const {
-		return id == other.id;
+	void IndexedHeap::Swap(size_t first, size_t second) {
+		std::swap(m_heap[first], m_heap[second]);
+		m_slot[m_heap[first]] = static_cast<NodeIndex>(first);
+		m_slot[m_heap[second]] = static_cast<NodeIndex>(second);
 	}
 
-	bool Node::operator==(Node* other) const {
-		return id == other->id;
+	void SearchState::Reset(size_t nodeCount) {
+		if (g.size() != nodeCount) {
+			g.resize(nodeCount);
+			from.resize(nodeCount);
+		}
+		const size_t words = (nodeCount + 63) / 64;
+		visited.assign(words, 0);
+		closed.assign(words, 0);
+		goals.assign(words, 0);
+		open.Reset(nodeCount);
 	}
 
-	bool Edge::operator==(Edge const& other) const {
-		return ((a == other.a && b == other.b) || (b == other.a && a == other.b));
+	void Graph::Clear() {
+		nodeCenters.clear();
+		nodeOctreeIDs.clear();
+		edgeOffsets.clear();
+		edgeTargets.clear();
+		edgeCosts.clear();
+		pathList.clear();
+		m_pendingEdges.clear();
+		m_octreeToNode.clear();
 	}
 
 	int Graph::GetPathLength() {
 		return static_cast<int>(pathList.size());
 	}
 
-	OctreeNode Graph::GetPathNode(int index) {
-		if (pathList.empty()) {
-			return OctreeNode();
-		}
-
-		if (index < 0 || index >= pathList.size()) {
-			return OctreeNode();
+	glm::vec3 Graph::GetPathPosition(int index) {
+		if (index < 0 || index >= static_cast<int>(pathList.size())) {
+			return glm::vec3{ 0.f };
 		}
 
-		return pathList[index].octreeNode;
+		return nodeCenters[pathList[index]];
 	}
 
-	const int maxIterations = 1000;
-
-	bool Graph::AStar(OctreeNode* startNode, OctreeNode* endNode) {
+	bool Graph::AStar(const OctreeNode* startNode, const OctreeNode* endNode) {
 		// Reset path list at the start whenever trying to evaluate another path.
 		pathList.clear();
 
-		Node* start = FindNode(startNode);
-		Node* end = FindNode(endNode);
+		if (!startNode || !endNode) {
+			return false;
+		}
 
-		if (!start || !end) {
+		const NodeIndex start = FindNode(startNode);
+		const NodeIndex end = FindNode(endNode);
+		if (start == INVALID_NODE || end == INVALID_NODE) {
 			return false;
 		}
 
-		std::multiset<Node, CompareNode> openSet;
-		std::vector<Node> closedSet;
+		if (!AStar(start, end, m_state, pathList)) {
+			return false;
+		}
 
-		// The iteration count for when this number increases pass the max iteration and stops the algorithm.
-		int iterationCount = 0;
+		//the start node is where the pathfinder already is
+		pathList.erase(pathList.begin());
+		return true;
+	}
 
-		// Calculate the current node's g, h and f cost.
-		start->g = 0;
-		start->h = Heuristic(*start, *end);
-		start->f = start->g + start->h;
-		start->fromID = -1;
-		openSet.insert(*start);
+	bool Graph::AStar(NodeIndex start, NodeIndex end, SearchState& state, std::vector<NodeIndex>& path) const {
+		path.clear();
 
-		Node *neighbour, current;
-		int testtest = 0;
-		while (openSet.size()) {
-			// Max iterations reached, abort algorithm.
-			std::cout << "PATHFIND LOOP: " << testtest++ << std::endl;
-			if (++iterationCount > maxIterations) {
-				return false;
-			}
+		const size_t nodeCount = NodeCount();
+		if (start >= nodeCount || end >= nodeCount || edgeOffsets.size() != nodeCount + 1) {
+			return false;
+		}
 
-			Node smallestFCostNode = *openSet.begin();
-			for (Node nod : openSet) {
-				if (nod.f < smallestFCostNode.f) {
-					smallestFCostNode = nod;
-				}
-			}
+		state.Reset(nodeCount);
+
+		// Calculate the start node's g and f cost.
+		state.g[start] = 0.f;
+		state.from[start] = INVALID_NODE;
+		SearchState::Set(state.visited, start);
+		state.open.Push(start, Heuristic(start, end));
 
-			current = (*openSet.begin());
-			openSet.erase(openSet.begin());
+		while (!state.open.Empty()) {
+			const NodeIndex current = state.open.Pop();
 
 			// If current node is the end node, path is found.
 			if (current == end) {
-				std::cout << "PATH FOUND\n";
-				ReconstructPath(current);
+				for (NodeIndex node = end; node != INVALID_NODE; node = state.from[node]) {
+					path.push_back(node);
+				}
+				std::reverse(path.begin(), path.end());
 				return true;
 			}
 
-			closedSet.push_back(current);
+			SearchState::Set(state.closed, current);
+
+			for (uint32_t edge = edgeOffsets[current]; edge < edgeOffsets[current + 1]; ++edge) {
+				const NodeIndex neighbour = edgeTargets[edge];
+				if (SearchState::Test(state.closed, neighbour)) {
+					continue;
+				}
 
-			for (Edge edge : current.edges) {
-				neighbour = ((edge.a) == current) ? (edge.b) : (edge.a);
-				auto closedSetIt = std::find(closedSet.begin(), closedSet.end(), neighbour);
-				if (closedSetIt != closedSet.end()) {
+				const float tentative_gCost = state.g[current] + edgeCosts[edge];
+				if (SearchState::Test(state.visited, neighbour) && tentative_gCost >= state.g[neighbour]) {
 					continue;
 				}
 
-				float tentative_gCost = current.g + Heuristic(current, *neighbour);
-				auto openSetIt = std::find(openSet.begin(), openSet.end(), neighbour);
-
-				if (tentative_gCost < neighbour->g || openSetIt == openSet.end()) {
-					neighbour->g = tentative_gCost;
-					neighbour->h = Heuristic(*neighbour, *end);
-					neighbour->f = neighbour->g + neighbour->h;
-					neighbour->fromID = current.id;
-
-					// I HAVE TO OPTIZMIE THIS NEXT TIME
-					for (Node node : nodes) {
-						if (node.id == neighbour->id) {
-							node.fromID = current.id;
-						}
-					}
-
-					//if (neighbour) {
-					//	std::cout << "YES NEIGHBOUR\n";
-					//}
-					//else {
-					//	std::cout << "NO NEIGHBOUR\n";
-					//}
-					openSet.insert(*neighbour);
- 				}
+				SearchState::Set(state.visited, neighbour);
+				state.g[neighbour] = tentative_gCost;
+				state.from[neighbour] = current;
+				state.open.Push(neighbour, tentative_gCost + Heuristic(neighbour, end));
 			}
 		}
 
-		std::cout << "NO PATH FOUND\n";
 		return false;
 	}
 
-	void Graph::ReconstructPath(Node current) {
-		while (current.fromID != -1) {
-			pathList.push_back(current);
-			//current = current->from;
-			// I HAVE TO OPTIMIZAE THIS NEXT TIE
-			for (Node node : nodes) {
-				if (node.id == current.fromID) {
-					current = node;
-					break;
-				}
+	size_t Graph::SearchTree(NodeIndex root, const std::vector<NodeIndex>& goals, SearchState& state) const {
+		const size_t nodeCount = NodeCount();
+		if (root >= nodeCount || edgeOffsets.size() != nodeCount + 1) {
+			return 0;
+		}
+
+		state.Reset(nodeCount);
+
+		size_t remaining{};
+		for (const NodeIndex goal : goals) {
+			if (goal < nodeCount && !SearchState::Test(state.goals, goal)) {
+				SearchState::Set(state.goals, goal);
+				++remaining;
 			}
 		}
 
-		std::reverse(pathList.begin(), pathList.end());
-	}
+		state.g[root] = 0.f;
+		state.from[root] = INVALID_NODE;
+		SearchState::Set(state.visited, root);
+		state.open.Push(root, 0.f);
+
+		//no heuristic, there is no single goal to aim for
+		size_t reached{};
+		while (!state.open.Empty() && reached < remaining) {
+			const NodeIndex current = state.open.Pop();
+			SearchState::Set(state.closed, current);
+			if (SearchState::Test(state.goals, current)) {
+				++reached;
+			}
 
-	float Graph::Heuristic(Node const& a, Node const& b) {
-		float result = glm::length2(a.octreeNode.bounds.center - b.octreeNode.bounds.center);
-		return result;
-	}
+			for (uint32_t edge = edgeOffsets[current]; edge < edgeOffsets[current + 1]; ++edge) {
+				const NodeIndex neighbour = edgeTargets[edge];
+				if (SearchState::Test(state.closed, neighbour)) {
+					continue;
+				}
+
+				const float tentative_gCost = state.g[current] + edgeCosts[edge];
+				if (SearchState::Test(state.visited, neighbour) && tentative_gCost >= state.g[neighbour]) {
+					continue;
+				}
 
-	void Graph::AddNode(OctreeNode _octreeNode) {
-		for (Node node : nodes) {
-			if (node.octreeNode.id == _octreeNode.id) {
-				return;
+				SearchState::Set(state.visited, neighbour);
+				state.g[neighbour] = tentative_gCost;
+				state.from[neighbour] = current;
+				state.open.Push(neighbour, tentative_gCost);
 			}
 		}
 
-		Node nodeToPush(_octreeNode);
+		return reached;
+	}
 
-		nodes.push_back(nodeToPush);
+	void Graph::GetPathToRoot(NodeIndex goal, const SearchState& state, std::vector<NodeIndex>& path) {
+		path.clear();
+		if (goal >= state.g.size() || !SearchState::Test(state.closed, goal)) {
+			return;
+		}
+
+		for (NodeIndex node = goal; node != INVALID_NODE; node = state.from[node]) {
+			path.push_back(node);
+		}
 	}
 
-	void Graph::AddEdge(OctreeNode* a, OctreeNode* b) {
-		Node* nodeA = FindNode(a);
-		Node* nodeB = FindNode(b);
+	float Graph::Heuristic(NodeIndex a, NodeIndex b) const {
+		//straight line distance, same measure as the edge costs so the search stays optimal
+		return glm::distance(nodeCenters[a], nodeCenters[b]);
+	}
 
-		if (!nodeA || !nodeB) {
-			//std::cout << "ADDING EDGE: NULL\n";
-			return;
+	NodeIndex Graph::AddNode(const OctreeNode& _octreeNode) {
+		const auto it = m_octreeToNode.find(_octreeNode.id);
+		if (it != m_octreeToNode.end()) {
+			return it->second;
 		}
 
-		Edge edge(nodeA, nodeB);
+		const NodeIndex index = static_cast<NodeIndex>(nodeCenters.size());
+		nodeCenters.push_back(_octreeNode.bounds.center);
+		nodeOctreeIDs.push_back(_octreeNode.id);
+		m_octreeToNode[_octreeNode.id] = index;
+		return index;
+	}
 
-		auto it = std::find(edges.begin(), edges.end(), edge);
-		if (it != edges.end()) {
-			//std::cout << "ADDING EDGE: ALREADY EXISTS\n";
+	void Graph::AddEdge(NodeIndex a, NodeIndex b) {
+		if (a == b || a >= NodeCount() || b >= NodeCount()) {
 			return;
 		}
 
-		edges.push_back(edge);
+		m_pendingEdges.emplace_back(a, b);
+		m_pendingEdges.emplace_back(b, a);
+	}
+
+	void Graph::Build() {
+		std::sort(m_pendingEdges.begin(), m_pendingEdges.end());
+		m_pendingEdges.erase(std::unique(m_pendingEdges.begin(), m_pendingEdges.end()), m_pendingEdges.end());
+
+		const size_t nodeCount = NodeCount();
+		edgeOffsets.assign(nodeCount + 1, 0);
+		edgeTargets.resize(m_pendingEdges.size());
+		edgeCosts.resize(m_pendingEdges.size());
 
-		nodeA->edges.push_back(edge);
-		nodeB->edges.push_back(edge);
+		//edges are sorted by source so each node's range is already contiguous
+		for (const auto& [source, target] : m_pendingEdges) {
+			++edgeOffsets[source + 1];
+		}
+		for (size_t i = 0; i < nodeCount; ++i) {
+			edgeOffsets[i + 1] += edgeOffsets[i];
+		}
+		for (size_t i = 0; i < m_pendingEdges.size(); ++i) {
+			const auto& [source, target] = m_pendingEdges[i];
+			edgeTargets[i] = target;
+			edgeCosts[i] = glm::distance(nodeCenters[source], nodeCenters[target]);
+		}
+
+		m_pendingEdges.clear();
+		m_pendingEdges.shrink_to_fit();
 	}
 
-	Node* Graph::FindNode(OctreeNode* _octreeNode) {
-		//std::cout << "RUNNING FIND NODE\n";
-		for (Node& node : nodes) {
-			if (node.octreeNode.id == _octreeNode->id) {
-				return &node;
-			}
+	NodeIndex Graph::FindNode(const OctreeNode* _octreeNode) const {
+		if (!_octreeNode) {
+			return INVALID_NODE;
+		}
+
+		if (_octreeNode->graphIndex >= 0 && static_cast<size_t>(_octreeNode->graphIndex) < NodeCount()
+			&& nodeOctreeIDs[_octreeNode->graphIndex] == _octreeNode->id) {
+			return static_cast<NodeIndex>(_octreeNode->graphIndex);
 		}
 
-		return nullptr;
+		const auto it = m_octreeToNode.find(_octreeNode->id);
+		return it != m_octreeToNode.end() ? it->second : INVALID_NODE;
 	}
 
 	void Graph::DrawGraph(GraphicsManager* gm) {
-		for (Node node : nodes) {
+		for (const glm::vec3& center : nodeCenters) {
 			glm::mat4 model{ 1.f };
-			model = glm::translate(model, node.octreeNode.bounds.center) * glm::scale(model, { 0.3f, 0.3f, 0.3f });
+			model = glm::translate(model, center) * glm::scale(model, { 0.3f, 0.3f, 0.3f });
 			BasicDebugData basicDebug;
 			basicDebug.color = glm::vec3(1, 1, 0);
 			basicDebug.worldTransform = model;
@@ -251,4 +332,4 @@ namespace Octrees {
 		}
 	}
 
-}
\ No newline at end of file
+}
@@ -9,6 +9,12 @@
 \brief     This file contains the list of nodes and edges to access
 			and determine the most optimized path through AStar.
 
+			Nodes are stored by dense index, edges are stored as a
+			compressed sparse row (CSR) array so the neighbours of a
+			node are one contiguous range. Searches keep their open
+			list and closed/visited state in a SearchState so the
+			graph itself is read only while searching.
+
 
 Copyright (C) 2025 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -25,70 +31,105 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "OctreeNode.h"
 
 namespace Octrees {
-	struct Edge; 
-
-	struct Node {
-		static int nextNodeId;
-		int id;
 
-		float f = 0.f, g = 0.f, h = 0.f;
-		//Node* from;
-		int fromID = -1;
-
-		std::vector<Edge> edges;
-		OctreeNode octreeNode;
+	using NodeIndex = uint32_t;
+	constexpr NodeIndex INVALID_NODE = std::numeric_limits<NodeIndex>::max();
+
+	/******************************************************************/
+	/*!
+	\class     IndexedHeap
+	\brief     Binary min heap of node indices keyed by f cost. Every
+			   node remembers its heap slot so a cheaper path found
+			   later is a decrease key instead of a duplicate entry.
+	*/
+	/******************************************************************/
+	class IndexedHeap {
+	public:
+		void Reset(size_t nodeCount);
+		bool Empty() const { return m_heap.empty(); }
+		bool Contains(NodeIndex node) const { return m_slot[node] != INVALID_NODE; }
+
+		//inserts the node or lowers its key if it is already in the heap
+		void Push(NodeIndex node, float key);
+		NodeIndex Pop();
+
+	private:
+		void SiftUp(size_t slot);
+		void SiftDown(size_t slot);
+		void Swap(size_t first, size_t second);
+
+		std::vector<NodeIndex> m_heap;
+		std::vector<float> m_key;			// by node
+		std::vector<NodeIndex> m_slot;		// by node, INVALID_NODE when not in the heap
+	};
 
-		Node();
-		Node(OctreeNode _octreeNode);
-		bool operator==(Node const& other) const;
-		bool operator==(Node* other) const;
+	/******************************************************************/
+	/*!
+	\class     SearchState
+	\brief     Per query scratch memory. Only the bitsets are cleared
+			   between queries, g and from are valid for visited
+			   nodes. One state per thread lets queries run in
+			   parallel on the same graph.
+	*/
+	/******************************************************************/
+	struct SearchState {
+		std::vector<float> g;
+		std::vector<NodeIndex> from;
+		std::vector<uint64_t> visited;
+		std::vector<uint64_t> closed;
+		std::vector<uint64_t> goals;
+		IndexedHeap open;
+
+		void Reset(size_t nodeCount);
+
+		static bool Test(const std::vector<uint64_t>& bits, NodeIndex node) { return (bits[node >> 6] >> (node & 63)) & 1u; }
+		static void Set(std::vector<uint64_t>& bits, NodeIndex node) { bits[node >> 6] |= uint64_t{ 1 } << (node & 63); }
 	};
 
-	struct Edge {
-		//Node a, b;
-		Node* a, *b;
+	struct Graph {
+		//node data by dense index
+		std::vector<glm::vec3> nodeCenters;
+		std::vector<int> nodeOctreeIDs;
 
-		//Edge& operator=(Edge const& other);
-		bool operator==(Edge const& other) const;
+		//CSR adjacency, neighbours of n are edgeTargets[edgeOffsets[n] .. edgeOffsets[n + 1])
+		std::vector<uint32_t> edgeOffsets;
+		std::vector<NodeIndex> edgeTargets;
+		std::vector<float> edgeCosts;
 
-		//~Edge();
-	};
+		//result of the last AStar(OctreeNode*, OctreeNode*) call
+		std::vector<NodeIndex> pathList;
 
-	struct Graph {
-		std::vector<Edge> edges;
-		std::vector<Node> nodes;
-		
+		void Clear();
+
+		NodeIndex AddNode(const OctreeNode& _octreeNode);
+		//edges are collected and turned into CSR by Build, duplicates are removed there
+		void AddEdge(NodeIndex a, NodeIndex b);
+		void Build();
 
-		std::vector<Node> pathList;
+		size_t NodeCount() const { return nodeCenters.size(); }
+		size_t EdgeCount() const { return edgeTargets.size() / 2; }
+		NodeIndex FindNode(const OctreeNode* _octreeNode) const;
 
 		int GetPathLength();
-		OctreeNode GetPathNode(int index);
+		glm::vec3 GetPathPosition(int index);
 
-		bool AStar(OctreeNode* startNode, OctreeNode* endNode);
-		bool AStarGround(OctreeNode* startNode, OctreeNode* endNode);
-		void ReconstructPath(Node current);
-		float Heuristic(Node const& a, Node const& b);
+		bool AStar(const OctreeNode* startNode, const OctreeNode* endNode);
+		//thread safe as long as every caller has its own state, path is start to end inclusive
+		bool AStar(NodeIndex start, NodeIndex end, SearchState& state, std::vector<NodeIndex>& path) const;
+		float Heuristic(NodeIndex a, NodeIndex b) const;
 
-		void AddNode(OctreeNode _octreeNode);
-		//void AddEdge(OctreeNode a, OctreeNode b);
-		void AddEdge(OctreeNode* a, OctreeNode* b);
-		//Node* FindNode(OctreeNode _octreeNode);
-		Node* FindNode(OctreeNode* _octreeNode);
+		//shortest path tree grown from root until every goal is reached, used when many agents share a target.
+		//returns the number of goals reached, GetPathToRoot then walks from a reached goal back to the root
+		size_t SearchTree(NodeIndex root, const std::vector<NodeIndex>& goals, SearchState& state) const;
+		static void GetPathToRoot(NodeIndex goal, const SearchState& state, std::vector<NodeIndex>& path);
 
 		void DrawGraph(GraphicsManager* gm);
 
-		//struct CompareNode {
-		//	bool operator()(Node* a, Node* b) const {
-		//		return a->f < b->f;
-		//	}
-		//};
-
-		struct CompareNode {
-			bool operator()(Node const& a, Node const& b) const {
-				return a.f < b.f;
-			}
-		};
+	private:
+		std::vector<std::pair<NodeIndex, NodeIndex>> m_pendingEdges;
+		std::unordered_map<int, NodeIndex> m_octreeToNode;
+		SearchState m_state;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
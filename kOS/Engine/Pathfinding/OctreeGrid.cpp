@@ -27,39 +27,41 @@ namespace Octrees {
 		m_ecs = ecs;
 		graph = _graph;
 
-		graph.nodes.reserve(1000);
-
 		CalculateBounds();
 		CreateTree(minNodeSize);
-		GetEmptyLeaves(&root);
+		BuildGraph();
+	}
+
+	void Octree::Build(Bounds _bounds, float minNodeSize, const std::vector<OctreeObject>& obstacles) {
+		bounds = _bounds;
+		root = OctreeNode(bounds, minNodeSize);
+		for (OctreeObject obstacle : obstacles) {
+			root.Divide(std::move(obstacle));
+		}
+		BuildGraph();
+	}
 
+	void Octree::BuildGraph() {
+		graph.Clear();
+		emptyLeaves.clear();
+
+		GetEmptyLeaves(&root);
 		GetEdges();
+		graph.Build();
 	}
 
 	void Octree::GetEmptyLeaves(OctreeNode* node) {
-		if (node->IsLeaf() && !node->objects.size()) {
+		if (node->IsEmptyLeaf()) {
+			node->graphIndex = static_cast<int>(graph.AddNode(*node));
 			emptyLeaves.push_back(*node);
-			graph.AddNode(*node);
 
 			return;
 		}
 
-		if (node->children.empty()) {
-			return;
-		}
-
+		//siblings touch each other, the neighbour query in GetEdges already links them
 		for (OctreeNode& child : node->children) {
 			GetEmptyLeaves(&child);
 		}
-
-		for (int i = 0; i < node->children.size(); ++i) {
-			for (int j = i + 1; j < node->children.size(); ++j) {
-				if (i == j)
-					continue;
-
-				graph.AddEdge(&node->children[i], &node->children[j]);
-			}
-		}
 	}
 
 	void Octree::CreateTree(float minNodeSize) {
@@ -139,38 +141,84 @@ namespace Octrees {
 	}
 
 	void Octree::GetEdges() {
-		for (OctreeNode leaf : emptyLeaves) {
-			for (OctreeNode otherLeaf : emptyLeaves) {
-				if (leaf == otherLeaf)
-					continue;
-
-				Bounds otherBounds = otherLeaf.bounds;
-				otherBounds.size *= 1.1f;
-					if (leaf.bounds.Intersects(otherBounds)) {
-					graph.AddEdge(&leaf, &otherLeaf);
+		std::vector<NodeIndex> neighbours;
+		for (const OctreeNode& leaf : emptyLeaves) {
+			neighbours.clear();
+			GetNeighbours(leaf, neighbours);
+
+			const NodeIndex leafIndex = static_cast<NodeIndex>(leaf.graphIndex);
+			for (const NodeIndex neighbour : neighbours) {
+				//the pair is found from both sides, add it once
+				if (leafIndex < neighbour) {
+					graph.AddEdge(leafIndex, neighbour);
 				}
 			}
 		}
 	}
 
-	OctreeNode Octree::FindClosestNode(glm::vec3 position) {
-		return FindClosestNode(root, position);
+	void Octree::GetNeighbours(const OctreeNode& leaf, std::vector<NodeIndex>& neighbours) const {
+		//same test as comparing every pair of leaves, either leaf grown by 10% overlapping the other
+		auto touches = [](const Bounds& a, const Bounds& b) {
+			Bounds grownA = a, grownB = b;
+			grownA.size *= 1.1f;
+			grownB.size *= 1.1f;
+			return a.Intersects(grownB) || b.Intersects(grownA);
+		};
+
+		//a node can only hold a touching leaf if the leaf grown by 10% of the larger size overlaps it
+		auto mayContain = [](const Bounds& a, const Bounds& node) {
+			const glm::vec3 slack = glm::max(a.size, node.size) * 0.1f;
+			const glm::vec3 distance = glm::abs(a.center - node.center);
+			return distance.x < a.size.x + node.size.x + slack.x &&
+				distance.y < a.size.y + node.size.y + slack.y &&
+				distance.z < a.size.z + node.size.z + slack.z;
+		};
+
+		std::vector<const OctreeNode*> stack{ &root };
+		while (!stack.empty()) {
+			const OctreeNode* node = stack.back();
+			stack.pop_back();
+
+			if (node->IsLeaf()) {
+				if (node->graphIndex >= 0 && node->id != leaf.id && touches(leaf.bounds, node->bounds)) {
+					neighbours.push_back(static_cast<NodeIndex>(node->graphIndex));
+				}
+				continue;
+			}
+
+			for (const OctreeNode& child : node->children) {
+				if (child.id != -1 && mayContain(leaf.bounds, child.bounds)) {
+					stack.push_back(&child);
+				}
+			}
+		}
 	}
 
-	OctreeNode Octree::FindClosestNode(OctreeNode node, glm::vec3 position) {
-		OctreeNode foundNode;
+	const OctreeNode* Octree::FindClosestNode(glm::vec3 position) const {
+		const OctreeNode* node = &root;
+		if (!root.bounds.Contains(position)) {
+			return nullptr;
+		}
 
-		for (int i = 0; i < node.children.size(); ++i) {
-			if (node.children[i].bounds.Contains(position)) {
-				if (node.children[i].IsLeaf()) {
-					foundNode = node.children[i];
+		while (!node->IsLeaf()) {
+			const OctreeNode* next = nullptr;
+			for (const OctreeNode& child : node->children) {
+				if (child.bounds.Contains(position)) {
+					next = &child;
 					break;
 				}
+			}
 
-				foundNode = FindClosestNode(node.children[i], position);
+			if (!next) {
+				return nullptr;
 			}
+			node = next;
 		}
 
-		return foundNode;
+		return node;
+	}
+
+	NodeIndex Octree::FindClosestGraphNode(glm::vec3 position) const {
+		return graph.FindNode(FindClosestNode(position));
 	}
-}
\ No newline at end of file
+}
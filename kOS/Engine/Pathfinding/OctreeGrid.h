@@ -52,14 +52,24 @@ namespace Octrees {
 			m_ecs = ecs;
 		}
 
+		//builds the tree and graph from the given obstacles instead of the ECS colliders
+		void Build(Bounds _bounds, float minNodeSize, const std::vector<OctreeObject>& obstacles);
+
 		//void GetEmptyLeaves(OctreeNode node);
 		void GetEmptyLeaves(OctreeNode* node);
 		void CreateTree(float minNodeSize);
 		void CalculateBounds();
 		void GetEdges();
 
-		OctreeNode FindClosestNode(glm::vec3 position);
-		OctreeNode FindClosestNode(OctreeNode node, glm::vec3 position);
+		//graph nodes of the empty leaves touching the leaf (10% slack), found by walking the tree
+		void GetNeighbours(const OctreeNode& leaf, std::vector<NodeIndex>& neighbours) const;
+
+		const OctreeNode* FindClosestNode(glm::vec3 position) const;
+		//INVALID_NODE when the position is outside the tree or inside an occupied leaf
+		NodeIndex FindClosestGraphNode(glm::vec3 position) const;
+
+	private:
+		void BuildGraph();
 	};
 }
 
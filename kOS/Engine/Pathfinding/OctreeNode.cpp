@@ -59,7 +59,7 @@ namespace Octrees {
 		}
 	}
 
-	bool OctreeNode::IsLeaf() {
+	bool OctreeNode::IsLeaf() const {
 		return children.empty();
 	}
 
@@ -39,7 +39,11 @@ namespace Octrees {
 		Bounds bounds;
 		std::vector<Bounds> childBounds;
 		std::vector<OctreeNode> children;
-		bool IsLeaf();
+		bool IsLeaf() const;
+		bool IsEmptyLeaf() const { return IsLeaf() && objects.empty(); }
+
+		//index of this leaf in the navigation graph, -1 if it is not a graph node
+		int graphIndex = -1;
 
 		float minNodeSize = 1.f;
 
@@ -42,6 +42,9 @@ namespace Octrees {
 		bounds.size.z = boundSize.z;
 	}
 
+	OctreeObject::OctreeObject(Bounds _bounds) : bounds{ _bounds } {
+	}
+
 	bool OctreeObject::Intersects(Bounds boundsToCheck) {
 		return bounds.Intersects(boundsToCheck);
 	}
@@ -32,6 +32,7 @@ namespace Octrees {
 
 		//OctreeObject();
 		OctreeObject(const ecs::TransformComponent* tc, const ecs::BoxColliderComponent* bc);
+		OctreeObject(Bounds _bounds);
 		bool Intersects(Bounds boundsToCheck);
 	};
 }
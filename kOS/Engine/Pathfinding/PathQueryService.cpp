@@ -0,0 +1,230 @@
+/******************************************************************/
+/*!
+\file      PathQueryService.cpp
+\author    Yeo See Kiat Raymond, seekiatraymond.yeo, 2301268
+\par       seekiatraymond.yeo@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains the path query service that runs
+			batched path searches for many agents on the job system.
+
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "PathQueryService.h"
+#include "OctreeGrid.h"
+
+namespace Octrees {
+
+	PathQueryService::PathQueryService(utility::JobSystem& jobSystem) :
+		m_jobSystem(jobSystem),
+		m_states(jobSystem.GetWorkerCount() + 1)
+	{}
+
+	PathQueryService::~PathQueryService() {
+		//jobs reference the batch and the thread states
+		m_jobSystem.Wait(m_remainingJobs);
+	}
+
+	void PathQueryService::SetGraph(std::shared_ptr<const Octree> octree) {
+		m_octree = std::move(octree);
+	}
+
+	void PathQueryService::Request(ecs::EntityID agent, glm::vec3 from, glm::vec3 to) {
+		m_removedWhileBusy.erase(agent);
+
+		const auto it = m_pendingIndex.find(agent);
+		if (it != m_pendingIndex.end()) {
+			m_pending[it->second] = PathRequest{ agent, from, to };
+			return;
+		}
+
+		m_pendingIndex[agent] = m_pending.size();
+		m_pending.push_back(PathRequest{ agent, from, to });
+	}
+
+	void PathQueryService::RemoveAgent(ecs::EntityID agent) {
+		const auto it = m_pendingIndex.find(agent);
+		if (it != m_pendingIndex.end()) {
+			//swap remove, the order of pending requests does not matter beyond fairness
+			const size_t index = it->second;
+			m_pendingIndex.erase(it);
+			if (index != m_pending.size() - 1) {
+				m_pending[index] = m_pending.back();
+				m_pendingIndex[m_pending[index].agent] = index;
+			}
+			m_pending.pop_back();
+		}
+
+		m_paths.erase(agent);
+		if (IsBusy()) {
+			m_removedWhileBusy.insert(agent);
+		}
+	}
+
+	const PathBuffer* PathQueryService::GetPath(ecs::EntityID agent) const {
+		const auto it = m_paths.find(agent);
+		return it != m_paths.end() ? &it->second : nullptr;
+	}
+
+	void PathQueryService::Update() {
+		//never wait on a running batch, agents keep following their previous path until it lands
+		if (IsBusy()) {
+			return;
+		}
+
+		Publish();
+		StartBatch();
+	}
+
+	void PathQueryService::Flush() {
+		m_jobSystem.Wait(m_remainingJobs);
+		Publish();
+	}
+
+	void PathQueryService::Publish() {
+		if (!m_batch) {
+			return;
+		}
+
+		Batch& batch = *m_batch;
+		for (size_t i = 0; i < batch.requests.size(); ++i) {
+			const ecs::EntityID agent = batch.requests[i].agent;
+			if (m_removedWhileBusy.contains(agent)) {
+				continue;
+			}
+
+			PathBuffer& buffer = m_paths[agent];
+			const uint32_t version = buffer.version + 1;
+			buffer = std::move(batch.results[i]);
+			buffer.version = version;
+		}
+
+		//tune how many searches fit in the frame budget from what this batch actually cost
+		if (!batch.groups.empty()) {
+			const float batchMs = static_cast<float>(batch.workerMicroseconds.load()) / 1000.f;
+			const float searchMs = batchMs / static_cast<float>(batch.groups.size());
+			m_averageSearchMs = m_averageSearchMs * 0.8f + searchMs * 0.2f;
+		}
+
+		m_removedWhileBusy.clear();
+		m_batch.reset();
+	}
+
+	void PathQueryService::StartBatch() {
+		if (m_pending.empty() || !m_octree) {
+			return;
+		}
+
+		auto batch = std::make_unique<Batch>();
+		batch->octree = m_octree;
+		const Octree& octree = *batch->octree;
+
+		//group by target node, agents chasing the same target share one search
+		std::unordered_map<NodeIndex, size_t> groupIndex;
+		std::vector<PathRequest> deferred;
+		const size_t maxSearches = std::max<size_t>(1, static_cast<size_t>(m_frameBudget / std::max(m_averageSearchMs, 0.001f)));
+
+		for (const PathRequest& request : m_pending) {
+			const NodeIndex target = octree.FindClosestGraphNode(request.to);
+			const auto it = groupIndex.find(target);
+			if (it == groupIndex.end() && batch->groups.size() >= maxSearches) {
+				//over budget, try again next frame
+				deferred.push_back(request);
+				continue;
+			}
+
+			const size_t requestIndex = batch->requests.size();
+			batch->requests.push_back(request);
+			batch->startNodes.push_back(octree.FindClosestGraphNode(request.from));
+
+			if (it != groupIndex.end()) {
+				batch->groups[it->second].requests.push_back(requestIndex);
+			}
+			else {
+				groupIndex[target] = batch->groups.size();
+				batch->groups.push_back(SearchGroup{ target, { requestIndex } });
+			}
+		}
+
+		m_pending = std::move(deferred);
+		m_pendingIndex.clear();
+		for (size_t i = 0; i < m_pending.size(); ++i) {
+			m_pendingIndex[m_pending[i].agent] = i;
+		}
+
+		batch->results.resize(batch->requests.size());
+		m_searchCount += batch->groups.size();
+		m_batch = std::move(batch);
+
+		m_remainingJobs.store(m_batch->groups.size(), std::memory_order_release);
+		Batch* running = m_batch.get();
+		for (size_t i = 0; i < running->groups.size(); ++i) {
+			m_jobSystem.Submit([this, running, i]() {
+				RunGroup(*running, running->groups[i]);
+				m_remainingJobs.fetch_sub(1, std::memory_order_acq_rel);
+			});
+		}
+	}
+
+	SearchState& PathQueryService::GetThreadState() {
+		//main thread (-1) uses the first state
+		return m_states[static_cast<size_t>(utility::JobSystem::GetCurrentWorkerIndex() + 1)];
+	}
+
+	void PathQueryService::RunGroup(Batch& batch, const SearchGroup& group) {
+		const auto start = std::chrono::steady_clock::now();
+		const Graph& graph = batch.octree->graph;
+		SearchState& state = GetThreadState();
+		std::vector<NodeIndex> path;
+
+		auto fillResult = [&](size_t requestIndex) {
+			PathBuffer& result = batch.results[requestIndex];
+			result.found = !path.empty();
+			if (!result.found) return;
+
+			//skip the node the agent is standing in
+			for (size_t i = 1; i < path.size(); ++i) {
+				result.points.push_back(graph.nodeCenters[path[i]]);
+			}
+			result.points.push_back(batch.requests[requestIndex].to);
+		};
+
+		if (group.target == INVALID_NODE) {
+			//destination is off the graph, results stay not found
+		}
+		else if (group.requests.size() == 1) {
+			const size_t requestIndex = group.requests.front();
+			const NodeIndex startNode = batch.startNodes[requestIndex];
+			if (startNode != INVALID_NODE) {
+				graph.AStar(startNode, group.target, state, path);
+			}
+			fillResult(requestIndex);
+		}
+		else {
+			std::vector<NodeIndex> goals;
+			for (const size_t requestIndex : group.requests) {
+				if (batch.startNodes[requestIndex] != INVALID_NODE) {
+					goals.push_back(batch.startNodes[requestIndex]);
+				}
+			}
+
+			//tree is grown from the target, each agent walks its branch back to the root
+			graph.SearchTree(group.target, goals, state);
+			for (const size_t requestIndex : group.requests) {
+				path.clear();
+				if (batch.startNodes[requestIndex] != INVALID_NODE) {
+					Graph::GetPathToRoot(batch.startNodes[requestIndex], state, path);
+				}
+				//GetPathToRoot already runs agent -> target
+				fillResult(requestIndex);
+			}
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+		batch.workerMicroseconds.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+/******************************************************************/
+/*!
+\file      PathQueryService.h
+\author    Yeo See Kiat Raymond, seekiatraymond.yeo, 2301268
+\par       seekiatraymond.yeo@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains the path query service. Agents submit
+			path requests, the requests are searched on the job
+			system against a read only snapshot of the octree graph
+			and every agent gets its own path buffer back.
+
+			- Requests of agents heading to the same graph node are
+			  coalesced into one shortest path tree search.
+			- Each frame only starts as many searches as fit in the
+			  frame budget, the rest wait for the next frame.
+			- A batch that is still running is never waited on, its
+			  results are published on the first Update after it ends.
+
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#ifndef PATHQUERYSERVICE_H
+#define PATHQUERYSERVICE_H
+
+#include "Config/pch.h"
+#include "ECS/ECSList.h"
+#include "Utility/JobSystem.h"
+#include "Graph.h"
+
+namespace Octrees {
+	struct Octree;
+
+	struct PathBuffer {
+		//waypoints after the agent's own node, the last one is the requested destination
+		std::vector<glm::vec3> points;
+		bool found{ false };
+		//increases every time a new result is delivered
+		uint32_t version{};
+	};
+
+	class PathQueryService {
+	public:
+		explicit PathQueryService(utility::JobSystem& jobSystem);
+		~PathQueryService();
+
+		PathQueryService(const PathQueryService&) = delete;
+		PathQueryService& operator=(const PathQueryService&) = delete;
+
+		//graph used by batches started after this call, running batches keep their snapshot
+		void SetGraph(std::shared_ptr<const Octree> octree);
+
+		//a newer request from the same agent replaces the pending one
+		void Request(ecs::EntityID agent, glm::vec3 from, glm::vec3 to);
+		void RemoveAgent(ecs::EntityID agent);
+
+		//publishes a finished batch and starts the next one, call once per frame on the main thread
+		void Update();
+		//blocks until the running batch is done and published
+		void Flush();
+
+		//worker time the searches started in one frame may take
+		void SetFrameBudget(float milliseconds) { m_frameBudget = milliseconds; }
+
+		const PathBuffer* GetPath(ecs::EntityID agent) const;
+		size_t GetPendingCount() const { return m_pending.size(); }
+		bool IsBusy() const { return m_remainingJobs.load(std::memory_order_acquire) > 0; }
+		size_t GetSearchCount() const { return m_searchCount; }
+
+	private:
+		struct PathRequest {
+			ecs::EntityID agent;
+			glm::vec3 from;
+			glm::vec3 to;
+		};
+
+		struct SearchGroup {
+			NodeIndex target{ INVALID_NODE };
+			std::vector<size_t> requests;	// into Batch::requests
+		};
+
+		struct Batch {
+			std::shared_ptr<const Octree> octree;
+			std::vector<PathRequest> requests;
+			std::vector<NodeIndex> startNodes;
+			std::vector<SearchGroup> groups;
+			std::vector<PathBuffer> results;
+			std::atomic<int64_t> workerMicroseconds{ 0 };
+		};
+
+		void StartBatch();
+		void Publish();
+		void RunGroup(Batch& batch, const SearchGroup& group);
+		SearchState& GetThreadState();
+
+		utility::JobSystem& m_jobSystem;
+		std::shared_ptr<const Octree> m_octree;
+
+		std::vector<PathRequest> m_pending;
+		std::unordered_map<ecs::EntityID, size_t> m_pendingIndex;
+		std::unordered_map<ecs::EntityID, PathBuffer> m_paths;
+		//results of these agents are dropped when the running batch is published
+		std::unordered_set<ecs::EntityID> m_removedWhileBusy;
+
+		std::unique_ptr<Batch> m_batch;
+		std::atomic<size_t> m_remainingJobs{ 0 };
+		//one per worker plus one for the main thread, a search never runs nested on the same thread
+		std::vector<SearchState> m_states;
+
+		float m_frameBudget{ 2.f };
+		float m_averageSearchMs{ 0.05f };
+		size_t m_searchCount{};
+	};
+}
+
+#endif
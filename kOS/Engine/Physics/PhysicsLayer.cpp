@@ -47,6 +47,10 @@ namespace physicslayer {
         return layerCollisions[layer1].test(layer2); // Check if layers should collide
     }
 
+    uint32_t PhysicsLayer::m_GetCollisionMask(int layer) const {
+        return static_cast<uint32_t>(layerCollisions[layer].to_ulong());
+    }
+
     std::bitset<size>* PhysicsLayer::m_GetMat() {
         return layerCollisions;
     }
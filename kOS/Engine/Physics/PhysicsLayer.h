@@ -50,6 +50,8 @@ namespace physicslayer {
 
         void m_SetCollision(int layer1, int layer2, bool value);
         bool m_GetCollide(int layer1, int layer2) ;
+        //bit n set when layer collides with layer n, used as a scene query layer mask
+        uint32_t m_GetCollisionMask(int layer) const;
 
         void m_PrintCollisionMatrix() const;
 
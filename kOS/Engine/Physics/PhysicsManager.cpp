@@ -30,6 +30,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "Config/pch.h"
 #include "PhysicsManager.h"
+#include "Debugging/Profiler.h"
 
 namespace physics {
 	void PhysicsManager::Init() {
@@ -44,6 +45,8 @@ namespace physics {
 		m_cpuDispatcher = PxDefaultCpuDispatcherCreate(2);
 		sceneDesc.cpuDispatcher = m_cpuDispatcher;
 		sceneDesc.filterShader = ToPhysxCustomFilter;
+		//lets the PhysicsSystem read back only the bodies that moved
+		sceneDesc.flags |= PxSceneFlag::eENABLE_ACTIVE_ACTORS;
 
 		physicslayer::PhysicsFilterData physicsFilterData;
 		physicsFilterData.layerSystem = &layers;
@@ -70,6 +73,7 @@ namespace physics {
 			m_eventCallback->m_activeCollisions.clear();
 			m_eventCallback->m_activeTriggers.clear();
 		}
+		m_activeActors.clear();
 
 		if (m_controllerManager) {
 			m_controllerManager->release();
@@ -108,13 +112,21 @@ namespace physics {
 	}
 
 	void PhysicsManager::Update(float deltaTime) {
+		KOS_PROFILE_SCOPE("PhysicsManager::Update");
 		if (!m_scene) { return; }
 		m_accumulator += deltaTime;
 		if (m_accumulator > m_maximumDeltaTIme) { m_accumulator = m_maximumDeltaTIme; }
 		m_frameCount = 0;
+		m_activeActors.clear();
 		while (m_accumulator >= m_fixedDeltaTime) {
+			onFixedUpdate.Invoke();
 			m_scene->simulate(m_fixedDeltaTime);
 			m_scene->fetchResults(true);
+
+			//a body can come to rest in a later step of the same frame, keep every step's movers
+			PxU32 activeCount{};
+			PxActor** activeActors = m_scene->getActiveActors(activeCount);
+			m_activeActors.insert(m_activeActors.end(), activeActors, activeActors + activeCount);
 			if (m_eventCallback) { 
 				m_eventCallback->ProcessCollisionStay();
 				m_eventCallback->ProcessTriggerStay(); 
@@ -138,7 +150,7 @@ namespace physics {
 		}
 	}
 
-	bool PhysicsManager::Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RaycastHit& outHit, void* actorToIgnore) {
+	bool PhysicsManager::Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RaycastHit& outHit, void* actorToIgnore, uint32_t layerMask) {
 		if (!m_scene) { return false; }
 
 		PxVec3 pxOrigin{ origin.x, origin.y, origin.z };
@@ -146,35 +158,18 @@ namespace physics {
 		pxDirection.normalize();
 
 		PxRaycastBuffer hit;
-		PxRigidActor* ignoredActor = static_cast<PxRigidActor*>(actorToIgnore);
-
-		struct IgnoreActorFilter : public PxQueryFilterCallback {
-			PxRigidActor* ignore;
-			IgnoreActorFilter(PxRigidActor* actor) : ignore(actor) {}
-
-			PxQueryHitType::Enum preFilter(const PxFilterData& filterData, const PxShape* shape, const PxRigidActor* actor, PxHitFlags& queryFlags) override {
-				if (actor == ignore) { return PxQueryHitType::eNONE; }
-				return PxQueryHitType::eBLOCK;
-			}
-
-			PxQueryHitType::Enum postFilter(const PxFilterData& filterData, const PxQueryHit& hit, const PxShape* shape, const PxRigidActor* actor) override {
-				PX_UNUSED(filterData);
-				PX_UNUSED(hit);
-				PX_UNUSED(shape);
-				PX_UNUSED(actor);
-				return PxQueryHitType::eBLOCK;
-			}
-		};
 
+		QueryFilter filterCallback;
+		filterCallback.layerMask = layerMask;
+		filterCallback.ignore = static_cast<PxRigidActor*>(actorToIgnore);
 		PxQueryFilterData filterData{ PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER };
-		IgnoreActorFilter filterCallback{ ignoredActor };
 
-		bool isHit = m_scene->raycast(pxOrigin, pxDirection, maxDistance, hit, PxHitFlag::eDEFAULT, filterData, ignoredActor ? &filterCallback : nullptr);
+		bool isHit = m_scene->raycast(pxOrigin, pxDirection, maxDistance, hit, PxHitFlag::eDEFAULT, filterData, &filterCallback);
 		if (isHit && hit.hasBlock) {
 			outHit.point = glm::vec3{ hit.block.position.x, hit.block.position.y, hit.block.position.z };
 			outHit.normal = glm::vec3{ hit.block.normal.x, hit.block.normal.y, hit.block.normal.z };
 			outHit.distance = hit.block.distance;
-			if (hit.block.actor && hit.block.actor->userData) { outHit.entityID = reinterpret_cast<unsigned int>(hit.block.actor->userData); }
+			if (hit.block.actor && hit.block.actor->userData) { outHit.entityID = ToEntityID(hit.block.actor); }
 			return true;
 		}
 		return false;
@@ -35,6 +35,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "PhysicsEventCallback.h"
 #include "PhysxUtils.h"
 #include "PhysicsLayer.h"
+#include "SceneQueries.h"
 #include "Events/Delegate.h"
 
 using namespace physx;
@@ -61,9 +62,19 @@ namespace physics {
 		void AddForce(void*, const glm::vec3&, ForceMode mode = ForceMode::Force);
 		void AddTorque(void*, const glm::vec3&, ForceMode mode = ForceMode::Force);
 
-		bool Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RaycastHit& outHit, void* actorToIgnore);
+		//blocking, prefer the batched GetSceneQueries when the result can wait for the physics step
+		bool Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RaycastHit& outHit, void* actorToIgnore, uint32_t layerMask = ALL_LAYERS);
+
+		SceneQueries& GetSceneQueries() { return m_sceneQueries; }
+		//runs the queries queued since the last call, the PhysicsSystem calls it after the physics step
+		void ExecuteSceneQueries(utility::JobSystem* jobSystem) { m_sceneQueries.Execute(m_scene, jobSystem); }
+
+		//actors moved by the steps of the last Update, an actor can be listed once per step
+		const std::vector<PxActor*>& GetActiveActors() const { return m_activeActors; }
 
 		physicslayer::PhysicsLayer layers;
+		//invoked before every fixed step is simulated, zero or more times a frame
+		Delegate<> onFixedUpdate;
 	private:
 		PhysicsManager(const PhysicsManager&) = delete;
 		PhysicsManager& operator=(const PhysicsManager&) = delete;
@@ -82,6 +93,9 @@ namespace physics {
 		float m_maximumDeltaTIme = 1.0f / 3.0f;
 		float m_accumulator = 0.0f;
 		int m_frameCount = 0;
+
+		SceneQueries m_sceneQueries;
+		std::vector<PxActor*> m_activeActors;
 	};
 }
 
@@ -0,0 +1,217 @@
+/********************************************************************/
+/*!
+\file		SceneQueries.cpp
+\author		Toh Yu Heng 2301294
+\par		t.yuheng@digipen.edu
+\date		Oct 18 2026
+\brief		Defines the batched scene queries. Queries are copied into
+			the queue under a lock, Execute swaps the queue out and
+			runs it in parallel chunks, each query writes only its own
+			result.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "Config/pch.h"
+#include "SceneQueries.h"
+#include "Debugging/Profiler.h"
+
+namespace physics {
+	//queries per job, each one is a few microseconds
+	constexpr size_t QUERY_GRAIN_SIZE = 32;
+
+	//one zone per query type, the profiler's call count is the number run in the frame
+	constexpr const char* QUERY_ZONES[] = {
+		"SceneQueries::Raycast",
+		"SceneQueries::OverlapSphere",
+		"SceneQueries::OverlapBox",
+		"SceneQueries::SweepSphere",
+		"SceneQueries::SweepBox"
+	};
+
+	PxQueryHitType::Enum QueryFilter::preFilter(const PxFilterData& filterData, const PxShape* shape, const PxRigidActor* actor, PxHitFlags& queryFlags) {
+		PX_UNUSED(filterData);
+		PX_UNUSED(queryFlags);
+		if (actor == ignore) { return PxQueryHitType::eNONE; }
+		//word0 is the collider's layer, see ColliderSystem
+		const PxU32 layer = shape->getQueryFilterData().word0;
+		if (layer >= 32 || !(layerMask & (1u << layer))) { return PxQueryHitType::eNONE; }
+		return hitType;
+	}
+
+	PxQueryHitType::Enum QueryFilter::postFilter(const PxFilterData& filterData, const PxQueryHit& hit, const PxShape* shape, const PxRigidActor* actor) {
+		PX_UNUSED(filterData);
+		PX_UNUSED(hit);
+		PX_UNUSED(shape);
+		PX_UNUSED(actor);
+		return hitType;
+	}
+
+	QueryHandle SceneQueries::Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, uint32_t layerMask, void* actorToIgnore) {
+		SceneQuery query;
+		query.type = QueryType::Raycast;
+		query.origin = origin;
+		query.direction = direction;
+		query.maxDistance = maxDistance;
+		query.layerMask = layerMask;
+		query.actorToIgnore = actorToIgnore;
+		return Queue(query);
+	}
+
+	QueryHandle SceneQueries::OverlapSphere(const glm::vec3& center, float radius, uint32_t layerMask, void* actorToIgnore) {
+		SceneQuery query;
+		query.type = QueryType::OverlapSphere;
+		query.origin = center;
+		query.halfExtents = glm::vec3{ radius };
+		query.layerMask = layerMask;
+		query.actorToIgnore = actorToIgnore;
+		return Queue(query);
+	}
+
+	QueryHandle SceneQueries::OverlapBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::quat& rotation, uint32_t layerMask, void* actorToIgnore) {
+		SceneQuery query;
+		query.type = QueryType::OverlapBox;
+		query.origin = center;
+		query.halfExtents = halfExtents;
+		query.rotation = rotation;
+		query.layerMask = layerMask;
+		query.actorToIgnore = actorToIgnore;
+		return Queue(query);
+	}
+
+	QueryHandle SceneQueries::SweepSphere(const glm::vec3& origin, float radius, const glm::vec3& direction, float maxDistance, uint32_t layerMask, void* actorToIgnore) {
+		SceneQuery query;
+		query.type = QueryType::SweepSphere;
+		query.origin = origin;
+		query.halfExtents = glm::vec3{ radius };
+		query.direction = direction;
+		query.maxDistance = maxDistance;
+		query.layerMask = layerMask;
+		query.actorToIgnore = actorToIgnore;
+		return Queue(query);
+	}
+
+	QueryHandle SceneQueries::SweepBox(const glm::vec3& origin, const glm::vec3& halfExtents, const glm::quat& rotation, const glm::vec3& direction, float maxDistance, uint32_t layerMask, void* actorToIgnore) {
+		SceneQuery query;
+		query.type = QueryType::SweepBox;
+		query.origin = origin;
+		query.halfExtents = halfExtents;
+		query.rotation = rotation;
+		query.direction = direction;
+		query.maxDistance = maxDistance;
+		query.layerMask = layerMask;
+		query.actorToIgnore = actorToIgnore;
+		return Queue(query);
+	}
+
+	QueryHandle SceneQueries::Queue(const SceneQuery& query) {
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_queued.push_back(query);
+		return QueryHandle{ static_cast<uint32_t>(m_queued.size() - 1), m_queuedBatch };
+	}
+
+	size_t SceneQueries::GetQueuedCount() const {
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		return m_queued.size();
+	}
+
+	const QueryResult* SceneQueries::GetResult(QueryHandle handle) const {
+		if (handle.IsNull() || handle.batch != m_completedBatch || handle.index >= m_results.size()) { return nullptr; }
+		return &m_results[handle.index];
+	}
+
+	void SceneQueries::Execute(PxScene* scene, utility::JobSystem* jobSystem) {
+		KOS_PROFILE_SCOPE("SceneQueries::Execute");
+
+		{
+			std::lock_guard<std::mutex> lock(m_queueMutex);
+			m_executing.swap(m_queued);
+			m_queued.clear();
+			m_completedBatch = m_queuedBatch++;
+		}
+
+		m_results.assign(m_executing.size(), QueryResult{});
+		if (!scene || m_executing.empty()) { return; }
+
+		auto runQueries = [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				RunQuery(scene, m_executing[i], m_results[i]);
+			}
+		};
+		if (jobSystem) {
+			jobSystem->ParallelFor(m_executing.size(), QUERY_GRAIN_SIZE, runQueries);
+		}
+		else {
+			runQueries(0, m_executing.size());
+		}
+	}
+
+	void SceneQueries::RunQuery(PxScene* scene, const SceneQuery& query, QueryResult& result) {
+		KOS_PROFILE_SCOPE(QUERY_ZONES[static_cast<int>(query.type)]);
+
+		QueryFilter filter;
+		filter.layerMask = query.layerMask;
+		filter.ignore = static_cast<const PxRigidActor*>(query.actorToIgnore);
+
+		const PxTransform pose{ PxVec3{ query.origin.x, query.origin.y, query.origin.z },
+			PxQuat{ query.rotation.x, query.rotation.y, query.rotation.z, query.rotation.w } };
+
+		if (query.type == QueryType::OverlapSphere || query.type == QueryType::OverlapBox) {
+			filter.hitType = PxQueryHitType::eTOUCH;
+			PxQueryFilterData filterData{ PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER | PxQueryFlag::eNO_BLOCK };
+
+			PxOverlapHit touches[MAX_OVERLAP_HITS];
+			PxOverlapBuffer overlap{ touches, static_cast<PxU32>(MAX_OVERLAP_HITS) };
+			if (query.type == QueryType::OverlapSphere) {
+				scene->overlap(PxSphereGeometry{ query.halfExtents.x }, pose, overlap, filterData, &filter);
+			}
+			else {
+				scene->overlap(PxBoxGeometry{ query.halfExtents.x, query.halfExtents.y, query.halfExtents.z }, pose, overlap, filterData, &filter);
+			}
+
+			for (PxU32 i = 0; i < overlap.getNbTouches(); ++i) {
+				const PxOverlapHit& touch = overlap.getTouch(i);
+				if (touch.actor && touch.actor->userData) {
+					result.overlaps[result.overlapCount++] = ToEntityID(touch.actor);
+				}
+			}
+			return;
+		}
+
+		if (glm::dot(query.direction, query.direction) <= 0.f) { return; }
+		const glm::vec3 direction = glm::normalize(query.direction);
+		const PxVec3 pxDirection{ direction.x, direction.y, direction.z };
+		PxQueryFilterData filterData{ PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER };
+
+		auto storeHit = [&result](const PxLocationHit& hit, const PxRigidActor* actor) {
+			result.hasHit = true;
+			result.hit.point = glm::vec3{ hit.position.x, hit.position.y, hit.position.z };
+			result.hit.normal = glm::vec3{ hit.normal.x, hit.normal.y, hit.normal.z };
+			result.hit.distance = hit.distance;
+			result.hit.entityID = (actor && actor->userData) ? ToEntityID(actor) : 0;
+		};
+
+		if (query.type == QueryType::Raycast) {
+			PxRaycastBuffer hit;
+			if (scene->raycast(pose.p, pxDirection, query.maxDistance, hit, PxHitFlag::eDEFAULT, filterData, &filter) && hit.hasBlock) {
+				storeHit(hit.block, hit.block.actor);
+			}
+			return;
+		}
+
+		PxSweepBuffer hit;
+		bool isHit{};
+		if (query.type == QueryType::SweepSphere) {
+			isHit = scene->sweep(PxSphereGeometry{ query.halfExtents.x }, pose, pxDirection, query.maxDistance, hit, PxHitFlag::eDEFAULT, filterData, &filter);
+		}
+		else {
+			isHit = scene->sweep(PxBoxGeometry{ query.halfExtents.x, query.halfExtents.y, query.halfExtents.z }, pose, pxDirection, query.maxDistance, hit, PxHitFlag::eDEFAULT, filterData, &filter);
+		}
+		if (isHit && hit.hasBlock) {
+			storeHit(hit.block, hit.block.actor);
+		}
+	}
+}
@@ -0,0 +1,121 @@
+/********************************************************************/
+/*!
+\file		SceneQueries.h
+\author		Toh Yu Heng 2301294
+\par		t.yuheng@digipen.edu
+\date		Oct 18 2026
+\brief		Declares SceneQueries, a batch of raycasts, overlaps and
+			sweeps queued during the frame and run together against
+			the PhysX scene.
+
+			Queries are queued from any thread and return a handle.
+			The PhysicsSystem executes the batch right after the
+			physics step, split across the job system, and the
+			results can be read through the handles until the next
+			batch executes. Execute can also be called directly as a
+			sync point.
+
+			Every query takes a layer mask, bit n set hits colliders
+			on layer n. physicslayer::PhysicsLayer::m_GetCollisionMask
+			gives the layers a layer collides with.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#ifndef SCENEQUERIES_H
+#define SCENEQUERIES_H
+
+#include "PhysxUtils.h"
+#include "Utility/JobSystem.h"
+
+namespace physics {
+	constexpr uint32_t ALL_LAYERS = 0xFFFFFFFF;
+	//entities an overlap reports, the rest are dropped
+	constexpr size_t MAX_OVERLAP_HITS = 16;
+
+	enum class QueryType {
+		Raycast = 0,
+		OverlapSphere,
+		OverlapBox,
+		SweepSphere,
+		SweepBox
+	};
+
+	struct QueryHandle {
+		static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+		uint32_t index{ INVALID_INDEX };
+		uint32_t batch{};
+
+		bool IsNull() const { return index == INVALID_INDEX; }
+	};
+
+	struct QueryResult {
+		//closest hit of a raycast or sweep
+		bool hasHit{ false };
+		RaycastHit hit{};
+		//entities touching an overlap
+		uint32_t overlapCount{};
+		std::array<unsigned int, MAX_OVERLAP_HITS> overlaps{};
+	};
+
+	class SceneQueries {
+	public:
+		QueryHandle Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, uint32_t layerMask = ALL_LAYERS, void* actorToIgnore = nullptr);
+		QueryHandle OverlapSphere(const glm::vec3& center, float radius, uint32_t layerMask = ALL_LAYERS, void* actorToIgnore = nullptr);
+		QueryHandle OverlapBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::quat& rotation, uint32_t layerMask = ALL_LAYERS, void* actorToIgnore = nullptr);
+		QueryHandle SweepSphere(const glm::vec3& origin, float radius, const glm::vec3& direction, float maxDistance, uint32_t layerMask = ALL_LAYERS, void* actorToIgnore = nullptr);
+		QueryHandle SweepBox(const glm::vec3& origin, const glm::vec3& halfExtents, const glm::quat& rotation, const glm::vec3& direction, float maxDistance, uint32_t layerMask = ALL_LAYERS, void* actorToIgnore = nullptr);
+
+		//runs every queued query, the scene must not be simulating. Without a job system the queries run inline
+		void Execute(PxScene* scene, utility::JobSystem* jobSystem);
+
+		//nullptr before the query's batch executed and once the next batch has
+		const QueryResult* GetResult(QueryHandle handle) const;
+		size_t GetQueuedCount() const;
+
+	private:
+		struct SceneQuery {
+			QueryType type{};
+			glm::vec3 origin{};
+			glm::vec3 direction{};
+			float maxDistance{};
+			//x is the radius of spheres
+			glm::vec3 halfExtents{};
+			glm::quat rotation{ 1.f, 0.f, 0.f, 0.f };
+			uint32_t layerMask{ ALL_LAYERS };
+			void* actorToIgnore{ nullptr };
+		};
+
+		QueryHandle Queue(const SceneQuery& query);
+		static void RunQuery(PxScene* scene, const SceneQuery& query, QueryResult& result);
+
+		mutable std::mutex m_queueMutex;
+		std::vector<SceneQuery> m_queued;
+		uint32_t m_queuedBatch{ 1 };
+
+		//kept between batches so the vectors stop allocating
+		std::vector<SceneQuery> m_executing;
+		std::vector<QueryResult> m_results;
+		uint32_t m_completedBatch{ 0 };
+	};
+
+	//filter shared by the immediate and batched queries, skips the ignored actor and shapes outside the layer mask
+	struct QueryFilter : public PxQueryFilterCallback {
+		uint32_t layerMask{ ALL_LAYERS };
+		const PxRigidActor* ignore{ nullptr };
+		PxQueryHitType::Enum hitType{ PxQueryHitType::eBLOCK };
+
+		PxQueryHitType::Enum preFilter(const PxFilterData& filterData, const PxShape* shape, const PxRigidActor* actor, PxHitFlags& queryFlags) override;
+		PxQueryHitType::Enum postFilter(const PxFilterData& filterData, const PxQueryHit& hit, const PxShape* shape, const PxRigidActor* actor) override;
+	};
+
+	inline unsigned int ToEntityID(const PxRigidActor* actor) {
+		return static_cast<unsigned int>(reinterpret_cast<uintptr_t>(actor->userData));
+	}
+}
+
+#endif
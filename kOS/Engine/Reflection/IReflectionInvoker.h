@@ -15,6 +15,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "Config/pch.h"
 #include "DeSerialization/json_handler.h"
+#include "DeSerialization/BinarySerializationReflection.h"
+#include "ECS/SparseSet.h"
 
 
 class IActionInvoker {
@@ -26,6 +28,11 @@ public:
 
     virtual void Load(ecs::EntityID ID, const rapidjson::Value& entityData) = 0;
 
+    // Binary scene format, fields in declaration order without keys
+    virtual void SaveBinary(void* componentData, serialization::BinaryWriter& writer) = 0;
+    virtual void LoadBinary(ecs::EntityID ID, serialization::BinaryReader& reader) = 0;
+    virtual uint64_t GetSchemaHash() = 0;
+
     virtual bool Compare(void* componentData1, void* componentData2) = 0;
     virtual bool Compare(ecs::EntityID ID, ecs::EntityID ID2) = 0;
 
@@ -39,6 +46,9 @@ public:
 
     virtual void* DuplicateComponent(ecs::EntityID duplicateID, ecs::EntityID newID) = 0;
 
+    // Deep copy of the whole component pool, reflected fields only
+    virtual std::shared_ptr<ecs::ISparseSet> CopyPool() = 0;
+
     virtual void ApplyFunction(void* component, std::function<void(void*)> func) = 0;
 
     virtual void RegisterAction(const std::string& name, std::function<void(void*, void*)> func) = 0;
@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "IReflectionInvoker.h"
 #include "DeSerialization/SerializationReflection.h"
+#include "DeSerialization/BinarySerializationReflection.h"
 
 
 
@@ -39,6 +40,28 @@ public:
         }
     }
 
+    void SaveBinary(void* componentData, serialization::BinaryWriter& writer) override {
+        SaveComponentBinaryReflect(static_cast<T*>(componentData), writer);
+    }
+
+    void LoadBinary(ecs::EntityID ID, serialization::BinaryReader& reader) override {
+        //name and transform already exist on a new entity
+        T* component = m_ecs->HasComponent<T>(ID) ? m_ecs->GetComponent<T>(ID) : m_ecs->AddComponent<T>(ID);
+
+        if (component) {
+            LoadComponentBinaryReflect(component, reader);
+        }
+        else {
+            //still consume the record so the next one lines up
+            T scratch{};
+            LoadComponentBinaryReflect(&scratch, reader);
+        }
+    }
+
+    uint64_t GetSchemaHash() override {
+        return ComponentSchemaHash<T>();
+    }
+
     bool Compare(void* componentData1, void* componentData2) {
         return CompareComponentReflect(static_cast<T*>(componentData1), static_cast<T*>(componentData2));
     }
@@ -78,6 +101,20 @@ public:
         return m_ecs->DuplicateComponent<T>(duplicateID, newID);
     }
 
+    std::shared_ptr<ecs::ISparseSet> CopyPool() override {
+        ecs::SparseSet<T>* pool = m_ecs->GetComponentPool<T>();
+        auto copy = std::make_shared<ecs::SparseSet<T>>();
+        copy->Reserve(pool->Size());
+
+        for (const ecs::EntityID id : pool->GetEntityList()) {
+            T* component = copy->Set(id, T());
+            DeepCopyComponents<T> duplicator;
+            component->ApplyFunctionPairwise(duplicator, *pool->Get(id));
+            component->entity = id;
+        }
+        return copy;
+    }
+
     void ApplyFunction(void* component, std::function<void(void*)> func) override {
         T* Component = static_cast<T*>(component);
         Component->ApplyFunction([func](auto& member) {
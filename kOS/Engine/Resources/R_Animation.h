@@ -42,6 +42,9 @@ public:
 	using Resource::Resource;
 	void Load() override;
 	void Unload() override;
+	//no GL objects, the whole parse runs on the loader thread
+	void Decode() override { Load(); }
+	void Upload() override {}
 	void Update(float currentTime, const glm::mat4& parentTransform, const glm::mat4& globalInverse,
 		const std::unordered_map<std::string, int>& boneMap,
 		const std::vector<BoneInfo>& boneInfo);
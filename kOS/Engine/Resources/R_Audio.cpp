@@ -64,3 +64,11 @@ void R_Audio::Unload()
 		m_sound = nullptr;
 	}
 }
+
+ResourceMemory R_Audio::GetMemoryUsage() const
+{
+	//decoded PCM size, an upper bound for sounds created as streams
+	unsigned int bytes{};
+	if (m_sound) m_sound->getLength(&bytes, FMOD_TIMEUNIT_PCMBYTES);
+	return ResourceMemory{ bytes, 0 };
+}
@@ -29,6 +29,11 @@ public:
     void Load() override;
     void Unload() override;
 
+    //FMOD's system is thread safe, the sound is created and decoded on the loader thread
+    void Decode() override { Load(); }
+    void Upload() override {}
+    ResourceMemory GetMemoryUsage() const override;
+
     ~R_Audio() override { Unload(); }
 
     FMOD::Sound* GetSound()  const { return m_sound; }
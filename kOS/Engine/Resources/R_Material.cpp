@@ -8,4 +8,9 @@ void R_Material::Load()
    std::cout << "MATERIAL LOADED" << this->md.diffuseMaterialGUID.GetToString() << '\n';
    //Get resources from texture guid and load them
 }
-void R_Material::Unload(){}
\ No newline at end of file
+void R_Material::Unload()
+{
+    //lets go of the textures
+    pbrMaterial = PBRMaterial{};
+    pbrMaterialBuilt = false;
+}
\ No newline at end of file
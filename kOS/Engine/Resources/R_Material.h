@@ -1,6 +1,7 @@
 #pragma once
 #include "Resource.h"
 #include "Config/pch.h"
+#include "Graphics/Material.h"
 
 struct MaterialData
 {
@@ -26,9 +27,16 @@ public:
 
     void Load() override;
     void Unload() override;
+    //json only, the textures are requested separately
+    void Decode() override { Load(); }
+    void Upload() override {}
 
 
     MaterialData md;
+
+    //the textures of md, filled in by the renderer the first time the material is drawn
+    PBRMaterial pbrMaterial{};
+    bool pbrMaterialBuilt{ false };
    
     REFLECTABLE(R_Material);
 
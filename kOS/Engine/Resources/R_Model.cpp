@@ -15,9 +15,54 @@ void R_Model::Load()
     LoadMesh(this->m_filePath.string());
 }
 
-void R_Model::Unload()
+void R_Model::Decode()
+{
+    DecodeMesh(this->m_filePath.string());
+}
+
+void R_Model::Upload()
 {
+    meshes.reserve(meshes.size() + decodedMeshes.size());
+    for (DecodedMesh& decoded : decodedMeshes) {
+        this->meshes.push_back(Mesh{ std::move(decoded.vertices), std::move(decoded.indices), std::vector<Textures>{} });
+    }
+    for (const auto& [bone, id] : decodedBones) {
+        bones_loaded[bone] = id;
+    }
+    bone_info.insert(bone_info.end(), decodedBoneInfo.begin(), decodedBoneInfo.end());
+
+    decodedMeshes = {};
+    decodedBones = {};
+    decodedBoneInfo = {};
+}
+
+size_t R_Model::GetUploadSize() const
+{
+    size_t bytes{};
+    for (const DecodedMesh& decoded : decodedMeshes) {
+        bytes += decoded.vertices.size() * sizeof(Vertex) + decoded.indices.size() * sizeof(unsigned int);
+    }
+    return bytes;
+}
+
+ResourceMemory R_Model::GetMemoryUsage() const
+{
+    //the meshes keep their vertices after the buffers are filled
+    size_t meshBytes{};
+    for (const Mesh& mesh : meshes) {
+        meshBytes += mesh.vertices.size() * sizeof(Vertex) + mesh.indices.size() * sizeof(unsigned int);
+    }
+    return ResourceMemory{ meshBytes + bone_info.size() * sizeof(BoneInfo), meshBytes };
+}
 
+void R_Model::Unload()
+{
+    for (Mesh& mesh : meshes) {
+        mesh.Release();
+    }
+    meshes.clear();
+    bones_loaded.clear();
+    bone_info.clear();
 }
 /*------------------------------------------------------------------------------------------*/
 /*----------------------------------------MESH----------------------------------------------*/
@@ -27,14 +72,23 @@ void R_Model::Unload()
 
 
 R_Model::Mesh::Mesh(std::vector<Vertex> newVert, std::vector<unsigned int> newIndices, std::vector<Textures> newTextures)
-    :vertices{ newVert }
-    , indices{ newIndices }
-    , textures{ newTextures }
+    :vertices{ std::move(newVert) }
+    , indices{ std::move(newIndices) }
+    , textures{ std::move(newTextures) }
 {
     //set up mesh based on data
     SetupMesh();
 }
 
+void R_Model::Mesh::Release()
+{
+    //only set once SetupMesh ran
+    if (VAO) glDeleteVertexArrays(1, &VAO);
+    if (VBO) glDeleteBuffers(1, &VBO);
+    if (EBO) glDeleteBuffers(1, &EBO);
+    VAO = VBO = EBO = 0;
+}
+
 void R_Model::Mesh::SetupMesh()
 {
     // create buffers/arrays
@@ -143,6 +197,11 @@ void R_Model::LoadModel(std::string path)
 }
 
 void R_Model::LoadMesh(std::string meshFile) {
+    DecodeMesh(meshFile);
+    Upload();
+}
+
+void R_Model::DecodeMesh(const std::string& meshFile) {
     std::ifstream inputFile(meshFile.c_str(), std::ios::binary);
     if (!inputFile) {
         LOGGING_ERROR("Failed to open mesh file");
@@ -162,6 +221,7 @@ void R_Model::LoadMesh(std::string meshFile) {
         //Get vertex count
         unsigned int vCount = static_cast<unsigned int>(DecodeBinary<size_t>(serialized, offset));
         // std::cout << "Vertex size is " << vCount << '\n';
+        newVert.reserve(std::min<size_t>(vCount, serialized.size() / sizeof(Vertex)));
         for (unsigned int j{ 0 }; j < vCount; j++) {
             Vertex vert;
             vert.Position.x = DecodeBinary<float>(serialized, offset);
@@ -200,12 +260,13 @@ void R_Model::LoadMesh(std::string meshFile) {
         }
         unsigned int indicesCount = static_cast<unsigned int>(DecodeBinary<size_t>(serialized, offset));
         // std::cout << "Indices size is " << indicesCount << '\n';
+        newIndices.reserve(std::min<size_t>(indicesCount, serialized.size() / sizeof(unsigned int)));
         for (unsigned int i{ 0 }; i < indicesCount; i++) {
             newIndices.push_back(DecodeBinary<unsigned int>(serialized, offset));
         }
 
         // //This sets up and pushes a new mesh into the family
-        this->meshes.push_back(Mesh{ newVert,newIndices,std::vector<Textures>{} });
+        decodedMeshes.push_back(DecodedMesh{ std::move(newVert), std::move(newIndices) });
     }
     unsigned int indicesCount = static_cast<unsigned int>(DecodeBinary<size_t>(serialized, offset));
     for (unsigned int i{ 0 }; i < indicesCount; i++) {
@@ -218,7 +279,7 @@ void R_Model::LoadMesh(std::string meshFile) {
         }
         //std::cout << "KEY " << key << '\n';
         //return;;
-        bones_loaded[key] = DecodeBinary<int>(serialized, offset);
+        decodedBones[key] = DecodeBinary<int>(serialized, offset);
     }
 
     indicesCount = static_cast<unsigned int>(DecodeBinary<size_t>(serialized, offset));
@@ -226,7 +287,7 @@ void R_Model::LoadMesh(std::string meshFile) {
     for (unsigned int i{ 0 }; i < indicesCount; i++) {
         glm::mat4 offsetMatrix = DecodeBinary<glm::mat4>(serialized, offset);
         glm::mat4 transformationMatrix = DecodeBinary<glm::mat4>(serialized, offset);
-        bone_info.push_back(BoneInfo{ offsetMatrix,transformationMatrix });
+        decodedBoneInfo.push_back(BoneInfo{ offsetMatrix,transformationMatrix });
     }
 }
 
@@ -438,17 +499,21 @@ void R_Model::PBRDraw(Shader& shader, std::shared_ptr<PBRMaterial> const& pbrMat
 
 }
 
+void R_Model::PBRDraw(Shader& shader, const PBRMaterial* const* materials, size_t materialCount) {
+    shader.SetBool("isNotRigged", false);
+    for (size_t i = 0, j = 0; i < meshes.size(); i++) {
+        j = j + 1 < materialCount ? j + 1 : j;
+        meshes[i].PBRDraw(shader, *materials[j]);
+    }
+}
+
 void R_Model::DrawAnimation(Shader& shader, PBRMaterial const& pbrMat, const std::vector<glm::mat4>& boneMatrices)
 {
     shader.SetBool("isNotRigged", true);
     if (!boneMatrices.empty())
     {
-        for (int i = 0; i < boneMatrices.size(); i++)
-        {
-            shader.SetMat4("bones[" + std::to_string(i) + "]", boneMatrices[i]);
-        }
+        shader.SetMat4Array("bones", boneMatrices[0], boneMatrices.size());
     }
-    // shader.SetMat4Array("bones", boneMatrices[0], boneMatrices.size());
     for (unsigned int i = 0; i < meshes.size(); i++)
         meshes[i].PBRDraw(shader, pbrMat);
 }
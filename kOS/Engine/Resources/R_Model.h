@@ -69,9 +69,11 @@ class R_Model : public Resource {
 		Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<Textures> textures);
 		void Draw(Shader& shader);
 		void PBRDraw(Shader& shader, PBRMaterial const& mat);
+		//deletes the GL objects, meshes are copied around so this is not done on destruction
+		void Release();
 	private:
 		//  render data
-		unsigned int VAO, VBO, EBO;
+		unsigned int VAO{}, VBO{}, EBO{};
 
 		void SetupMesh();
 	};
@@ -159,6 +161,11 @@ public:
 	void Load() override;
 
 	void Unload() override;
+
+	void Decode() override;
+	void Upload() override;
+	size_t GetUploadSize() const override;
+	ResourceMemory GetMemoryUsage() const override;
 	//Do get resource R_Model
 
 	~R_Model() override {
@@ -167,6 +174,7 @@ public:
 
 	void Draw(Shader& shader);
 	void PBRDraw(Shader& shader, std::shared_ptr < PBRMaterial> const& pbrMat);
+	void PBRDraw(Shader& shader, const PBRMaterial* const* materials, size_t materialCount);
 	void DrawAnimation(Shader& shader, PBRMaterial const& pbrMat, const std::vector<glm::mat4>& boneMatrices);
 
 	const std::vector<Animation>& GetAnimations() const { return animations; }
@@ -186,6 +194,17 @@ public:
 private:
 
 	template <typename T> T DecodeBinary(std::string& bin, int& offset);
+
+	//filled by Decode, turned into meshes by Upload
+	struct DecodedMesh {
+		std::vector<Vertex> vertices;
+		std::vector<unsigned int> indices;
+	};
+	std::vector<DecodedMesh> decodedMeshes;
+	std::unordered_map<std::string, int> decodedBones;
+	std::vector<BoneInfo> decodedBoneInfo;
+	void DecodeMesh(const std::string& meshFile);
+
 	std::vector<Textures> textures_loaded;
 	std::unordered_map<std::string, int> bones_loaded;
 	std::vector<BoneInfo> bone_info; // Only contains the matrices of the bones not the bone itself
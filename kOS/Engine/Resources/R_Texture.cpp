@@ -4,24 +4,78 @@
 #include "R_Texture.h"
 void R_Texture::Load()
 {	
+	Decode();
+	Upload();
+}
+
+void R_Texture::Unload()
+{
+	FreeTexture();
+}
+
+R_Texture::~R_Texture()
+{
+	FreeDecoded();
+}
+
+void R_Texture::Decode()
+{
+	FreeDecoded();
 	std::filesystem::path path = this->GetFilePath();
 	if (path.extension() == ".dds")
 	{
-		LoadDSSTexture(this->m_filePath.string().c_str());
+		decodedDDS = gli::load(this->m_filePath.string().c_str());
+		if (decodedDDS.empty())std::cout << "ERORR LOADING DSS";
 	}
 	else
 	{
 		/// Might wanna handle other file cases
-		stbiLoad(this->m_filePath.string().c_str());
+		decodedPixels = stbi_load(this->m_filePath.string().c_str(), &decodedWidth, &decodedHeight, &decodedChannels, 0);
+		//Load texture
+		if (!decodedPixels) {
+			std::cout << "FAILED TO LOAD TEXURE";
+		}
 	}
 }
 
-void R_Texture::Unload()
+void R_Texture::Upload()
 {
-	FreeTexture();
+	if (this->GetFilePath().extension() == ".dds")
+	{
+		if (!decodedDDS.empty()) LoadDSSTexture();
+		//the file carries its own mips
+		gpuBytes = decodedDDS.empty() ? 0 : decodedDDS.size();
+	}
+	else
+	{
+		width = decodedWidth;
+		height = decodedHeight;
+		stbiLoad();
+		//glGenerateMipmap adds a third on top of the base level
+		gpuBytes = GetUploadSize() * 4 / 3;
+	}
+	FreeDecoded();
+}
+
+size_t R_Texture::GetUploadSize() const
+{
+	if (!decodedDDS.empty()) return decodedDDS.size();
+	return decodedPixels ? static_cast<size_t>(decodedWidth) * static_cast<size_t>(decodedHeight) * static_cast<size_t>(decodedChannels) : 0;
 }
 
-void R_Texture::stbiLoad(const char* texturePath) {
+ResourceMemory R_Texture::GetMemoryUsage() const
+{
+	return ResourceMemory{ 0, gpuBytes };
+}
+
+void R_Texture::FreeDecoded()
+{
+	decodedDDS = gli::texture{};
+	if (decodedPixels) stbi_image_free(decodedPixels);
+	decodedPixels = nullptr;
+}
+
+void R_Texture::stbiLoad() {
 	//Set texture
 	glGenTextures(1, &texture);
 	//Bind textures
@@ -32,13 +86,8 @@ void R_Texture::stbiLoad(const char* texturePath) {
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-	//Load texture
-	int nrChannels;
-	unsigned char* data = stbi_load(texturePath, &width, &height, &nrChannels, 0);
-	//Load texture
-	if (!data) {
-		std::cout << "FAILED TO LOAD TEXURE";
-	}
+	const unsigned char* data = decodedPixels;
+	const int nrChannels = decodedChannels;
 	///std::cout << "Channel of [" << texName << "] is " << nrChannels << std::endl;
 	if (nrChannels == 3) {
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
@@ -55,15 +104,12 @@ void R_Texture::stbiLoad(const char* texturePath) {
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, data);
 	}
 	glGenerateMipmap(GL_TEXTURE_2D);
-	//Free texture
-	stbi_image_free(data);
 	glBindTexture(GL_TEXTURE_2D, 0);
 }
 
-void R_Texture::LoadDSSTexture(const char* texturePath) {
+void R_Texture::LoadDSSTexture() {
 	FreeTexture();
-	gli::texture Texture = gli::load(texturePath);
-	if (Texture.empty())std::cout << "ERORR LOADING DSS";
+	const gli::texture& Texture = decodedDDS;
 
 	gli::gl GL(gli::gl::PROFILE_GL33);
 	gli::gl::format const Format = GL.translate(Texture.format(), Texture.swizzles());
@@ -95,7 +141,9 @@ void R_Texture::LoadDSSTexture(const char* texturePath) {
 void R_Texture::FreeTexture() {
 	//std::cout << "Freeing data";
 	//textureList.erase(name);
-	glDeleteTextures(1, &texture);
+	if (texture) glDeleteTextures(1, &texture);
+	texture = 0;
+	gpuBytes = 0;
 }
 
 /************************************************************************/
@@ -26,10 +26,16 @@ class R_Texture : public Resource {
 
 public:
 	using Resource::Resource;
+	~R_Texture() override;
 	void Load() override;
 
 	void Unload() override;
 
+	void Decode() override;
+	void Upload() override;
+	size_t GetUploadSize() const override;
+	ResourceMemory GetMemoryUsage() const override;
+
 	void Use();
 	unsigned int RetrieveTexture();
 	unsigned int* RetrieveTexturePointer();
@@ -47,9 +53,17 @@ private:
 	int width{}, height{};
 	std::string name{};
 	TextureType type{ TextureType::REGULAR };
+	//texture storage handed to GL, mip chain included
+	size_t gpuBytes{};
+
+	//filled by Decode, released by Upload
+	gli::texture decodedDDS{};
+	unsigned char* decodedPixels{};
+	int decodedWidth{}, decodedHeight{}, decodedChannels{};
 
-	void stbiLoad(const char* texturePath);
-	void LoadDSSTexture(const char* texturePath);
+	void stbiLoad();
+	void LoadDSSTexture();
+	void FreeDecoded();
 	void FreeTexture();
 	
 	
@@ -5,6 +5,17 @@
 \par       jazwinn.ng@digipen.edu
 \date      Sept 28, 2025
 \brief     Resource interface for saving and loading components in ECS.
+		   Load does the whole load on the calling thread. Resources
+		   requested through ResourceManager::GetResourceAsync are
+		   loaded in two steps instead:
+		   - Decode: file read and CPU decoding on a loader thread,
+		     must not touch GL or anything shared with the main thread
+		   - Upload: GL object creation on the main thread
+		   A resource that does not split does all of its loading in
+		   Upload.
+
+		   GetMemoryUsage reports what a ready resource holds, the
+		   ResourceManager counts it against its residency budget.
 
 Copyright (C) 2025 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -14,6 +25,14 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #pragma once
 
 #include "Config/pch.h"
+#include <atomic>
+
+struct ResourceMemory {
+	size_t cpuBytes{};
+	size_t gpuBytes{};
+
+	size_t Total() const { return cpuBytes + gpuBytes; }
+};
 
 class Resource{
 
@@ -26,13 +45,39 @@ public:
 	virtual void Load() = 0;
 	virtual void Unload() = 0;
 
+	virtual void Decode() {}
+	virtual void Upload() { Load(); }
+	//bytes Upload hands to GL, counted against the per frame upload budget
+	virtual size_t GetUploadSize() const { return 0; }
+	//bytes held once ready, asked once when the resource becomes resident
+	virtual ResourceMemory GetMemoryUsage() const { return {}; }
+
 	const inline utility::GUID GetGUID() const { return m_GUID; }
 	const inline std::filesystem::path GetFilePath() const { return m_filePath; }
 
+	//until then the resource is a placeholder, it is safe to use and draws nothing
+	bool IsReady() const { return m_loadState.load(std::memory_order_acquire) == LoadState::READY; }
+
 
 protected:
 
 	utility::GUID m_GUID;
 	std::filesystem::path m_filePath;
 
+private:
+	friend class ResourceManager;
+
+	enum class LoadState : uint8_t {
+		QUEUED,
+		DECODING,
+		DECODED,
+		READY
+	};
+	std::atomic<LoadState> m_loadState{ LoadState::QUEUED };
+
+	//residency, kept by the ResourceManager
+	std::atomic<uint64_t> m_lastUsedFrame{ 0 };
+	ResourceMemory m_residentMemory{};
+	bool m_resident{ false };
+
 };
@@ -0,0 +1,34 @@
+/******************************************************************/
+/*!
+\file      ResourceHandle.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Typed handle into the ResourceManager's handle table. A
+		   handle is an index and the version of the slot it was
+		   handed out for, once the resource is unloaded the slot's
+		   version moves on and the handle resolves to nullptr.
+
+		   Resolving a handle does not hash the GUID and does not
+		   touch a refcount, the manager keeps the resource alive.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+template <typename T>
+struct ResourceHandle {
+	static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+	uint32_t index{ INVALID_INDEX };
+	uint32_t version{};
+
+	bool IsNull() const { return index == INVALID_INDEX; }
+	bool operator==(const ResourceHandle&) const = default;
+};
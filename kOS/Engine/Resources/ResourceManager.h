@@ -11,6 +11,20 @@
 			- ClearAllResources: Unloads all resources managed by the ResourceManager.
 			- ResourceExists: Checks if a resource with the given GUID exists in the manager.
 			- GetAllResourcesOfType: Retrieves all resources of a specific type.
+			- GetResourceAsync: Returns the resource at once, it is decoded on a
+			  loader thread and uploaded to GL by ProcessUploads. Until then
+			  IsReady is false and the resource draws nothing.
+			- Prefetch: Queues resources by GUID alone, the type is found from
+			  the file extension on the loader thread.
+			- ProcessUploads: Main thread, once per frame. Uploads decoded
+			  resources until the per frame byte budget is used up.
+			- GetHandle / Resolve: GetHandle looks the GUID up once and hands
+			  out a ResourceHandle to cache, Resolve turns it back into the
+			  resource every frame without hashing or refcounting.
+			- EndFrame: Main thread, once per frame after rendering. While the
+			  resident resources are over the memory budget, the least
+			  recently used ones nothing else holds are unloaded.
+			- CollectGarbage: Unloads every resource nothing else holds.
 
 Copyright (C) 2025 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -20,7 +34,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #pragma once
 
 #include "Config/pch.h"
+#include <mutex>
+#include "Debugging/Profiler.h"
+#include "Utility/JobSystem.h"
 #include "Resources/Resource.h"
+#include "Resources/ResourceHandle.h"
 #include "Resources/R_Model.h"
 #include "Resources/R_Font.h"
 #include "Resources/R_Scene.h"
@@ -46,6 +64,9 @@ public:
 
 	~ResourceManager() = default;
 
+	ResourceManager(const ResourceManager&) = delete;
+	ResourceManager& operator=(const ResourceManager&) = delete;
+
 	void Init(const std::string& Directory) {
 		m_resourceDirectory = Directory;
 	}
@@ -56,10 +77,16 @@ public:
 		//check if resrouce is already loaded
 		if (GUID.Empty()) return nullptr;
 
+		//systems on worker threads (eg. audio) share the map with the main thread
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+
 		if (m_resourceMap.find(GUID) != m_resourceMap.end()) {
 
 			auto asset = m_resourceMap.at(GUID);
 			if (asset) {
+				Touch(*asset);
+				//requested async earlier and still loading
+				if (!asset->IsReady()) FinishLoad(asset);
 				return std::static_pointer_cast<T>(asset);
 			}
 		}
@@ -70,26 +97,177 @@ public:
 		//Check if file path exists
 
 		//load asset
+		KOS_PROFILE_SCOPE("ResourceManager::Load");
 		auto asset = std::make_shared<T>(GUID, path);
 		asset->Load();
+		asset->m_loadState.store(Resource::LoadState::READY, std::memory_order_release);
+		Touch(*asset);
+		MarkResident(*asset);
 		m_resourceMap[GUID] = asset;
 		return asset;
 
 
 	}
 
+	template<typename T>
+	std::shared_ptr<T> GetResourceAsync(const utility::GUID& GUID) {
+		if (GUID.Empty()) return nullptr;
 
-	inline void CollectGarbage() {
-		for (auto it = m_resourceMap.begin(); it != m_resourceMap.end();) {
-			if (it->second.use_count() == 1) {
-				LOGGING_INFO("Unloading Asset UID: " + it->first.GetToString());
-				it->second->Unload();
-				it = m_resourceMap.erase(it);
-			}
-			else {
-				++it;
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+		auto it = m_resourceMap.find(GUID);
+		if (it != m_resourceMap.end() && it->second) {
+			Touch(*it->second);
+			return std::static_pointer_cast<T>(it->second);
+		}
+
+		auto asset = std::make_shared<T>(GUID, GetResourcePath<T>(GUID));
+		Touch(*asset);
+		m_resourceMap[GUID] = asset;
+		m_pendingLoads.fetch_add(1, std::memory_order_relaxed);
+		m_loaderJobs.Submit([this, asset]() {
+			DecodeResource(asset);
+			});
+		return asset;
+	}
+
+	//GUIDs that are not resources (eg. entity references) are dropped once no file is found for them
+	inline void Prefetch(const std::vector<utility::GUID>& GUIDs) {
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+		for (const utility::GUID& GUID : GUIDs) {
+			if (GUID.Empty() || m_resourceMap.find(GUID) != m_resourceMap.end()) continue;
+			if (!m_prefetching.insert(GUID).second) continue;
+
+			m_pendingLoads.fetch_add(1, std::memory_order_relaxed);
+			m_loaderJobs.Submit([this, GUID]() {
+				PrefetchResource(GUID);
+				});
+		}
+	}
+
+	inline void ProcessUploads() {
+		if (m_pendingLoads.load(std::memory_order_acquire) == 0) return;
+		KOS_PROFILE_SCOPE("ResourceManager::ProcessUploads");
+
+		size_t uploadedBytes{};
+		while (true) {
+			std::shared_ptr<Resource> resource;
+			{
+				std::lock_guard<std::mutex> lock(m_uploadMutex);
+				if (m_uploadQueue.empty()) break;
+				//at least one upload per frame so a large resource is never stuck
+				const size_t size = m_uploadQueue.front()->GetUploadSize();
+				if (uploadedBytes > 0 && uploadedBytes + size > m_uploadBudget) break;
+				resource = std::move(m_uploadQueue.front());
+				m_uploadQueue.pop_front();
+				uploadedBytes += size;
 			}
+			//finished early by GetResource
+			if (resource->IsReady()) continue;
+			UploadResource(*resource);
+		}
+	}
+
+	//blocks until every resource requested so far is ready, eg. behind a loading screen
+	inline void FinishPendingLoads() {
+		const size_t budget = m_uploadBudget;
+		m_uploadBudget = std::numeric_limits<size_t>::max();
+		while (m_pendingLoads.load(std::memory_order_acquire) > 0) {
+			ProcessUploads();
+			std::this_thread::yield();
+		}
+		m_uploadBudget = budget;
+	}
+
+	void SetUploadBudget(size_t bytes) { m_uploadBudget = bytes; }
+	size_t GetUploadBudget() const { return m_uploadBudget; }
+	size_t GetPendingLoadCount() const { return m_pendingLoads.load(std::memory_order_acquire); }
+
+
+	//main thread, the handle table is read without a lock
+	template<typename T>
+	ResourceHandle<T> GetHandle(const utility::GUID& GUID) {
+		if (GUID.Empty()) return {};
+
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+		auto it = m_handleIndex.find(GUID);
+		if (it != m_handleIndex.end()) {
+			return ResourceHandle<T>{ it->second, m_handleSlots[it->second].version };
+		}
+
+		std::shared_ptr<T> resource = GetResourceAsync<T>(GUID);
+		uint32_t index{};
+		if (!m_freeHandleSlots.empty()) {
+			index = m_freeHandleSlots.back();
+			m_freeHandleSlots.pop_back();
 		}
+		else {
+			index = static_cast<uint32_t>(m_handleSlots.size());
+			m_handleSlots.emplace_back();
+		}
+		//the map keeps the resource alive, the slot only points at it
+		m_handleSlots[index].resource = resource.get();
+		m_handleIndex[GUID] = index;
+		return ResourceHandle<T>{ index, m_handleSlots[index].version };
+	}
+
+	//nullptr for a null handle or once the resource was unloaded, main thread
+	template<typename T>
+	T* Resolve(ResourceHandle<T> handle) const {
+		if (handle.index >= m_handleSlots.size()) return nullptr;
+		const HandleSlot& slot = m_handleSlots[handle.index];
+		if (slot.version != handle.version) return nullptr;
+		Touch(*slot.resource);
+		return static_cast<T*>(slot.resource);
+	}
+
+	//main thread, once per frame after rendering, nothing drawn this frame is unloaded
+	inline void EndFrame() {
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+		if (m_residentMemory.Total() > m_memoryBudget) {
+			KOS_PROFILE_SCOPE("ResourceManager::Evict");
+			EvictLeastRecentlyUsed(m_memoryBudget, m_frame.load(std::memory_order_relaxed));
+		}
+		m_frame.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	//unloads every resource that nothing outside the manager holds, eg. on scene clear
+	inline void CollectGarbage() {
+		EvictLeastRecentlyUsed(0, std::numeric_limits<uint64_t>::max());
+	}
+
+	//cached handles to it go stale, a resource still loading is left alone
+	inline void UnloadResource(const utility::GUID& GUID) {
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+		auto it = m_resourceMap.find(GUID);
+		if (it == m_resourceMap.end() || !it->second || !it->second->IsReady()) return;
+		LOGGING_INFO("Unloading Asset UID: " + GUID.GetToString());
+		ReleaseHandle(GUID);
+		if (it->second->m_resident) {
+			AddResidentMemory(*it->second, it->second->m_residentMemory, -1);
+			it->second->m_resident = false;
+		}
+		it->second->Unload();
+		m_resourceMap.erase(it);
+	}
+
+	//GPU and CPU bytes of the ready resources counted together
+	void SetMemoryBudget(size_t bytes) { m_memoryBudget = bytes; }
+	size_t GetMemoryBudget() const { return m_memoryBudget; }
+
+	struct TypeMemory {
+		size_t count{};
+		ResourceMemory memory{};
+	};
+
+	ResourceMemory GetResidentMemory() const {
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+		return m_residentMemory;
+	}
+
+	//keyed by resource class name
+	std::unordered_map<std::string, TypeMemory> GetMemoryUsageByType() const {
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+		return m_typeMemory;
 	}
 
 
@@ -117,14 +295,198 @@ private:
 	void RegisterResourceType(const std::string& extension) {
 		std::string className = T::classname();
 		m_resourceExtension[T::classname()] = extension;
+		m_resourceTypeName[extension] = className;
+		m_resourceFactory[extension] = [](const utility::GUID& GUID, const std::filesystem::path& path) -> std::shared_ptr<Resource> {
+			return std::make_shared<T>(GUID, path);
+			};
+	}
+
+	//cached handles to the resource go stale
+	inline void ReleaseHandle(const utility::GUID& GUID) {
+		auto it = m_handleIndex.find(GUID);
+		if (it == m_handleIndex.end()) return;
+
+		HandleSlot& slot = m_handleSlots[it->second];
+		slot.resource = nullptr;
+		++slot.version;
+		m_freeHandleSlots.push_back(it->second);
+		m_handleIndex.erase(it);
+	}
+
+	//loader thread
+	inline void DecodeResource(const std::shared_ptr<Resource>& resource) {
+		Resource::LoadState expected = Resource::LoadState::QUEUED;
+		//GetResource took it over
+		if (!resource->m_loadState.compare_exchange_strong(expected, Resource::LoadState::DECODING)) return;
+		{
+			KOS_PROFILE_SCOPE("ResourceManager::Decode");
+			resource->Decode();
+		}
+		resource->m_loadState.store(Resource::LoadState::DECODED, std::memory_order_release);
+
+		std::lock_guard<std::mutex> lock(m_uploadMutex);
+		m_uploadQueue.push_back(resource);
+	}
+
+	//loader thread
+	inline void PrefetchResource(const utility::GUID& GUID) {
+		std::shared_ptr<Resource> resource;
+		for (const auto& [extension, factory] : m_resourceFactory) {
+			const std::filesystem::path path = m_resourceDirectory + "/" + GUID.GetToString() + extension;
+			if (!std::filesystem::exists(path)) continue;
+			resource = factory(GUID, path);
+			break;
+		}
+
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+			m_prefetching.erase(GUID);
+			//no file, or requested by type since
+			if (!resource || m_resourceMap.find(GUID) != m_resourceMap.end()) {
+				m_pendingLoads.fetch_sub(1, std::memory_order_release);
+				return;
+			}
+			Touch(*resource);
+			m_resourceMap[GUID] = resource;
+		}
+		DecodeResource(resource);
+	}
+
+	//main thread
+	inline void UploadResource(Resource& resource) {
+		KOS_PROFILE_SCOPE("ResourceManager::Upload");
+		resource.Upload();
+		resource.m_loadState.store(Resource::LoadState::READY, std::memory_order_release);
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+			MarkResident(resource);
+		}
+		m_pendingLoads.fetch_sub(1, std::memory_order_release);
+	}
+
+	inline void Touch(Resource& resource) const {
+		resource.m_lastUsedFrame.store(m_frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+
+	//resource mutex held
+	inline void MarkResident(Resource& resource) {
+		if (resource.m_resident) return;
+		resource.m_resident = true;
+		resource.m_residentMemory = resource.GetMemoryUsage();
+		AddResidentMemory(resource, resource.m_residentMemory, 1);
+	}
+
+	inline void AddResidentMemory(const Resource& resource, const ResourceMemory& memory, int count) {
+		auto typeIt = m_resourceTypeName.find(resource.GetFilePath().extension().string());
+		TypeMemory& typeMemory = m_typeMemory[typeIt != m_resourceTypeName.end() ? typeIt->second : std::string{ "Unknown" }];
+		if (count > 0) {
+			m_residentMemory.cpuBytes += memory.cpuBytes;
+			m_residentMemory.gpuBytes += memory.gpuBytes;
+			typeMemory.memory.cpuBytes += memory.cpuBytes;
+			typeMemory.memory.gpuBytes += memory.gpuBytes;
+			++typeMemory.count;
+		}
+		else {
+			m_residentMemory.cpuBytes -= memory.cpuBytes;
+			m_residentMemory.gpuBytes -= memory.gpuBytes;
+			typeMemory.memory.cpuBytes -= memory.cpuBytes;
+			typeMemory.memory.gpuBytes -= memory.gpuBytes;
+			--typeMemory.count;
+		}
+	}
+
+	//only the map holds it and it is not loading
+	static bool IsEvictable(const std::shared_ptr<Resource>& resource) {
+		return resource.use_count() == 1 && resource->IsReady();
+	}
+
+	//unreferenced resources not used since usedBefore, least recently used first, until the budget is met
+	inline void EvictLeastRecentlyUsed(size_t budget, uint64_t usedBefore) {
+		std::lock_guard<std::recursive_mutex> lock(m_resourceMutex);
+		std::vector<std::pair<uint64_t, utility::GUID>> candidates;
+		bool evicted = true;
+		//unloading a material lets go of its textures, they are picked up on the next pass
+		while (evicted && m_residentMemory.Total() > budget) {
+			evicted = false;
+			candidates.clear();
+			for (const auto& [GUID, resource] : m_resourceMap) {
+				if (!resource || !IsEvictable(resource)) continue;
+				const uint64_t lastUsed = resource->m_lastUsedFrame.load(std::memory_order_relaxed);
+				if (lastUsed < usedBefore) candidates.emplace_back(lastUsed, GUID);
+			}
+			std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+			for (const auto& [lastUsed, GUID] : candidates) {
+				if (m_residentMemory.Total() <= budget) break;
+				UnloadResource(GUID);
+				evicted = true;
+			}
+		}
+	}
+
+
+	//a blocking request for a resource that is still loading
+	inline void FinishLoad(const std::shared_ptr<Resource>& resource) {
+		Resource::LoadState expected = Resource::LoadState::QUEUED;
+		if (resource->m_loadState.compare_exchange_strong(expected, Resource::LoadState::DECODING)) {
+			resource->Decode();
+			resource->m_loadState.store(Resource::LoadState::DECODED, std::memory_order_release);
+			//the loader skips it now, queue the upload for the main thread
+			if (std::this_thread::get_id() != m_mainThread) {
+				std::lock_guard<std::mutex> lock(m_uploadMutex);
+				m_uploadQueue.push_back(resource);
+			}
+		}
+		while (resource->m_loadState.load(std::memory_order_acquire) == Resource::LoadState::DECODING) {
+			std::this_thread::yield();
+		}
+
+		//GL only on the main thread, other threads get the resource once ProcessUploads ran
+		if (std::this_thread::get_id() != m_mainThread) return;
+		if (resource->m_loadState.load(std::memory_order_acquire) == Resource::LoadState::DECODED) {
+			UploadResource(*resource);
+		}
 	}
 
 private:
 
 	std::unordered_map<std::string, std::string> m_resourceExtension;
+	//extension to a new resource of the registered type
+	std::unordered_map<std::string, std::function<std::shared_ptr<Resource>(const utility::GUID&, const std::filesystem::path&)>> m_resourceFactory;
 
 
 	//Key - GUID
 	std::unordered_map<utility::GUID, std::shared_ptr<Resource>> m_resourceMap;
 	std::string m_resourceDirectory;
+	mutable std::recursive_mutex m_resourceMutex;
+
+	struct HandleSlot {
+		Resource* resource{};
+		//starts at 1 so a default constructed handle never resolves
+		uint32_t version{ 1 };
+	};
+	std::vector<HandleSlot> m_handleSlots;
+	std::vector<uint32_t> m_freeHandleSlots;
+	std::unordered_map<utility::GUID, uint32_t> m_handleIndex;
+
+	//residency
+	std::atomic<uint64_t> m_frame{ 1 };
+	size_t m_memoryBudget{ std::numeric_limits<size_t>::max() };
+	ResourceMemory m_residentMemory{};
+	std::unordered_map<std::string, TypeMemory> m_typeMemory;
+	//extension to class name
+	std::unordered_map<std::string, std::string> m_resourceTypeName;
+
+	//async loading
+	const std::thread::id m_mainThread{ std::this_thread::get_id() };
+	std::unordered_set<utility::GUID> m_prefetching;
+	std::mutex m_uploadMutex;
+	std::deque<std::shared_ptr<Resource>> m_uploadQueue;
+	size_t m_uploadBudget{ 16 * 1024 * 1024 };
+	//requested async or prefetched and not ready yet
+	std::atomic<size_t> m_pendingLoads{ 0 };
+
+	//separate from the ECS job system, a decode must never run on the main thread while it waits for systems
+	//declared last so the loaders are joined before anything they use is destroyed
+	utility::JobSystem m_loaderJobs{ 2 };
 };
\ No newline at end of file
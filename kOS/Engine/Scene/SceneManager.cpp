@@ -33,11 +33,44 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <RAPIDJSON/filewritestream.h>
 #include <RAPIDJSON/stringbuffer.h>
 #include "ECS/ecs.h"
+#include "Debugging/Profiler.h"
 
 
 
 namespace scenes {
 
+    namespace {
+        bool LooksLikeGUID(const rapidjson::Value& value) {
+            if (!value.IsString() || value.GetStringLength() != 36) return false;
+            const char* text = value.GetString();
+            return text[8] == '-' && text[13] == '-' && text[18] == '-' && text[23] == '-';
+        }
+
+        //every GUID string in the component data, entities referencing each other are filtered out later
+        void CollectGUIDs(const rapidjson::Value& value, std::vector<utility::GUID>& guids) {
+            if (LooksLikeGUID(value)) {
+                utility::GUID guid{};
+                try {
+                    guid.SetFromString(value.GetString());
+                }
+                catch (const std::invalid_argument&) {
+                    return;
+                }
+                if (!guid.Empty()) guids.push_back(guid);
+            }
+            else if (value.IsObject()) {
+                for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member) {
+                    CollectGUIDs(member->value, guids);
+                }
+            }
+            else if (value.IsArray()) {
+                for (const auto& element : value.GetArray()) {
+                    CollectGUIDs(element, guids);
+                }
+            }
+        }
+    }
+
 
     bool SceneManager::CreateNewScene(const std::filesystem::path& scene)
     {
@@ -77,38 +110,18 @@ namespace scenes {
 
     void SceneManager::ReloadScene()
     {
-        // If Cached Scenes exist reload all Cached Scenes
-        if (cacheScenePath.size() > 0) {
-            std::vector<std::string> scenesToClear;
-            for (auto& [scene, data] : m_ecs.sceneMap) {
-                if (!data.isPrefab) {
-                    scenesToClear.push_back(scene);
-                }
-            }
-            for (auto const& scene : scenesToClear) {
-                ImmediateClearScene(scene);
-            }
-            const std::string cacheExt("[Cached]");
-            for (auto& filePath : cacheScenePath) {
-                std::string fileName = filePath.filename().string();
-                size_t pos = fileName.find(cacheExt);
-                if (pos != std::string::npos) {
-                    fileName.erase(pos, cacheExt.size());
-                }
-                ImmediateLoadScene(filePath, fileName);
+        // Play mode snapshot, put the scenes back as they were when play started
+        if (!m_playSnapshot.Empty()) {
+            m_ecs.RestoreSnapshot(m_playSnapshot);
+            loadScenePath = std::move(m_playScenePath);
+            m_playScenePath.clear();
+            //prefab scenes loaded during play and their pooled instances are gone too
+            m_prefabTemplates.clear();
+
+            //scenes streamed in during play went away with the play state
+            for (auto& load : m_streamingLoads) {
+                if (!load->finished) CancelStreamingLoad(*load);
             }
-            // Change File Path for loadScenePath since filepath for cached scenes will contain [Cached]
-            for (auto& [scene, filePath] : loadScenePath) {
-                std::string path = filePath.string();
-                size_t pos = path.find(cacheExt);
-                if (pos != std::string::npos) {
-                    path.erase(pos, cacheExt.size());
-                    filePath = path;
-                }
-            }
-
-            DeleteAllCacheScenes();
-            cacheScenePath.clear();
         }
         else {
             //store scene path
@@ -214,10 +227,13 @@ namespace scenes {
 			}
             m_loadQueue.clear();
 		}
+
+        UpdateStreaming();
 	}
 
 	bool SceneManager::ImmediateLoadScene(const std::filesystem::path& scene, const std::string forcedSceneName)
 	{
+		KOS_PROFILE_SCOPE("SceneManager::ImmediateLoadScene");
 
 		if (m_ecs.sceneMap.find(scene.filename().string()) != m_ecs.sceneMap.end()) {
 
@@ -257,31 +273,36 @@ namespace scenes {
 
 	void SceneManager::ImmediateClearScene(const std::string& scene)
 	{
-        auto entityids = m_ecs.sceneMap.find(scene)->second.sceneIDs;
-        for (auto id : entityids) {
-            if (!m_ecs.GetParent(id)) {
-                m_ecs.DeleteEntity(id);
+        const auto sceneIt = m_ecs.sceneMap.find(scene);
+        if (sceneIt != m_ecs.sceneMap.end()) {
+            auto entityids = sceneIt->second.sceneIDs;
+            for (auto id : entityids) {
+                if (!m_ecs.GetParent(id)) {
+                    m_ecs.DeleteEntity(id);
+                }
             }
-        }
 
 
-		//remove scene from activescenes
-		m_ecs.sceneMap.erase(scene);
+            //remove scene from activescenes
+            m_ecs.sceneMap.erase(scene);
+        }
+
+        //a scene cleared while it streams in stops loading
+        if (StreamingLoad* load = FindStreamingLoad(scene)) {
+            CancelStreamingLoad(*load);
+        }
 	}
 
 
 	void SceneManager::SwapScenes(const std::string& oldscene, const std::string& newscene, ecs::EntityID id)
     {
-        std::vector<ecs::EntityID>& vectorenityid = m_ecs.sceneMap.find(oldscene)->second.sceneIDs;
-        std::vector<ecs::EntityID>::iterator it = std::find(vectorenityid.begin(), vectorenityid.end(), id);
-        if (it == vectorenityid.end()) {
+        if (m_ecs.GetSceneByEntityID(id) != oldscene) {
             LOGGING_ERROR("Entity not in old scene");
             return;
         }
         
-        vectorenityid.erase(it);
-
-        m_ecs.sceneMap.find(newscene)->second.sceneIDs.push_back(id);
+        m_ecs.RemoveEntityFromScene(id);
+        m_ecs.AddEntityToScene(id, newscene);
 
     }
 
@@ -308,33 +329,10 @@ namespace scenes {
 		}
     }
 
-    // Files will be cached in the same location with added "filename[Cached].json" label
+    // Snapshot of every scene in memory, restored by ReloadScene when play stops
     void SceneManager::CacheCurrentScene(){
-
-        for (auto [fileName, path] : loadScenePath) {
-            auto iter = m_ecs.sceneMap.find(fileName);
-            if (iter != m_ecs.sceneMap.end()) {
-                if (iter->second.isPrefab) continue;
-                std::string newPath = path.parent_path().string() + '\\' + path.stem().string() + "[Cached]" + path.extension().string();
-                if (std::filesystem::exists(newPath)) {
-                    std::filesystem::remove(newPath);
-                    std::string metaPath = newPath + ".meta";
-                    if (std::filesystem::exists(metaPath)) {
-                        std::filesystem::remove(metaPath);
-                    }
-                }
-                cacheScenePath.push_back(newPath);
-                m_serialization.SaveScene(fileName, newPath);
-
-                SetFileAttributesA(newPath.c_str(), GetFileAttributesA(newPath.c_str()) | FILE_ATTRIBUTE_HIDDEN);
-            }
-        }
-    }
-
-    void SceneManager::DeleteAllCacheScenes() {
-        for (auto const& filePath : cacheScenePath) {
-            std::filesystem::remove(filePath);
-        }
+        m_ecs.TakeSnapshot(m_playSnapshot);
+        m_playScenePath = loadScenePath;
     }
 
     void SceneManager::LoadSceneToCurrent(const std::string& currentScene, const std::filesystem::path& filepath) {
@@ -353,6 +351,415 @@ namespace scenes {
 			sceneData.sceneIDs.begin(), sceneData.sceneIDs.end());
     }
 
+    // Prefab template, the file is loaded into an inactive prefab scene the way the editor loads prefabs
+    SceneManager::PrefabTemplate* SceneManager::GetPrefabTemplate(const std::filesystem::path& prefabPath) {
+        const std::string scenename = prefabPath.filename().string();
+
+        const auto templateIt = m_prefabTemplates.find(scenename);
+        if (templateIt != m_prefabTemplates.end()) {
+            const PrefabTemplate& prefab = templateIt->second;
+            if (m_ecs.sceneMap.find(prefab.scene) != m_ecs.sceneMap.end() && m_ecs.IsValidEntity(prefab.root)
+                && m_ecs.GetSceneByEntityID(prefab.root) == prefab.scene) {
+                return &templateIt->second;
+            }
+            //the prefab scene was cleared since
+            m_prefabTemplates.erase(templateIt);
+        }
+
+        if (m_ecs.sceneMap.find(scenename) == m_ecs.sceneMap.end()) {
+            if (!std::filesystem::exists(prefabPath)) {
+                LOGGING_WARN("Prefab file does not exist");
+                return nullptr;
+            }
+            if (!ImmediateLoadScene(prefabPath)) return nullptr;
+            m_ecs.sceneMap.at(scenename).isPrefab = true;
+            SetSceneActive(scenename, false);
+        }
+
+        SceneData& prefabData = m_ecs.sceneMap.at(scenename);
+        for (const auto id : prefabData.sceneIDs) {
+            if (m_ecs.GetParent(id)) continue;
+
+            prefabData.prefabID = id;
+            m_ecs.GetComponent<ecs::NameComponent>(id)->prefabName = scenename;
+
+            PrefabTemplate& prefab = m_prefabTemplates[scenename];
+            prefab.scene = scenename;
+            prefab.root = id;
+            return &prefab;
+        }
+
+        LOGGING_WARN("Prefab has no entities");
+        return nullptr;
+    }
+
+    int SceneManager::InstantiatePrefab(const std::filesystem::path& prefabPath, const std::string& scene) {
+        KOS_PROFILE_SCOPE("SceneManager::InstantiatePrefab");
+
+        if (m_ecs.sceneMap.find(scene) == m_ecs.sceneMap.end()) {
+            LOGGING_WARN("Scene not loaded");
+            return -1;
+        }
+        PrefabTemplate* prefab = GetPrefabTemplate(prefabPath);
+        if (!prefab) return -1;
+
+        //each new entity joins its systems once, not once per component copied
+        ecs::RegistrationBatchScope registrationBatch(m_ecs);
+
+        while (!prefab->pool.empty()) {
+            const ecs::EntityID instance = m_ecs.Resolve(prefab->pool.back());
+            prefab->pool.pop_back();
+            //deleted with its scene while it was pooled
+            if (instance < 0) continue;
+
+            if (MatchesPrefabHierarchy(prefab->root, instance)) {
+                if (m_ecs.GetParent(instance)) m_ecs.RemoveParent(instance);
+                ResetPrefabInstance(prefab->root, instance, scene);
+                return static_cast<int>(instance);
+            }
+            //children were added or removed at runtime, it can not be reset
+            m_ecs.DeleteEntity(instance);
+        }
+
+        return static_cast<int>(m_ecs.DuplicateEntity(prefab->root, scene));
+    }
+
+    void SceneManager::SetPrefabPoolCapacity(const std::filesystem::path& prefabPath, size_t capacity) {
+        PrefabTemplate* prefab = GetPrefabTemplate(prefabPath);
+        if (!prefab) return;
+
+        prefab->poolCapacity = capacity;
+        while (prefab->pool.size() > capacity) {
+            const ecs::EntityID instance = m_ecs.Resolve(prefab->pool.back());
+            prefab->pool.pop_back();
+            if (instance >= 0) m_ecs.DeleteEntity(instance);
+        }
+    }
+
+    void SceneManager::ReleasePrefabInstance(ecs::EntityID root) {
+        if (!m_ecs.IsValidEntity(root)) return;
+
+        const auto* name = m_ecs.GetComponent<ecs::NameComponent>(root);
+        const auto templateIt = m_prefabTemplates.find(name->prefabName);
+        if (templateIt == m_prefabTemplates.end() || templateIt->second.root == root) {
+            m_ecs.DeleteEntity(root);
+            return;
+        }
+
+        PrefabTemplate& prefab = templateIt->second;
+        const ecs::EntityHandle handle = m_ecs.GetHandle(root);
+        //released twice
+        if (std::find(prefab.pool.begin(), prefab.pool.end(), handle) != prefab.pool.end()) return;
+
+        if (prefab.pool.size() >= prefab.poolCapacity) {
+            m_ecs.DeleteEntity(root);
+            return;
+        }
+
+        SetInstanceHidden(root);
+        prefab.pool.push_back(handle);
+    }
+
+    size_t SceneManager::GetPooledInstanceCount(const std::filesystem::path& prefabPath) const {
+        const auto templateIt = m_prefabTemplates.find(prefabPath.filename().string());
+        return templateIt != m_prefabTemplates.end() ? templateIt->second.pool.size() : 0;
+    }
+
+    bool SceneManager::MatchesPrefabHierarchy(ecs::EntityID source, ecs::EntityID instance) {
+        const auto sourceChildren = m_ecs.GetChild(source);
+        const auto instanceChildren = m_ecs.GetChild(instance);
+        const size_t sourceCount = sourceChildren ? sourceChildren->size() : 0;
+        const size_t instanceCount = instanceChildren ? instanceChildren->size() : 0;
+        if (sourceCount != instanceCount) return false;
+
+        for (size_t i = 0; i < sourceCount; ++i) {
+            if (!MatchesPrefabHierarchy((*sourceChildren)[i], (*instanceChildren)[i])) return false;
+        }
+        return true;
+    }
+
+    void SceneManager::ResetPrefabInstance(ecs::EntityID source, ecs::EntityID instance, const std::string& scene) {
+        const ecs::ComponentSignature sourceSignature = m_ecs.GetEntitySignature(source);
+        const ecs::ComponentSignature instanceSignature = m_ecs.GetEntitySignature(instance);
+
+        for (const auto& [componentName, key] : m_ecs.GetComponentKeyData()) {
+            const bool inSource = sourceSignature.test(key);
+            const bool inInstance = instanceSignature.test(key);
+            if (!inSource && !inInstance) continue;
+
+            auto& action = m_ecs.componentAction.at(componentName);
+            //name and transform keep the GUID and the hierarchy, every other component is
+            //made again so no runtime state (scripts, physics actors) carries over
+            const bool keep = componentName == ecs::NameComponent::classname() || componentName == ecs::TransformComponent::classname();
+            if (inInstance && !keep) {
+                action->RemoveComponent(instance);
+            }
+            if (inSource) {
+                action->DuplicateComponent(source, instance);
+            }
+        }
+
+        if (m_ecs.GetSceneByEntityID(instance) != scene) {
+            m_ecs.RemoveEntityFromScene(instance);
+            m_ecs.AddEntityToScene(instance, scene);
+        }
+        m_ecs.RegisterEntity(instance);
+
+        const auto sourceChildren = m_ecs.GetChild(source);
+        const auto instanceChildren = m_ecs.GetChild(instance);
+        if (!sourceChildren || !instanceChildren) return;
+        for (size_t i = 0; i < sourceChildren->size(); ++i) {
+            ResetPrefabInstance((*sourceChildren)[i], (*instanceChildren)[i], scene);
+        }
+    }
+
+    void SceneManager::SetInstanceHidden(ecs::EntityID instance) {
+        m_ecs.DeregisterEntity(instance);
+        m_ecs.GetComponent<ecs::NameComponent>(instance)->hide = true;
+
+        if (const auto children = m_ecs.GetChild(instance)) {
+            for (const auto child : *children) {
+                SetInstanceHidden(child);
+            }
+        }
+    }
+
+
+    void SceneManager::LoadSceneAsync(const std::filesystem::path& scene, const std::string forcedSceneName)
+    {
+        std::string scenename = forcedSceneName.empty() ? scene.filename().string() : forcedSceneName;
+
+        if (m_ecs.sceneMap.find(scenename) != m_ecs.sceneMap.end() || FindStreamingLoad(scenename)) {
+            LOGGING_WARN("Scene already loaded");
+            return;
+        }
+
+        auto load = std::make_unique<StreamingLoad>();
+        load->scene = scenename;
+        load->path = scene;
+        load->cancelled = std::make_shared<std::atomic<bool>>(false);
+        //the worker only sees the path and the flag, the load itself may be dropped before it finishes
+        load->parsing = std::async(std::launch::async, [path = scene, cancelled = load->cancelled]() {
+            return ParseSceneFile(path, *cancelled);
+            });
+
+        LOGGING_INFO("Streaming entities from: {}", scene.string().c_str());
+        m_streamingLoads.push_back(std::move(load));
+    }
+
+    void SceneManager::CancelSceneLoad(const std::string& scene)
+    {
+        StreamingLoad* load = FindStreamingLoad(scene);
+        if (!load) return;
+
+        if (load->instantiating) {
+            //removes the entities created so far, then cancels
+            ImmediateClearScene(scene);
+        }
+        else {
+            CancelStreamingLoad(*load);
+        }
+    }
+
+    bool SceneManager::IsSceneLoading(const std::string& scene) const
+    {
+        return FindStreamingLoad(scene) != nullptr;
+    }
+
+    float SceneManager::GetSceneLoadProgress(const std::string& scene) const
+    {
+        const StreamingLoad* load = FindStreamingLoad(scene);
+        if (!load) return 1.f;
+        if (!load->parsed || load->parsed->entities.empty()) return 0.f;
+        return static_cast<float>(load->created.size()) / static_cast<float>(load->parsed->entities.size());
+    }
+
+    std::unique_ptr<SceneManager::ParsedScene> SceneManager::ParseSceneFile(const std::filesystem::path& path, const std::atomic<bool>& cancelled)
+    {
+        KOS_PROFILE_SCOPE("SceneManager::ParseSceneFile");
+
+        std::ifstream inputFile(path.string());
+        if (!inputFile) {
+            LOGGING_ERROR("Failed to open JSON file for reading: {}", path.string().c_str());
+            return nullptr;
+        }
+        std::string fileContent((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+        inputFile.close();
+        if (cancelled) return nullptr;
+
+        auto parsed = std::make_unique<ParsedScene>();
+        parsed->document.Parse(fileContent.c_str());
+        if (parsed->document.HasParseError() || !parsed->document.IsArray()) {
+            LOGGING_ERROR("Failed to parse scene: {}", path.string().c_str());
+            return nullptr;
+        }
+        if (cancelled) return nullptr;
+
+        //same order LoadEntity creates them in, each entity followed by its children
+        std::vector<utility::GUID> entityGUIDs;
+        std::function<void(const rapidjson::Value&, int32_t)> addEntity = [&](const rapidjson::Value& entityData, int32_t parent) {
+            const int32_t index = static_cast<int32_t>(parsed->entities.size());
+            parsed->entities.push_back(ParsedScene::Entity{ &entityData, parent });
+
+            for (auto member = entityData.MemberBegin(); member != entityData.MemberEnd(); ++member) {
+                const std::string_view key{ member->name.GetString(), member->name.GetStringLength() };
+                if (key == "children") continue;
+                if (key == "entityGUID") {
+                    CollectGUIDs(member->value, entityGUIDs);
+                    continue;
+                }
+                CollectGUIDs(member->value, parsed->resources);
+            }
+
+            if (entityData.HasMember("children") && entityData["children"].IsArray()) {
+                for (const auto& child : entityData["children"].GetArray()) {
+                    addEntity(child, index);
+                }
+            }
+        };
+
+        for (const auto& entry : parsed->document.GetArray()) {
+            if (!entry.IsObject()) continue;
+            if (entry.HasMember(SceneData::classname())) {
+                parsed->sceneData = &entry;
+                CollectGUIDs(entry, parsed->resources);
+            }
+            else {
+                addEntity(entry, -1);
+            }
+        }
+
+        //references to entities of the scene are not resources
+        std::sort(entityGUIDs.begin(), entityGUIDs.end());
+        std::sort(parsed->resources.begin(), parsed->resources.end());
+        parsed->resources.erase(std::unique(parsed->resources.begin(), parsed->resources.end()), parsed->resources.end());
+        std::erase_if(parsed->resources, [&](const utility::GUID& guid) {
+            return std::binary_search(entityGUIDs.begin(), entityGUIDs.end(), guid);
+            });
+
+        return parsed;
+    }
+
+    void SceneManager::UpdateStreaming()
+    {
+        if (m_streamingLoads.empty()) return;
+        KOS_PROFILE_SCOPE("SceneManager::UpdateStreaming");
+
+        //one budget shared by every streamed scene, oldest request first
+        const auto deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float, std::milli>(m_streamingBudgetMs));
+
+        for (auto& load : m_streamingLoads) {
+            if (load->finished) continue;
+            if (!StepStreamingLoad(*load, deadline)) {
+                load->finished = true;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) break;
+        }
+
+        //a cancelled parse is only dropped once the worker has returned
+        std::erase_if(m_streamingLoads, [](const std::unique_ptr<StreamingLoad>& load) {
+            return load->finished && (!load->parsing.valid() ||
+                load->parsing.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            });
+    }
+
+    bool SceneManager::StepStreamingLoad(StreamingLoad& load, std::chrono::steady_clock::time_point deadline)
+    {
+        if (*load.cancelled) return false;
+
+        if (!load.instantiating) {
+            if (load.parsing.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return true;
+            load.parsed = load.parsing.get();
+            if (!load.parsed) {
+                onSceneLoadCancelled.Invoke(load.scene);
+                return false;
+            }
+
+            //another load of the same scene may have finished while this one was parsed
+            if (m_ecs.sceneMap.find(load.scene) != m_ecs.sceneMap.end()) {
+                LOGGING_WARN("Scene already loaded");
+                onSceneLoadCancelled.Invoke(load.scene);
+                return false;
+            }
+
+            SceneData sceneData;
+            if (load.parsed->sceneData) {
+                LoadComponentreflect(&sceneData, *load.parsed->sceneData);
+            }
+            //activated once every entity exists
+            sceneData.isActive = false;
+            m_ecs.AddScene(load.scene, sceneData);
+            m_ecs.HoldSceneRegistration(load.scene);
+            loadScenePath[load.scene] = load.path;
+            load.created.reserve(load.parsed->entities.size());
+            load.instantiating = true;
+
+            //decoded on the loader threads while the entities are created
+            m_resourceManager.Prefetch(load.parsed->resources);
+            onSceneResourcesDiscovered.Invoke(load.scene, load.parsed->resources);
+            if (*load.cancelled) return false;
+        }
+
+        {
+            ecs::RegistrationBatchScope registrationBatch(m_ecs);
+            const auto& entities = load.parsed->entities;
+            //at least one entity per frame so a scene always finishes
+            bool first = true;
+            while (load.created.size() < entities.size() && (first || std::chrono::steady_clock::now() < deadline)) {
+                first = false;
+                const ParsedScene::Entity& entity = entities[load.created.size()];
+                std::optional<ecs::EntityID> parent;
+                if (entity.parent >= 0) parent = load.created[entity.parent];
+                load.created.push_back(m_serialization.LoadEntityComponents(*entity.data, parent, load.scene));
+            }
+        }
+
+        if (load.created.size() < load.parsed->entities.size()) {
+            onSceneLoadProgress.Invoke(load.scene, GetSceneLoadProgress(load.scene));
+            return true;
+        }
+
+        //every entity exists, the scene joins the systems in one step
+        load.instantiating = false;
+        SceneData& sceneData = m_ecs.sceneMap.at(load.scene);
+        sceneData.isActive = true;
+        m_ecs.ReleaseSceneRegistration(load.scene);
+
+        onSceneLoadProgress.Invoke(load.scene, 1.f);
+        onSceneLoaded.Invoke(sceneData);
+        LOGGING_INFO("Streamed scene {} loaded", load.scene);
+        return false;
+    }
+
+    void SceneManager::CancelStreamingLoad(StreamingLoad& load)
+    {
+        load.cancelled->store(true);
+        load.finished = true;
+        if (load.instantiating) {
+            //the entities are gone with the scene, only the hold is left
+            load.instantiating = false;
+            m_ecs.ReleaseSceneRegistration(load.scene);
+            loadScenePath.erase(load.scene);
+        }
+        onSceneLoadCancelled.Invoke(load.scene);
+    }
+
+    SceneManager::StreamingLoad* SceneManager::FindStreamingLoad(const std::string& scene)
+    {
+        for (auto& load : m_streamingLoads) {
+            if (!load->finished && load->scene == scene) return load.get();
+        }
+        return nullptr;
+    }
+
+    const SceneManager::StreamingLoad* SceneManager::FindStreamingLoad(const std::string& scene) const
+    {
+        for (const auto& load : m_streamingLoads) {
+            if (!load->finished && load->scene == scene) return load.get();
+        }
+        return nullptr;
+    }
   
     //void SceneManager::AssignEntityNewScene(const std::string& scene, m_ecs::EntityID id)
     //{
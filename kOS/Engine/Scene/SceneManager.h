@@ -9,13 +9,23 @@
 		   of scenes within the ECS framework.
 		   - m_CreateNewScene: Creates a new JSON file for a scene.
 		   - m_LoadScene: Loads entities from a JSON file into the ECS system.
-		   - m_ReloadScene: Reloads all active scenes.
+		   - m_ReloadScene: Reloads all active scenes, or restores the
+		     in-memory snapshot taken by CacheCurrentScene when play stops.
 		   - m_ClearAllScene: Clears all non-prefab scenes.
 		   - m_ClearScene: Removes all entities from a specified scene.
 		   - m_SaveScene: Saves the current state of a specified scene to a JSON file.
 		   - m_SaveAllActiveScenes: Saves all active scenes.
 		   - m_SwapScenes: Moves an entity from one scene to another.
 		   - GetSceneByEntityID: Finds the scene that contains a specified entity.
+		   - LoadSceneAsync: Streams a scene in, the file is parsed on a worker
+		     thread and the entities are created over several frames within
+		     a time budget. The scene is activated once every entity exists.
+		     The resources the scene references are prefetched as soon as
+		     the file is parsed.
+		   - InstantiatePrefab: Loads a prefab file once into an inactive
+		     prefab scene and spawns it by copying the cached entities.
+		     Pooled prefabs hand out released instances again instead of
+		     creating new entities.
 
 This file supports camera management by providing functions to calculate
 view and projection matrices for rendering 3D scenes and UI elements.
@@ -33,6 +43,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Resources/ResourceManager.h"
 #include "DeSerialization/json_handler.h"
 #include "Events/Delegate.h"
+#include "ECS/ECSSnapshot.h"
 #include "SceneData.h"
 #include "ECS/ECS.h"
 
@@ -80,23 +91,94 @@ namespace scenes {
 
 		void SetSceneActive(const std::string& scene, bool active);
 
+		//entering play mode, ReloadScene restores the snapshot when play stops
 		void CacheCurrentScene();
-		void DeleteAllCacheScenes();
-		bool LoadCacheSceneImmediate(const std::filesystem::path& scene, std::string originalName);
 
 		void LoadSceneToCurrent(const std::string& currentScene, const std::filesystem::path& filepath);
 
+		//STREAMING
+		void LoadSceneAsync(const std::filesystem::path& scenepath, const std::string forcedSceneName = "");
+		void CancelSceneLoad(const std::string& scene);
+		bool IsSceneLoading(const std::string& scene) const;
+		//0 while the file is parsed, then the share of entities created so far
+		float GetSceneLoadProgress(const std::string& scene) const;
+		//milliseconds spent creating streamed entities per frame, at least one entity is created each frame
+		void SetStreamingBudget(float milliseconds) { m_streamingBudgetMs = milliseconds; }
+		float GetStreamingBudget() const { return m_streamingBudgetMs; }
+
+		//PREFABS
+		//returns the root of the new instance, -1 if the prefab could not be loaded
+		int InstantiatePrefab(const std::filesystem::path& prefabPath, const std::string& scene);
+		//released instances are kept hidden, up to capacity of them, 0 turns pooling off
+		void SetPrefabPoolCapacity(const std::filesystem::path& prefabPath, size_t capacity);
+		//hands the instance back to its prefab's pool, deletes it when the pool is full or off
+		void ReleasePrefabInstance(ecs::EntityID root);
+		size_t GetPooledInstanceCount(const std::filesystem::path& prefabPath) const;
+
 		//void AssignEntityNewScene(const std::string& scene, ecs::EntityID id);
 		//EVENTS
 
 		Delegate<const SceneData&> onSceneLoaded;
+		//streamed scenes only, onSceneLoaded is invoked when they are activated
+		Delegate<const std::string&, float> onSceneLoadProgress;
+		Delegate<const std::string&, const std::vector<utility::GUID>&> onSceneResourcesDiscovered;
+		Delegate<const std::string&> onSceneLoadCancelled;
 
 
 
 
 	private:
 
-
+		//built on the worker thread, the entity data points into the document
+		struct ParsedScene {
+			struct Entity {
+				const rapidjson::Value* data{};
+				int32_t parent{ -1 }; // index into entities, parents come before their children
+			};
+
+			rapidjson::Document document;
+			const rapidjson::Value* sceneData{};
+			std::vector<Entity> entities;
+			std::vector<utility::GUID> resources;
+		};
+
+		struct StreamingLoad {
+			std::string scene;
+			std::filesystem::path path;
+			std::shared_ptr<std::atomic<bool>> cancelled;
+			std::future<std::unique_ptr<ParsedScene>> parsing;
+			std::unique_ptr<ParsedScene> parsed;
+			std::vector<ecs::EntityID> created;
+			bool instantiating{ false };
+			bool finished{ false };
+		};
+
+		static std::unique_ptr<ParsedScene> ParseSceneFile(const std::filesystem::path& path, const std::atomic<bool>& cancelled);
+		void UpdateStreaming();
+		//returns false once the load is finished or dropped
+		bool StepStreamingLoad(StreamingLoad& load, std::chrono::steady_clock::time_point deadline);
+		void CancelStreamingLoad(StreamingLoad& load);
+		StreamingLoad* FindStreamingLoad(const std::string& scene);
+		const StreamingLoad* FindStreamingLoad(const std::string& scene) const;
+
+		//entities of an inactive prefab scene, copied for every instance
+		struct PrefabTemplate {
+			std::string scene;
+			ecs::EntityID root{};
+			size_t poolCapacity{};
+			std::vector<ecs::EntityHandle> pool;
+		};
+
+		PrefabTemplate* GetPrefabTemplate(const std::filesystem::path& prefabPath);
+		bool MatchesPrefabHierarchy(ecs::EntityID source, ecs::EntityID instance);
+		void ResetPrefabInstance(ecs::EntityID source, ecs::EntityID instance, const std::string& scene);
+		void SetInstanceHidden(ecs::EntityID instance);
+
+		//by prefab scene name
+		std::unordered_map<std::string, PrefabTemplate> m_prefabTemplates;
+
+		std::vector<std::unique_ptr<StreamingLoad>> m_streamingLoads;
+		float m_streamingBudgetMs{ 2.f };
 
 		std::vector<std::filesystem::path> m_loadQueue;
 		std::vector<std::string> m_clearQueue;
@@ -104,7 +186,8 @@ namespace scenes {
 
 		std::unordered_map<std::string, std::filesystem::path> unloadScenePath;
 		std::unordered_map<std::string, std::filesystem::path> loadScenePath;
-		std::vector<std::filesystem::path> cacheScenePath;
+		ecs::ECSSnapshot m_playSnapshot;
+		std::unordered_map<std::string, std::filesystem::path> m_playScenePath;
 
 
 
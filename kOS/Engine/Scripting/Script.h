@@ -43,6 +43,10 @@ public:
 	virtual void Update();
 	virtual void LateUpdate();
 	virtual void FixedUpdate();
+	//job scripts run Update in parallel chunks on the job system, see TemplateJobSC
+	virtual bool IsJob() const { return false; }
+	//called on one instance on the main thread before the parallel Update of its script
+	virtual void PrepareJob() {}
 	bool isStart = false;
 	static std::map<std::string, GenerateScriptClass> ScriptClassGenerator;
 };
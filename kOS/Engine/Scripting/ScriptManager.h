@@ -80,6 +80,10 @@ public:
 
 	
 	const std::vector<std::string>& GetScriptList() const { return scriptList; }
+
+	//script compiled into the executable instead of the DLL, eg. by tests
+	//its component has to be registered with the ECS first
+	void RegisterScript(const std::string& scriptName) { scriptList.push_back(scriptName); }
 	//List of script pointers
 private:
 	
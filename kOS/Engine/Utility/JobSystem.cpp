@@ -0,0 +1,151 @@
+/******************************************************************/
+/*!
+\file      JobSystem.cpp
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Implementation of the work stealing thread pool.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "JobSystem.h"
+#include "Debugging/Profiler.h"
+
+namespace utility {
+
+	namespace {
+		thread_local int t_workerIndex = -1;
+	}
+
+	unsigned int JobSystem::DefaultWorkerCount() {
+		//leave one hardware thread for the main thread
+		const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+	}
+
+	int JobSystem::GetCurrentWorkerIndex() {
+		return t_workerIndex;
+	}
+
+	JobSystem::JobSystem(unsigned int workerCount) {
+		m_queues.reserve(workerCount);
+		for (unsigned int i = 0; i < workerCount; ++i) {
+			m_queues.emplace_back(std::make_unique<WorkerQueue>());
+		}
+
+		m_workers.reserve(workerCount);
+		for (unsigned int i = 0; i < workerCount; ++i) {
+			m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem() {
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_running = false;
+		}
+		m_sleepCV.notify_all();
+
+		for (auto& worker : m_workers) {
+			if (worker.joinable()) worker.join();
+		}
+	}
+
+	void JobSystem::Submit(Job job) {
+		if (m_workers.empty()) {
+			job();
+			return;
+		}
+
+		//workers push to their own queue, other threads round robin
+		const int worker = t_workerIndex;
+		const unsigned int index = worker >= 0
+			? static_cast<unsigned int>(worker)
+			: m_nextQueue.fetch_add(1, std::memory_order_relaxed) % static_cast<unsigned int>(m_queues.size());
+
+		{
+			std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+			m_queues[index]->jobs.push_back(std::move(job));
+		}
+
+		{
+			//increment under the sleep mutex so a worker about to sleep cannot miss the job
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_queuedJobs.fetch_add(1, std::memory_order_release);
+		}
+		m_sleepCV.notify_one();
+	}
+
+	bool JobSystem::PopOrSteal(unsigned int index, Job& job) {
+		const unsigned int queueCount = static_cast<unsigned int>(m_queues.size());
+		if (queueCount == 0) return false;
+
+		//own queue is LIFO for cache locality
+		{
+			WorkerQueue& own = *m_queues[index % queueCount];
+			std::lock_guard<std::mutex> lock(own.mutex);
+			if (!own.jobs.empty()) {
+				job = std::move(own.jobs.back());
+				own.jobs.pop_back();
+				m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+				return true;
+			}
+		}
+
+		//steal the oldest job of another worker
+		for (unsigned int offset = 1; offset < queueCount; ++offset) {
+			WorkerQueue& victim = *m_queues[(index + offset) % queueCount];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if (!victim.jobs.empty()) {
+				job = std::move(victim.jobs.front());
+				victim.jobs.pop_front();
+				m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool JobSystem::RunPendingJob() {
+		const int worker = t_workerIndex;
+		const unsigned int index = worker >= 0 ? static_cast<unsigned int>(worker) : 0;
+
+		Job job;
+		if (!PopOrSteal(index, job)) return false;
+
+		job();
+		return true;
+	}
+
+	void JobSystem::Wait(const std::atomic<size_t>& counter) {
+		while (counter.load(std::memory_order_acquire) > 0) {
+			if (!RunPendingJob()) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSystem::WorkerLoop(unsigned int index) {
+		t_workerIndex = static_cast<int>(index);
+		profiling::Profiler::SetThreadName("Worker " + std::to_string(index));
+
+		while (m_running.load(std::memory_order_acquire)) {
+			Job job;
+			if (PopOrSteal(index, job)) {
+				job();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_sleepCV.wait(lock, [this]() {
+				return !m_running.load(std::memory_order_acquire) || m_queuedJobs.load(std::memory_order_acquire) > 0;
+			});
+		}
+	}
+
+}
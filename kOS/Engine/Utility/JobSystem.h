@@ -0,0 +1,108 @@
+/******************************************************************/
+/*!
+\file      JobSystem.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Work stealing thread pool used by the ECS scheduler.
+		   Each worker owns a job deque, it pops jobs from the back of
+		   its own deque and steals from the front of the other
+		   workers' deques when it runs dry. Idle workers sleep on a
+		   condition variable until a job is submitted.
+
+		   With 0 workers every job runs inline on the submitting
+		   thread.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include "Config/pch.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+namespace utility {
+
+	class JobSystem {
+	public:
+		using Job = std::function<void()>;
+
+		explicit JobSystem(unsigned int workerCount = DefaultWorkerCount());
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		//queue job on a worker, runs inline if there are no workers
+		void Submit(Job job);
+
+		//lets the calling thread help by running one queued job, returns false if nothing was queued
+		bool RunPendingJob();
+
+		//blocks until counter reaches 0, the calling thread runs queued jobs while waiting
+		void Wait(const std::atomic<size_t>& counter);
+
+		// Calls func(begin, end) over [0, count) split into chunks of grainSize
+		template <typename Func>
+		void ParallelFor(size_t count, size_t grainSize, Func&& func);
+
+		unsigned int GetWorkerCount() const { return static_cast<unsigned int>(m_workers.size()); }
+
+		//index of the worker running the calling thread, -1 for non worker threads (eg. main thread)
+		static int GetCurrentWorkerIndex();
+
+		static unsigned int DefaultWorkerCount();
+
+	private:
+		struct WorkerQueue {
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		void WorkerLoop(unsigned int index);
+		bool PopOrSteal(unsigned int index, Job& job);
+
+		std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+		std::vector<std::thread> m_workers;
+
+		std::mutex m_sleepMutex;
+		std::condition_variable m_sleepCV;
+		std::atomic<size_t> m_queuedJobs{ 0 };
+		std::atomic<unsigned int> m_nextQueue{ 0 };
+		std::atomic<bool> m_running{ true };
+	};
+
+	template <typename Func>
+	void JobSystem::ParallelFor(size_t count, size_t grainSize, Func&& func) {
+		if (count == 0) return;
+
+		grainSize = std::max<size_t>(grainSize, 1);
+		const size_t chunks = (count + grainSize - 1) / grainSize;
+		if (m_workers.empty() || chunks == 1) {
+			func(size_t{ 0 }, count);
+			return;
+		}
+
+		std::atomic<size_t> remaining{ chunks - 1 };
+		for (size_t chunk = 1; chunk < chunks; ++chunk) {
+			const size_t begin = chunk * grainSize;
+			const size_t end = std::min(begin + grainSize, count);
+			Submit([&func, &remaining, begin, end]() {
+				func(begin, end);
+				remaining.fetch_sub(1, std::memory_order_release);
+			});
+		}
+
+		//calling thread takes the first chunk
+		func(size_t{ 0 }, std::min(grainSize, count));
+		Wait(remaining);
+	}
+
+}
+
+#endif JOBSYSTEM_H
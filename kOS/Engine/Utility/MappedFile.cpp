@@ -0,0 +1,105 @@
+/******************************************************************/
+/*!
+\file      MappedFile.cpp
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Read only memory mapping of a whole file.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace utility {
+
+#ifdef _WIN32
+	bool MappedFile::Open(const std::filesystem::path& path) {
+		Close();
+
+		HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping) {
+			CloseHandle(file);
+			return false;
+		}
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!view) {
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_file = file;
+		m_mapping = mapping;
+		m_data = static_cast<const unsigned char*>(view);
+		m_size = static_cast<size_t>(size.QuadPart);
+		return true;
+	}
+
+	void MappedFile::Close() {
+		if (m_data) UnmapViewOfFile(m_data);
+		if (m_mapping) CloseHandle(m_mapping);
+		if (m_file) CloseHandle(m_file);
+		m_data = nullptr;
+		m_mapping = nullptr;
+		m_file = nullptr;
+		m_size = 0;
+	}
+#else
+	bool MappedFile::Open(const std::filesystem::path& path) {
+		Close();
+
+		const int file = open(path.c_str(), O_RDONLY);
+		if (file < 0) return false;
+
+		struct stat status {};
+		if (fstat(file, &status) != 0 || status.st_size == 0) {
+			close(file);
+			return false;
+		}
+
+		void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		//the mapping keeps the file alive
+		close(file);
+		if (view == MAP_FAILED) return false;
+
+		//records are read front to back
+		madvise(view, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+		m_data = static_cast<const unsigned char*>(view);
+		m_size = static_cast<size_t>(status.st_size);
+		return true;
+	}
+
+	void MappedFile::Close() {
+		if (m_data) munmap(const_cast<unsigned char*>(m_data), m_size);
+		m_data = nullptr;
+		m_size = 0;
+	}
+#endif
+}
@@ -0,0 +1,50 @@
+/******************************************************************/
+/*!
+\file      MappedFile.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Read only memory mapping of a whole file. The pages are
+		   loaded by the OS as they are touched, nothing is copied
+		   into a buffer up front.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include "Config/pch.h"
+
+namespace utility {
+
+	class MappedFile {
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::filesystem::path& path) { Open(path); }
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		//false if the file is missing, empty or cannot be mapped
+		bool Open(const std::filesystem::path& path);
+		void Close();
+
+		bool IsOpen() const { return m_data != nullptr; }
+		const unsigned char* Data() const { return m_data; }
+		size_t Size() const { return m_size; }
+
+	private:
+		const unsigned char* m_data{};
+		size_t m_size{};
+#ifdef _WIN32
+		void* m_file{};
+		void* m_mapping{};
+#endif
+	};
+}
+
+#endif
@@ -0,0 +1,158 @@
+/******************************************************************/
+/*!
+\file      SimdMath.cpp
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     SSE kernels for the transform pipeline.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#include "Config/pch.h"
+#include "SimdMath.h"
+
+namespace utility {
+
+	namespace {
+		//same constant as glm::radians
+		constexpr float DEG_TO_RAD = static_cast<float>(0.01745329251994329576923690768489);
+
+		void ComposeTRSScalar(const TRSArrays& trs, uint32_t index, glm::mat4& out) {
+			const float hx = trs.rotationX[index] * DEG_TO_RAD * 0.5f;
+			const float hy = trs.rotationY[index] * DEG_TO_RAD * 0.5f;
+			const float hz = trs.rotationZ[index] * DEG_TO_RAD * 0.5f;
+			const float cx = std::cos(hx), cy = std::cos(hy), cz = std::cos(hz);
+			const float sx = std::sin(hx), sy = std::sin(hy), sz = std::sin(hz);
+
+			const float w = cx * cy * cz + sx * sy * sz;
+			const float x = sx * cy * cz - cx * sy * sz;
+			const float y = cx * sy * cz + sx * cy * sz;
+			const float z = cx * cy * sz - sx * sy * cz;
+
+			const float qxx = x * x, qyy = y * y, qzz = z * z;
+			const float qxz = x * z, qxy = x * y, qyz = y * z;
+			const float qwx = w * x, qwy = w * y, qwz = w * z;
+
+			const float scaleX = trs.scaleX[index], scaleY = trs.scaleY[index], scaleZ = trs.scaleZ[index];
+			out[0] = glm::vec4(1.f - 2.f * (qyy + qzz), 2.f * (qxy + qwz), 2.f * (qxz - qwy), 0.f) * scaleX;
+			out[1] = glm::vec4(2.f * (qxy - qwz), 1.f - 2.f * (qxx + qzz), 2.f * (qyz + qwx), 0.f) * scaleY;
+			out[2] = glm::vec4(2.f * (qxz + qwy), 2.f * (qyz - qwx), 1.f - 2.f * (qxx + qyy), 0.f) * scaleZ;
+			out[3] = glm::vec4(trs.positionX[index], trs.positionY[index], trs.positionZ[index], 1.f);
+		}
+	}
+
+#ifdef KOS_SIMD_SSE
+
+	void MultiplyMat4(const glm::mat4& lhs, const glm::mat4& rhs, glm::mat4& out) {
+		const __m128 lhs0 = _mm_loadu_ps(&lhs[0][0]);
+		const __m128 lhs1 = _mm_loadu_ps(&lhs[1][0]);
+		const __m128 lhs2 = _mm_loadu_ps(&lhs[2][0]);
+		const __m128 lhs3 = _mm_loadu_ps(&lhs[3][0]);
+
+		for (int column = 0; column < 4; ++column) {
+			const glm::vec4& rhsColumn = rhs[column];
+			__m128 result = _mm_mul_ps(lhs0, _mm_set1_ps(rhsColumn[0]));
+			result = _mm_add_ps(result, _mm_mul_ps(lhs1, _mm_set1_ps(rhsColumn[1])));
+			result = _mm_add_ps(result, _mm_mul_ps(lhs2, _mm_set1_ps(rhsColumn[2])));
+			result = _mm_add_ps(result, _mm_mul_ps(lhs3, _mm_set1_ps(rhsColumn[3])));
+			_mm_storeu_ps(&out[column][0], result);
+		}
+	}
+
+	void ComposeTRS(const TRSArrays& trs, const uint32_t* indices, size_t count, glm::mat4* out) {
+		const __m128 one = _mm_set1_ps(1.f);
+		const __m128 two = _mm_set1_ps(2.f);
+		const __m128 zero = _mm_setzero_ps();
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			const uint32_t* lane = indices + i;
+
+			//trig has no SSE instruction, everything after the sin/cos is 4 wide
+			alignas(16) float cx[4], cy[4], cz[4], sx[4], sy[4], sz[4];
+			for (int l = 0; l < 4; ++l) {
+				const float hx = trs.rotationX[lane[l]] * DEG_TO_RAD * 0.5f;
+				const float hy = trs.rotationY[lane[l]] * DEG_TO_RAD * 0.5f;
+				const float hz = trs.rotationZ[lane[l]] * DEG_TO_RAD * 0.5f;
+				cx[l] = std::cos(hx); cy[l] = std::cos(hy); cz[l] = std::cos(hz);
+				sx[l] = std::sin(hx); sy[l] = std::sin(hy); sz[l] = std::sin(hz);
+			}
+			const __m128 vcx = _mm_load_ps(cx), vcy = _mm_load_ps(cy), vcz = _mm_load_ps(cz);
+			const __m128 vsx = _mm_load_ps(sx), vsy = _mm_load_ps(sy), vsz = _mm_load_ps(sz);
+
+			const __m128 w = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(vcx, vcy), vcz), _mm_mul_ps(_mm_mul_ps(vsx, vsy), vsz));
+			const __m128 x = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(vsx, vcy), vcz), _mm_mul_ps(_mm_mul_ps(vcx, vsy), vsz));
+			const __m128 y = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(vcx, vsy), vcz), _mm_mul_ps(_mm_mul_ps(vsx, vcy), vsz));
+			const __m128 z = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(vcx, vcy), vsz), _mm_mul_ps(_mm_mul_ps(vsx, vsy), vcz));
+
+			const __m128 qxx = _mm_mul_ps(x, x), qyy = _mm_mul_ps(y, y), qzz = _mm_mul_ps(z, z);
+			const __m128 qxz = _mm_mul_ps(x, z), qxy = _mm_mul_ps(x, y), qyz = _mm_mul_ps(y, z);
+			const __m128 qwx = _mm_mul_ps(w, x), qwy = _mm_mul_ps(w, y), qwz = _mm_mul_ps(w, z);
+
+			const __m128 scaleX = _mm_set_ps(trs.scaleX[lane[3]], trs.scaleX[lane[2]], trs.scaleX[lane[1]], trs.scaleX[lane[0]]);
+			const __m128 scaleY = _mm_set_ps(trs.scaleY[lane[3]], trs.scaleY[lane[2]], trs.scaleY[lane[1]], trs.scaleY[lane[0]]);
+			const __m128 scaleZ = _mm_set_ps(trs.scaleZ[lane[3]], trs.scaleZ[lane[2]], trs.scaleZ[lane[1]], trs.scaleZ[lane[0]]);
+
+			//rows hold one matrix element for 4 transforms, transposed into 4 columns before storing
+			__m128 m00 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(qyy, qzz))), scaleX);
+			__m128 m01 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(qxy, qwz)), scaleX);
+			__m128 m02 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(qxz, qwy)), scaleX);
+			__m128 m03 = zero;
+
+			__m128 m10 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(qxy, qwz)), scaleY);
+			__m128 m11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(qxx, qzz))), scaleY);
+			__m128 m12 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(qyz, qwx)), scaleY);
+			__m128 m13 = zero;
+
+			__m128 m20 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(qxz, qwy)), scaleZ);
+			__m128 m21 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(qyz, qwx)), scaleZ);
+			__m128 m22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(qxx, qyy))), scaleZ);
+			__m128 m23 = zero;
+
+			__m128 m30 = _mm_set_ps(trs.positionX[lane[3]], trs.positionX[lane[2]], trs.positionX[lane[1]], trs.positionX[lane[0]]);
+			__m128 m31 = _mm_set_ps(trs.positionY[lane[3]], trs.positionY[lane[2]], trs.positionY[lane[1]], trs.positionY[lane[0]]);
+			__m128 m32 = _mm_set_ps(trs.positionZ[lane[3]], trs.positionZ[lane[2]], trs.positionZ[lane[1]], trs.positionZ[lane[0]]);
+			__m128 m33 = one;
+
+			_MM_TRANSPOSE4_PS(m00, m01, m02, m03);
+			_MM_TRANSPOSE4_PS(m10, m11, m12, m13);
+			_MM_TRANSPOSE4_PS(m20, m21, m22, m23);
+			_MM_TRANSPOSE4_PS(m30, m31, m32, m33);
+
+			const __m128 columns[4][4] = {
+				{ m00, m10, m20, m30 },
+				{ m01, m11, m21, m31 },
+				{ m02, m12, m22, m32 },
+				{ m03, m13, m23, m33 },
+			};
+			for (int l = 0; l < 4; ++l) {
+				glm::mat4& matrix = out[lane[l]];
+				for (int column = 0; column < 4; ++column) {
+					_mm_storeu_ps(&matrix[column][0], columns[l][column]);
+				}
+			}
+		}
+
+		for (; i < count; ++i) {
+			ComposeTRSScalar(trs, indices[i], out[indices[i]]);
+		}
+	}
+
+#else
+
+	void MultiplyMat4(const glm::mat4& lhs, const glm::mat4& rhs, glm::mat4& out) {
+		out = lhs * rhs;
+	}
+
+	void ComposeTRS(const TRSArrays& trs, const uint32_t* indices, size_t count, glm::mat4* out) {
+		for (size_t i = 0; i < count; ++i) {
+			ComposeTRSScalar(trs, indices[i], out[indices[i]]);
+		}
+	}
+
+#endif
+
+}
@@ -0,0 +1,90 @@
+/******************************************************************/
+/*!
+\file      SimdMath.h
+\author    Jaz Winn Ng
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     SSE kernels for the transform pipeline.
+		   - MultiplyMat4: column major 4x4 multiply, same operation
+			 order as glm so results match glm's operator*.
+		   - ComposeTRS: translate * rotate(euler degrees) * scale for
+			 a batch of transforms stored as structure of arrays, four
+			 transforms per SSE register. Uses the same quaternion
+			 formula as glm::quat(euler) + glm::mat4_cast.
+
+		   Falls back to scalar code when SSE2 is not available.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************/
+#ifndef SIMDMATH_H
+#define SIMDMATH_H
+
+#include "Config/pch.h"
+#include <new>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define KOS_SIMD_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace utility {
+
+	/******************************************************************/
+	/*!
+	\class     AlignedAllocator
+	\brief     Allocator for SoA arrays so SIMD loads start on an
+			   aligned boundary.
+	*/
+	/******************************************************************/
+	template <typename T, size_t Alignment = 32>
+	struct AlignedAllocator {
+		using value_type = T;
+
+		template <typename U>
+		struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+		AlignedAllocator() = default;
+		template <typename U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+		T* allocate(size_t count) {
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ Alignment }));
+		}
+
+		void deallocate(T* ptr, size_t) {
+			::operator delete(ptr, std::align_val_t{ Alignment });
+		}
+
+		template <typename U>
+		bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+		template <typename U>
+		bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+	};
+
+	template <typename T>
+	using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+	// Local TRS of many transforms, one array per component
+	struct TRSArrays {
+		const float* positionX;
+		const float* positionY;
+		const float* positionZ;
+		const float* rotationX;		// euler degrees
+		const float* rotationY;
+		const float* rotationZ;
+		const float* scaleX;
+		const float* scaleY;
+		const float* scaleZ;
+	};
+
+	// out = lhs * rhs
+	void MultiplyMat4(const glm::mat4& lhs, const glm::mat4& rhs, glm::mat4& out);
+
+	// out[indices[i]] = T * R * S of transform indices[i]
+	void ComposeTRS(const TRSArrays& trs, const uint32_t* indices, size_t count, glm::mat4* out);
+}
+
+#endif SIMDMATH_H
@@ -0,0 +1,349 @@
+/******************************************************************/
+/*!
+\file      HeadlessRunner.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Runs the engine loop without a window for benchmarking
+		   and writes the JSON report of the run.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "Config/pch.h"
+#include "HeadlessRunner.h"
+#include "MemoryStats.h"
+#include "Graphics/NullGL.h"
+#include "Debugging/Profiler.h"
+#include <RAPIDJSON/prettywriter.h>
+#include <RAPIDJSON/stringbuffer.h>
+
+namespace headless {
+
+	float HeadlessRunner::Samples::Mean() const {
+		if (values.empty()) return 0.f;
+		return std::accumulate(values.begin(), values.end(), 0.f) / static_cast<float>(values.size());
+	}
+
+	float HeadlessRunner::Samples::Percentile(float percent) const {
+		if (values.empty()) return 0.f;
+		std::vector<float> sorted = values;
+		const size_t index = std::min(sorted.size() - 1, static_cast<size_t>(static_cast<float>(sorted.size()) * percent / 100.f));
+		std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(index), sorted.end());
+		return sorted[index];
+	}
+
+	float HeadlessRunner::Samples::Max() const {
+		if (values.empty()) return 0.f;
+		return *std::max_element(values.begin(), values.end());
+	}
+
+	int HeadlessRunner::Init(const RunSettings& settings) {
+		m_settings = settings;
+
+		/*--------------------------------------------------------------
+		   INITIALIZE NULL GRAPHICS BACKEND
+		--------------------------------------------------------------*/
+		//resources still upload through GL when they load, there is no context to take the calls
+		nullgl::Install();
+
+		/*--------------------------------------------------------------
+		   INITIALIZE ECS
+		--------------------------------------------------------------*/
+		m_ecs.Load();
+		m_ecs.Init();
+		m_ecs.SetState(m_settings.play ? ecs::START : ecs::STOP);
+		LOGGING_INFO("Load ECS Successful");
+
+		/*--------------------------------------------------------------
+		   INITIALIZE Resource Manager
+		--------------------------------------------------------------*/
+		m_resourceManager.Init(m_settings.resourceDirectory.string());
+
+		/*--------------------------------------------------------------
+		INITIALIZE SCRIPT
+		--------------------------------------------------------------*/
+		if (!m_settings.scriptDirectory.empty()) {
+			m_scriptManager.Init(m_settings.scriptDirectory.string());
+		}
+
+		/*--------------------------------------------------------------
+		   INITIALIZE Scene
+		--------------------------------------------------------------*/
+		if (!m_settings.scenePath.empty()) {
+			//ImmediateLoadScene creates missing scene files, a typo should not produce an empty benchmark
+			if (!std::filesystem::exists(m_settings.scenePath)) {
+				LOGGING_ERROR("Headless: scene {} does not exist", m_settings.scenePath.string());
+				return 1;
+			}
+			m_sceneName = m_settings.scenePath.filename().string();
+			if (!m_sceneManager.ImmediateLoadScene(m_settings.scenePath)) {
+				LOGGING_ERROR("Headless: failed to load {}", m_settings.scenePath.string());
+				return 1;
+			}
+			for (const ecs::EntityID id : m_ecs.GetSceneData(m_sceneName).sceneIDs) {
+				if (!m_ecs.GetParent(id).has_value()) m_movingEntities.push_back(id);
+			}
+		}
+		else {
+			m_sceneName = "Synthetic.scene";
+			m_ecs.AddScene(m_sceneName, SceneData{});
+			m_movingEntities = GenerateSyntheticScene(m_ecs, m_sceneName, m_settings.synthetic).roots;
+		}
+
+		const size_t movingCount = static_cast<size_t>(static_cast<float>(m_movingEntities.size()) * std::clamp(m_settings.movingFraction, 0.f, 1.f));
+		m_movingEntities.resize(movingCount);
+
+		profiling::Profiler::GetInstance().SetHistoryLength(std::max<size_t>(m_settings.frames, 1));
+		LOGGING_INFO("Headless Init Successful, {} entities", m_ecs.GetEntitySignatureData().size());
+		return 0;
+	}
+
+	void HeadlessRunner::MoveEntities(size_t frame) {
+		const float angle = static_cast<float>(frame);
+		for (const ecs::EntityID id : m_movingEntities) {
+			if (ecs::TransformComponent* transform = m_ecs.GetComponent<ecs::TransformComponent>(id)) {
+				transform->LocalTransformation.rotation.y = angle;
+			}
+		}
+	}
+
+	void HeadlessRunner::StepFrame(bool measured) {
+		const AllocationStats allocationsBefore = GetAllocationStats();
+		const uint64_t glCallsBefore = nullgl::GetTotalCallCount();
+		const auto start = std::chrono::steady_clock::now();
+
+		m_peformance.SetDeltaTime(m_settings.deltaTime);
+
+		/*--------------------------------------------------------------
+			UPLOAD RESOURCES LOADED IN THE BACKGROUND
+		--------------------------------------------------------------*/
+		m_resourceManager.ProcessUploads();
+
+		/*--------------------------------------------------------------
+			UPDATE ECS
+		--------------------------------------------------------------*/
+		m_ecs.Update(m_settings.deltaTime);
+
+		/*--------------------------------------------------------------
+			Null Render Pipeline
+		--------------------------------------------------------------*/
+		const SubmissionCounts submissions = m_graphicsManager.gm_GetSubmissionCounts();
+		m_graphicsManager.gm_ClearSubmissions();
+
+		/*--------------------------------------------------------------
+			SceneManager, ecs, ResourceManager and Profiler EndFrame
+		--------------------------------------------------------------*/
+		m_sceneManager.EndFrame();
+		m_ecs.EndFrame();
+		m_resourceManager.EndFrame();
+		KOS_PROFILE_END_FRAME();
+
+		const auto end = std::chrono::steady_clock::now();
+		if (!measured) return;
+
+		const AllocationStats allocationsAfter = GetAllocationStats();
+		m_allocations += allocationsAfter.count - allocationsBefore.count;
+		m_allocatedBytes += allocationsAfter.bytes - allocationsBefore.bytes;
+		m_glCalls += nullgl::GetTotalCallCount() - glCallsBefore;
+
+		m_frameTimes.Add(std::chrono::duration<float, std::milli>(end - start).count());
+		m_criticalPath.Add(m_peformance.GetCriticalPath() * 1000.f);
+		for (const auto& [systemName, seconds] : m_peformance.GetSystemPerformance()) {
+			m_systemTimes[systemName].Add(seconds * 1000.f);
+		}
+		for (const auto& [systemName, worker] : m_peformance.GetSystemWorker()) {
+			m_systemWorkers[systemName] = worker;
+		}
+
+		m_submissions.meshes += submissions.meshes;
+		m_submissions.skinnedMeshes += submissions.skinnedMeshes;
+		m_submissions.cubes += submissions.cubes;
+		m_submissions.spheres += submissions.spheres;
+		m_submissions.lights += submissions.lights;
+		m_submissions.screenText += submissions.screenText;
+		m_submissions.screenSprites += submissions.screenSprites;
+		m_submissions.debugShapes += submissions.debugShapes;
+		m_submissions.particles += submissions.particles;
+		m_submissions.gameCameras += submissions.gameCameras;
+	}
+
+	int HeadlessRunner::Run() {
+		size_t frame{};
+		for (size_t i = 0; i < m_settings.warmupFrames; ++i, ++frame) {
+			MoveEntities(frame);
+			StepFrame(false);
+		}
+
+		if (!m_settings.tracePath.empty()) {
+			profiling::Profiler::GetInstance().BeginCapture(m_settings.frames);
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < m_settings.frames; ++i, ++frame) {
+			MoveEntities(frame);
+			StepFrame(true);
+		}
+		m_wallTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		if (!m_settings.tracePath.empty()) {
+			profiling::Profiler::GetInstance().WriteChromeTrace(m_settings.tracePath);
+		}
+
+		LOGGING_INFO("Headless: {} frames in {} ms", m_settings.frames, m_wallTimeMs);
+		return 0;
+	}
+
+	bool HeadlessRunner::WriteReport() {
+		rapidjson::StringBuffer buffer;
+		rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+
+		const auto writeSamples = [&writer](const char* key, const Samples& samples) {
+			writer.Key(key);
+			writer.StartObject();
+			writer.Key("mean"); writer.Double(samples.Mean());
+			writer.Key("p50"); writer.Double(samples.Percentile(50.f));
+			writer.Key("p95"); writer.Double(samples.Percentile(95.f));
+			writer.Key("max"); writer.Double(samples.Max());
+			writer.EndObject();
+		};
+		const auto perFrame = [this](uint64_t total) {
+			return m_settings.frames ? static_cast<double>(total) / static_cast<double>(m_settings.frames) : 0.0;
+		};
+
+		writer.StartObject();
+
+		//run setup
+		writer.Key("scene"); writer.String(m_sceneName.c_str());
+		writer.Key("synthetic");
+		if (m_settings.scenePath.empty()) {
+			const SyntheticSceneSettings& synthetic = m_settings.synthetic;
+			writer.StartObject();
+			writer.Key("entities"); writer.Uint64(synthetic.entities);
+			writer.Key("depth"); writer.Uint64(synthetic.depth);
+			writer.Key("plainWeight"); writer.Double(synthetic.plainWeight);
+			writer.Key("lightWeight"); writer.Double(synthetic.lightWeight);
+			writer.Key("boxWeight"); writer.Double(synthetic.boxWeight);
+			writer.Key("seed"); writer.Uint(synthetic.seed);
+			writer.EndObject();
+		}
+		else {
+			writer.Null();
+		}
+		writer.Key("state"); writer.String(m_settings.play ? "play" : "edit");
+		writer.Key("frames"); writer.Uint64(m_settings.frames);
+		writer.Key("warmupFrames"); writer.Uint64(m_settings.warmupFrames);
+		writer.Key("deltaTime"); writer.Double(m_settings.deltaTime);
+		writer.Key("movingEntities"); writer.Uint64(m_movingEntities.size());
+		writer.Key("workerThreads"); writer.Uint(m_ecs.GetJobSystem().GetWorkerCount());
+
+		//timings, milliseconds
+		writer.Key("wallTimeMs"); writer.Double(m_wallTimeMs);
+		writeSamples("frameMs", m_frameTimes);
+		writeSamples("criticalPathMs", m_criticalPath);
+
+		writer.Key("systems");
+		writer.StartArray();
+		for (const auto& [systemName, samples] : m_systemTimes) {
+			writer.StartObject();
+			writer.Key("name"); writer.String(systemName.c_str());
+			writer.Key("meanMs"); writer.Double(samples.Mean());
+			writer.Key("p95Ms"); writer.Double(samples.Percentile(95.f));
+			writer.Key("maxMs"); writer.Double(samples.Max());
+			const auto worker = m_systemWorkers.find(systemName);
+			writer.Key("lastWorker"); writer.Int(worker != m_systemWorkers.end() ? worker->second : -1);
+			writer.EndObject();
+		}
+		writer.EndArray();
+
+		writer.Key("zones");
+		writer.StartArray();
+		for (const profiling::ZoneStats& zone : profiling::Profiler::GetInstance().GetZoneStats()) {
+			writer.StartObject();
+			writer.Key("name"); writer.String(zone.name.c_str());
+			writer.Key("meanMs"); writer.Double(zone.mean);
+			writer.Key("p95Ms"); writer.Double(zone.p95);
+			writer.Key("maxMs"); writer.Double(zone.max);
+			writer.Key("calls"); writer.Uint(zone.calls);
+			writer.EndObject();
+		}
+		writer.EndArray();
+
+		//entities
+		writer.Key("entities");
+		writer.StartObject();
+		writer.Key("total"); writer.Uint64(m_ecs.GetEntitySignatureData().size());
+		writer.Key("scenes");
+		writer.StartObject();
+		for (const auto& [sceneName, sceneData] : m_ecs.sceneMap) {
+			writer.Key(sceneName.c_str()); writer.Uint64(sceneData.sceneIDs.size());
+		}
+		writer.EndObject();
+		writer.Key("components");
+		writer.StartObject();
+		for (const auto& [componentName, key] : m_ecs.GetComponentKeyData()) {
+			if (!m_ecs.GetComponentPool(componentName)) continue;
+			writer.Key(componentName.c_str()); writer.Uint64(m_ecs.GetComponentsEnties(componentName).size());
+		}
+		writer.EndObject();
+		writer.EndObject();
+
+		//null graphics backend
+		writer.Key("submissionsPerFrame");
+		writer.StartObject();
+		writer.Key("total"); writer.Double(perFrame(m_submissions.Total()));
+		writer.Key("meshes"); writer.Double(perFrame(m_submissions.meshes));
+		writer.Key("skinnedMeshes"); writer.Double(perFrame(m_submissions.skinnedMeshes));
+		writer.Key("cubes"); writer.Double(perFrame(m_submissions.cubes));
+		writer.Key("spheres"); writer.Double(perFrame(m_submissions.spheres));
+		writer.Key("lights"); writer.Double(perFrame(m_submissions.lights));
+		writer.Key("screenText"); writer.Double(perFrame(m_submissions.screenText));
+		writer.Key("screenSprites"); writer.Double(perFrame(m_submissions.screenSprites));
+		writer.Key("debugShapes"); writer.Double(perFrame(m_submissions.debugShapes));
+		writer.Key("particles"); writer.Double(perFrame(m_submissions.particles));
+		writer.Key("gameCameras"); writer.Double(perFrame(m_submissions.gameCameras));
+		writer.EndObject();
+
+		writer.Key("gl");
+		writer.StartObject();
+		writer.Key("callsPerFrame"); writer.Double(perFrame(m_glCalls));
+		writer.Key("functions");
+		writer.StartObject();
+		for (const auto& [function, calls] : nullgl::GetCallCounts()) {
+			writer.Key(function.data(), static_cast<rapidjson::SizeType>(function.size())); writer.Uint64(calls);
+		}
+		writer.EndObject();
+		writer.EndObject();
+
+		//memory
+		writer.Key("memory");
+		writer.StartObject();
+		writer.Key("allocations"); writer.Uint64(m_allocations);
+		writer.Key("allocatedBytes"); writer.Uint64(m_allocatedBytes);
+		writer.Key("allocationsPerFrame"); writer.Double(perFrame(m_allocations));
+		writer.Key("peakRssBytes"); writer.Uint64(GetPeakResidentBytes());
+		writer.EndObject();
+
+		writer.EndObject();
+
+		std::ofstream outputFile(m_settings.reportPath, std::ios::out | std::ios::trunc);
+		if (!outputFile) {
+			LOGGING_ERROR("Headless: cannot write report to {}", m_settings.reportPath.string());
+			return false;
+		}
+		outputFile << buffer.GetString() << '\n';
+		LOGGING_INFO("Headless: report written to {}", m_settings.reportPath.string());
+		return outputFile.good();
+	}
+
+	int HeadlessRunner::m_Cleanup() {
+		m_ecs.Unload();
+		m_physicsManager.Shutdown();
+
+		LOGGING_INFO("Headless Closed");
+		return 0;
+	}
+}
@@ -0,0 +1,123 @@
+/******************************************************************/
+/*!
+\file      HeadlessRunner.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Runs the engine loop without a window for benchmarking.
+		   A scene file or a synthetic scene is loaded, the ECS is
+		   stepped for a number of frames at a fixed delta time and
+		   a JSON report of the run is written.
+
+		   Graphics runs on the null GL backend, systems still submit
+		   their draw data but nothing is drawn. The submissions are
+		   counted and cleared every frame.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef HEADLESSRUNNER_H
+#define HEADLESSRUNNER_H
+
+#include "Graphics/GraphicsManager.h"
+#include "Debugging/Logging.h"
+#include "Debugging/Performance.h"
+#include "Inputs/Input.h"
+#include "Resources/ResourceManager.h"
+#include "Scene/SceneManager.h"
+#include "Physics/PhysicsManager.h"
+#include "Scripting/ScriptManager.h"
+#include "DeSerialization/json_handler.h"
+#include "Reflection/Field.h"
+#include "ECS/ECS.h"
+#include "SyntheticScene.h"
+
+namespace headless {
+
+	struct RunSettings {
+		//a scene file is loaded if set, the synthetic scene is generated otherwise
+		std::filesystem::path scenePath;
+		SyntheticSceneSettings synthetic;
+		std::filesystem::path resourceDirectory;
+		//script dll directory, scripts are not loaded if empty
+		std::filesystem::path scriptDirectory;
+
+		size_t frames{ 600 };
+		//run before the measured frames, lets resources load and caches settle
+		size_t warmupFrames{ 60 };
+		float deltaTime{ 1.f / 60.f };
+		//runs the RUNNING state systems (physics, scripts), the editor state otherwise
+		bool play{ false };
+		//share of the root entities moved every frame
+		float movingFraction{ 0.01f };
+
+		std::filesystem::path reportPath{ "headless_report.json" };
+		//chrome trace of the measured frames, not written if empty
+		std::filesystem::path tracePath;
+	};
+
+	/******************************************************************/
+	/*!
+	\class     HeadlessRunner
+	\brief     Owns the engine managers the same way the Application
+			   does, minus the window and the render pipeline.
+	*/
+	/******************************************************************/
+	class HeadlessRunner {
+	public:
+		HeadlessRunner() = default;
+		~HeadlessRunner() = default;
+
+		HeadlessRunner(const HeadlessRunner&) = delete;
+		HeadlessRunner& operator=(const HeadlessRunner&) = delete;
+
+		int Init(const RunSettings& settings);
+		int Run();
+		bool WriteReport();
+		int m_Cleanup();
+
+	private:
+		struct Samples {
+			std::vector<float> values;
+
+			void Add(float value) { values.push_back(value); }
+			float Mean() const;
+			float Percentile(float percent) const;
+			float Max() const;
+		};
+
+		void StepFrame(bool measured);
+		void MoveEntities(size_t frame);
+
+		RunSettings m_settings;
+		std::string m_sceneName;
+		std::vector<ecs::EntityID> m_movingEntities;
+
+		//per measured frame
+		Samples m_frameTimes;			// milliseconds
+		Samples m_criticalPath;			// milliseconds
+		std::map<std::string, Samples> m_systemTimes;	// milliseconds
+		std::map<std::string, int> m_systemWorkers;
+		SubmissionCounts m_submissions;	// summed over the measured frames
+		uint64_t m_allocations{};
+		uint64_t m_allocatedBytes{};
+		uint64_t m_glCalls{};
+		double m_wallTimeMs{};
+
+		//all dependencies should be here
+		Peformance m_peformance;
+		GraphicsManager m_graphicsManager;
+		ResourceManager m_resourceManager;
+		Input::InputSystem m_input;
+		physics::PhysicsManager m_physicsManager;
+		Fields m_reflectionField;
+		ecs::ECS m_ecs{ m_peformance, m_graphicsManager, m_resourceManager, m_input, m_physicsManager, m_scriptManager };
+		serialization::Serialization m_serialization{ m_ecs };
+		scenes::SceneManager m_sceneManager{ m_ecs, m_serialization, m_resourceManager };
+		ScriptManager m_scriptManager{ m_ecs, m_sceneManager, m_input, m_physicsManager, m_resourceManager, m_reflectionField };
+	};
+}
+
+#endif HEADLESSRUNNER_H
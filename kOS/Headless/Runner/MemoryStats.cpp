@@ -0,0 +1,98 @@
+/******************************************************************/
+/*!
+\file      MemoryStats.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Counting replacements of the global operator new/delete
+		   and the peak resident set query.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "MemoryStats.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+	std::atomic<uint64_t> s_allocationCount{ 0 };
+	std::atomic<uint64_t> s_allocatedBytes{ 0 };
+
+	void* CountedAllocate(std::size_t size) {
+		s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+		s_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+		return std::malloc(size ? size : 1);
+	}
+
+	void* CountedAllocateAligned(std::size_t size, std::align_val_t alignment) {
+		s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+		s_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+		const std::size_t align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+		return _aligned_malloc(size ? size : 1, align);
+#else
+		//aligned_alloc needs the size to be a multiple of the alignment
+		return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+	}
+
+	void FreeAligned(void* pointer) {
+#ifdef _WIN32
+		_aligned_free(pointer);
+#else
+		std::free(pointer);
+#endif
+	}
+}
+
+//the array and nothrow forms forward to these
+void* operator new(std::size_t size) {
+	if (void* pointer = CountedAllocate(size)) return pointer;
+	throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+	if (void* pointer = CountedAllocateAligned(size, alignment)) return pointer;
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
+
+namespace headless {
+
+	AllocationStats GetAllocationStats() {
+		return AllocationStats{ s_allocationCount.load(std::memory_order_relaxed), s_allocatedBytes.load(std::memory_order_relaxed) };
+	}
+
+	uint64_t GetPeakResidentBytes() {
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS counters{};
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+			return counters.PeakWorkingSetSize;
+		}
+		return 0;
+#else
+		rusage usage{};
+		if (getrusage(RUSAGE_SELF, &usage) == 0) {
+			//kilobytes on linux
+			return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+		}
+		return 0;
+#endif
+	}
+}
@@ -0,0 +1,35 @@
+/******************************************************************/
+/*!
+\file      MemoryStats.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Process memory statistics for the headless runner. The
+		   runner replaces the global operator new to count every
+		   heap allocation made through it.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef MEMORYSTATS_H
+#define MEMORYSTATS_H
+
+#include <cstdint>
+
+namespace headless {
+
+	struct AllocationStats {
+		uint64_t count{};
+		uint64_t bytes{};
+	};
+
+	//allocations since the process started, the difference of two calls gives the allocations in between
+	AllocationStats GetAllocationStats();
+
+	//largest resident set of the process so far, 0 if the platform does not report it
+	uint64_t GetPeakResidentBytes();
+}
+
+#endif MEMORYSTATS_H
@@ -0,0 +1,94 @@
+/******************************************************************/
+/*!
+\file      SyntheticScene.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Generates scenes of a given size, hierarchy depth and
+		   component mix for the headless benchmarks.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "Config/pch.h"
+#include "SyntheticScene.h"
+#include <random>
+
+namespace headless {
+
+	bool ParseComponentMix(std::string_view mix, SyntheticSceneSettings& settings) {
+		SyntheticSceneSettings parsed = settings;
+		parsed.plainWeight = parsed.lightWeight = parsed.boxWeight = 0.f;
+
+		while (!mix.empty()) {
+			const size_t comma = mix.find(',');
+			const std::string_view entry = mix.substr(0, comma);
+			mix = comma == std::string_view::npos ? std::string_view{} : mix.substr(comma + 1);
+
+			const size_t equals = entry.find('=');
+			if (equals == std::string_view::npos) return false;
+
+			const std::string_view kind = entry.substr(0, equals);
+			const std::string weightText{ entry.substr(equals + 1) };
+			char* end{};
+			const float weight = std::strtof(weightText.c_str(), &end);
+			if (weightText.empty() || *end != '\0' || weight < 0.f) return false;
+
+			if (kind == "plain") parsed.plainWeight = weight;
+			else if (kind == "light") parsed.lightWeight = weight;
+			else if (kind == "box") parsed.boxWeight = weight;
+			else return false;
+		}
+
+		if (parsed.plainWeight + parsed.lightWeight + parsed.boxWeight <= 0.f) return false;
+		settings = parsed;
+		return true;
+	}
+
+	SyntheticScene GenerateSyntheticScene(ecs::ECS& ecs, const std::string& sceneName, const SyntheticSceneSettings& settings) {
+		SyntheticScene scene;
+		scene.entities.reserve(settings.entities);
+
+		const size_t depth = std::max<size_t>(settings.depth, 1);
+		std::mt19937 random{ settings.seed };
+		std::discrete_distribution<int> kinds{ settings.plainWeight, settings.lightWeight, settings.boxWeight };
+		std::uniform_real_distribution<float> offset{ -50.f, 50.f };
+
+		//system membership is resolved once per entity instead of once per added component
+		ecs.BeginRegistrationBatch();
+		for (size_t i = 0; i < settings.entities; ++i) {
+			const ecs::EntityID id = ecs.CreateEntity(sceneName);
+			scene.entities.push_back(id);
+
+			ecs::TransformComponent* transform = ecs.GetComponent<ecs::TransformComponent>(id);
+			if (i % depth == 0) {
+				transform->LocalTransformation.position = { offset(random), offset(random), offset(random) };
+				scene.roots.push_back(id);
+			}
+			else {
+				transform->LocalTransformation.position = { 0.f, 1.f, 0.f };
+				transform->LocalTransformation.rotation = { 0.f, 15.f, 0.f };
+				ecs.SetParent(scene.entities[i - 1], id);
+			}
+
+			switch (kinds(random)) {
+			case 1: {
+				ecs::LightComponent* light = ecs.AddComponent<ecs::LightComponent>(id);
+				light->lightType = static_cast<ecs::LightComponent::LightType>(i % 3);
+				break;
+			}
+			case 2:
+				ecs.AddComponent<ecs::BoxColliderComponent>(id);
+				break;
+			default:
+				break;
+			}
+		}
+		ecs.EndRegistrationBatch();
+
+		return scene;
+	}
+}
@@ -0,0 +1,51 @@
+/******************************************************************/
+/*!
+\file      SyntheticScene.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Generates scenes of a given size, hierarchy depth and
+		   component mix for the headless benchmarks.
+
+		   Entities are built as chains of depth entities, every
+		   entity is the parent of the next one in its chain. Each
+		   entity gets the extra components of one mix kind:
+		   - plain: name and transform only
+		   - light: a point, directional or spot light
+		   - box:   a box collider, a static physics actor and a debug
+					cube submission
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef SYNTHETICSCENE_H
+#define SYNTHETICSCENE_H
+
+#include "ECS/ECS.h"
+
+namespace headless {
+
+	struct SyntheticSceneSettings {
+		size_t entities{ 1000 };
+		size_t depth{ 1 };
+		//relative weights of the mix kinds
+		float plainWeight{ 1.f };
+		float lightWeight{ 0.f };
+		float boxWeight{ 0.f };
+		uint32_t seed{ 1 };
+	};
+
+	struct SyntheticScene {
+		std::vector<ecs::EntityID> entities;
+		std::vector<ecs::EntityID> roots;
+	};
+
+	//"plain=70,light=10,box=20", unknown kinds and malformed weights are rejected
+	bool ParseComponentMix(std::string_view mix, SyntheticSceneSettings& settings);
+
+	SyntheticScene GenerateSyntheticScene(ecs::ECS& ecs, const std::string& sceneName, const SyntheticSceneSettings& settings);
+}
+
+#endif SYNTHETICSCENE_H
@@ -0,0 +1,131 @@
+/******************************************************************/
+/*!
+\file      main.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Entry point of the headless benchmark runner.
+
+		   Kos_Headless [options]
+		   --scene <path>       scene file to load, a synthetic scene is generated otherwise
+		   --resources <dir>    resource directory of the scene's assets
+		   --scripts <dir>      script dll directory, scripts are not loaded otherwise
+		   --entities <n>       synthetic entity count (1000)
+		   --depth <d>          synthetic hierarchy depth (1)
+		   --mix <kinds>        synthetic component mix, eg. plain=70,light=10,box=20
+		   --seed <n>           synthetic scene seed (1)
+		   --frames <n>         measured frames (600)
+		   --warmup <n>         frames run before measuring (60)
+		   --dt <seconds>       fixed delta time (1/60)
+		   --moving <fraction>  share of root entities moved every frame (0.01)
+		   --play               run the play state systems (physics, scripts)
+		   --out <path>         report path (headless_report.json)
+		   --trace <path>       chrome trace of the measured frames
+		   --log <path>         log file (headless.log)
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+
+#include "Config/pch.h"
+#include "HeadlessRunner.h"
+
+namespace {
+
+	bool ParseSize(const char* text, size_t& out) {
+		char* end{};
+		const unsigned long long value = std::strtoull(text, &end, 10);
+		if (end == text || *end != '\0') return false;
+		out = static_cast<size_t>(value);
+		return true;
+	}
+
+	bool ParseFloat(const char* text, float& out) {
+		char* end{};
+		const float value = std::strtof(text, &end);
+		if (end == text || *end != '\0') return false;
+		out = value;
+		return true;
+	}
+
+	bool ParseArguments(int argc, char** argv, headless::RunSettings& settings, std::filesystem::path& logPath) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view option = argv[i];
+			if (option == "--play") {
+				settings.play = true;
+				continue;
+			}
+
+			if (i + 1 >= argc) {
+				std::cerr << "Missing value for " << option << '\n';
+				return false;
+			}
+			const char* value = argv[++i];
+
+			bool valid = true;
+			size_t number{};
+			if (option == "--scene") settings.scenePath = value;
+			else if (option == "--resources") settings.resourceDirectory = value;
+			else if (option == "--scripts") settings.scriptDirectory = value;
+			else if (option == "--entities") valid = ParseSize(value, settings.synthetic.entities);
+			else if (option == "--depth") valid = ParseSize(value, settings.synthetic.depth) && settings.synthetic.depth > 0;
+			else if (option == "--mix") valid = headless::ParseComponentMix(value, settings.synthetic);
+			else if (option == "--seed") {
+				valid = ParseSize(value, number);
+				settings.synthetic.seed = static_cast<uint32_t>(number);
+			}
+			else if (option == "--frames") valid = ParseSize(value, settings.frames);
+			else if (option == "--warmup") valid = ParseSize(value, settings.warmupFrames);
+			else if (option == "--dt") valid = ParseFloat(value, settings.deltaTime) && settings.deltaTime > 0.f;
+			else if (option == "--moving") valid = ParseFloat(value, settings.movingFraction);
+			else if (option == "--out") settings.reportPath = value;
+			else if (option == "--trace") settings.tracePath = value;
+			else if (option == "--log") logPath = value;
+			else {
+				std::cerr << "Unknown option " << option << '\n';
+				return false;
+			}
+
+			if (!valid) {
+				std::cerr << "Invalid value for " << option << ": " << value << '\n';
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	headless::RunSettings settings;
+	std::filesystem::path logPath{ "headless.log" };
+	if (!ParseArguments(argc, argv, settings, logPath)) {
+		std::cerr << "Usage: Kos_Headless [--scene <path> --resources <dir>] [--entities <n> --depth <d> --mix plain=70,light=10,box=20]\n"
+			"                    [--frames <n>] [--warmup <n>] [--dt <seconds>] [--moving <fraction>] [--play]\n"
+			"                    [--out <report.json>] [--trace <trace.json>] [--log <path>] [--scripts <dir>]\n";
+		return 2;
+	}
+
+	LOGGING_INIT_LOGS(logPath.string());
+	//the console is for the summary, everything else goes to the log file
+	logging::Logger::m_GetInstance().m_SetConsoleOutput(false);
+
+	//the runner owns every manager, keep it off the stack
+	auto runner = std::make_unique<headless::HeadlessRunner>();
+	int result = runner->Init(settings);
+	if (result == 0) {
+		result = runner->Run();
+	}
+	if (result == 0 && !runner->WriteReport()) {
+		result = 1;
+	}
+	runner->m_Cleanup();
+	LOGGING_FLUSH();
+
+	if (result == 0) {
+		std::cout << "Report written to " << settings.reportPath.string() << '\n';
+	}
+	return result;
+}
@@ -31,6 +31,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "AssetManager/AssetManager.h"
 #include "Configs/ConfigPath.h"
 #include "Debugging/Performance.h"
+#include "Debugging/Profiler.h"
 #include "Scripting/ScriptManager.h"
 #include "Physics/PhysicsManager.h"
 
@@ -157,6 +158,11 @@ namespace Application {
                 --------------------------------------------------------------*/
                 lvWindow.Update();
 
+                /*--------------------------------------------------------------
+                    UPLOAD RESOURCES LOADED IN THE BACKGROUND
+                --------------------------------------------------------------*/
+                resourceManager.ProcessUploads();
+
                 /*--------------------------------------------------------------
                     UPDATE ECS
                 --------------------------------------------------------------*/
@@ -204,6 +210,15 @@ namespace Application {
                     ecs Endframe
                 --------------------------------------------------------------*/
                 ecs.EndFrame();
+                /*--------------------------------------------------------------
+                    ResourceManager Endframe, evicts over the memory budget
+                --------------------------------------------------------------*/
+                resourceManager.EndFrame();
+
+                /*--------------------------------------------------------------
+                    Profiler Endframe
+                --------------------------------------------------------------*/
+                KOS_PROFILE_END_FRAME();
 
                 graphicsManager.gm_ClearGBuffer();
 
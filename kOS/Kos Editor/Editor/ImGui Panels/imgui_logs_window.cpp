@@ -33,7 +33,14 @@ void gui::ImGuiHandler::DrawLogsWindow() {
     // Most of the contents of the window will be added by the log.Draw() call.
     //ImGui::SetNextWindowSize(ImVec2(500, 400), ImGuiCond_FirstUseEver);
     ImGui::Begin("Log", &open);
-    std::vector<std::string> log_Entries = logging::Logger::m_GetInstance().m_GetLogList();
+    // Only copy the list again when the logger has written something new
+    static std::vector<std::string> log_Entries;
+    static uint64_t log_Version{};
+    auto& logger = logging::Logger::m_GetInstance();
+    if (logger.m_GetLogVersion() != log_Version) {
+        log_Version = logger.m_GetLogVersion();
+        log_Entries = logger.m_GetLogList();
+    }
     //for (size_t i = 0; i < log_Entries.size(); ++i) {
     //    ImGui::Text(log_Entries[i].c_str());
     //}
@@ -22,6 +22,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Editor.h"
 #include "Debugging/Logging.h"
 #include "Debugging/Performance.h"
+#include "Debugging/Profiler.h"
 
 
 void gui::ImGuiHandler::DrawPerformanceWindow() {
@@ -76,20 +77,37 @@ void gui::ImGuiHandler::DrawPerformanceWindow() {
 
         static float interval = 0.0f;
         static std::unordered_map<std::string, float> systemPeformance;
+        static std::unordered_map<std::string, int> systemWorker;
+        static float criticalPath{};
 
         // Always get fresh data
         interval += m_performance.GetDeltaTime();
 
         if (interval > 1.0f) { // updates display every 1 second
             systemPeformance = m_performance.GetSystemPerformance(); // update map to display
+            systemWorker = m_performance.GetSystemWorker();
+            criticalPath = m_performance.GetCriticalPath();
             interval = 0.0f;
         }
 
+        ImGui::Text("Critical Path");
+        ImGui::SameLine(300);
+        ImGui::Text("%.4f ms", criticalPath * 1000.0f);
+        ImGui::Separator();
+
         // Display last stored values
         for (const auto& [systemName, duration] : systemPeformance) {
             ImGui::Text("%s", systemName.c_str());
             ImGui::SameLine(300);
             ImGui::Text("%.4f ms", duration * 1000.0f);
+            ImGui::SameLine(400);
+            const auto workerIt = systemWorker.find(systemName);
+            if (workerIt == systemWorker.end() || workerIt->second < 0) {
+                ImGui::Text("Main");
+            }
+            else {
+                ImGui::Text("Worker %d", workerIt->second);
+            }
         }
     }
 
@@ -118,6 +136,92 @@ void gui::ImGuiHandler::DrawPerformanceWindow() {
         }
     }
 
+    if (ImGui::CollapsingHeader("Resource Memory")) {
+
+        constexpr float megabyte = 1024.f * 1024.f;
+        const ResourceMemory resident = m_resourceManager.GetResidentMemory();
+        const size_t budget = m_resourceManager.GetMemoryBudget();
+
+        static int budgetMB = 0;
+        // 0 keeps everything resident
+        if (ImGui::InputInt("Budget (MB)", &budgetMB)) {
+            budgetMB = std::max(budgetMB, 0);
+            m_resourceManager.SetMemoryBudget(budgetMB == 0 ? std::numeric_limits<size_t>::max() : static_cast<size_t>(budgetMB) * 1024 * 1024);
+        }
+        if (budget == std::numeric_limits<size_t>::max()) {
+            ImGui::Text("Resident %.2f MB, no budget", resident.Total() / megabyte);
+        }
+        else {
+            ImGui::Text("Resident %.2f / %.2f MB", resident.Total() / megabyte, budget / megabyte);
+        }
+
+        ImGui::Text("Type");
+        ImGui::SameLine(300);
+        ImGui::Text("Count");
+        ImGui::SameLine(380);
+        ImGui::Text("CPU MB");
+        ImGui::SameLine(460);
+        ImGui::Text("GPU MB");
+        ImGui::Separator();
+
+        for (const auto& [typeName, usage] : m_resourceManager.GetMemoryUsageByType()) {
+            ImGui::Text("%s", typeName.c_str());
+            ImGui::SameLine(300);
+            ImGui::Text("%zu", usage.count);
+            ImGui::SameLine(380);
+            ImGui::Text("%.2f", usage.memory.cpuBytes / megabyte);
+            ImGui::SameLine(460);
+            ImGui::Text("%.2f", usage.memory.gpuBytes / megabyte);
+        }
+    }
+
+    if (ImGui::CollapsingHeader("Profiler Zones")) {
+
+        auto& profiler = profiling::Profiler::GetInstance();
+
+        bool enabled = profiler.IsEnabled();
+        if (ImGui::Checkbox("Enabled", &enabled)) {
+            profiler.SetEnabled(enabled);
+        }
+        ImGui::SameLine();
+        if (!profiler.IsCapturing()) {
+            if (ImGui::Button("Capture 300 Frames")) {
+                profiler.BeginCapture(300);
+            }
+        }
+        else {
+            // Written out as Chrome trace JSON, open in chrome://tracing or Perfetto
+            if (ImGui::Button("Save Capture")) {
+                profiler.WriteChromeTrace("ProfilerCapture.json");
+            }
+            ImGui::SameLine();
+            ImGui::Text("%zu frames", profiler.GetCapturedFrames());
+        }
+
+        ImGui::Text("Zone");
+        ImGui::SameLine(300);
+        ImGui::Text("Mean");
+        ImGui::SameLine(380);
+        ImGui::Text("P95");
+        ImGui::SameLine(460);
+        ImGui::Text("Max");
+        ImGui::SameLine(540);
+        ImGui::Text("Calls");
+        ImGui::Separator();
+
+        for (const auto& zone : profiler.GetZoneStats()) {
+            ImGui::Text("%s", zone.name.c_str());
+            ImGui::SameLine(300);
+            ImGui::Text("%.3f", zone.mean);
+            ImGui::SameLine(380);
+            ImGui::Text("%.3f", zone.p95);
+            ImGui::SameLine(460);
+            ImGui::Text("%.3f", zone.max);
+            ImGui::SameLine(540);
+            ImGui::Text("%u", zone.calls);
+        }
+    }
+
 
     ImGui::End();
 
@@ -21,6 +21,25 @@ public:
 private:
 };
 
+//Update runs in parallel chunks on the worker threads. It may only read the listed components through Read
+//and write the script's own fields, spawning/deleting and other component writes belong in LateUpdate
+template <typename... ReadComponents>
+class TemplateJobSC : public TemplateSC {
+public:
+	bool IsJob() const override { return true; }
+
+	//component keys are cached on first use, resolve them before the workers read
+	void PrepareJob() override {
+		(..., ecsPtr->GetComponentKey<ReadComponents>());
+	}
+
+	template <typename T>
+	const T* Read(ecs::EntityID id) const {
+		static_assert((std::is_same_v<T, ReadComponents> || ...), "component is not declared as read by the job script");
+		return ecsPtr->GetComponent<T>(id);
+	}
+};
+
 
 template <typename T>
 int DuplicatePrefabIntoScene(const std::string& scene, const utility::GUID guid) {
@@ -32,19 +51,19 @@ int DuplicatePrefabIntoScene(const std::string& scene, const utility::GUID guid)
 		return -1;
 	}
 
-	auto* sm = TemplateSC::Scenes;
-	sm->LoadSceneToCurrent(scene, path);
-	auto* ecs = TemplateSC::ecsPtr;
-	const auto& sceneData = ecs->GetSceneData(scene);
-	ecs::EntityID newID;
-
-	//retrieve the new id that just spawned (the one without parent) - TODO: improve this later
-	for ( auto entityID : sceneData.sceneIDs) {
-		auto* tc = ecs->GetComponent<ecs::TransformComponent>(entityID);
-		if (tc->m_haveParent == false) {
-			return static_cast<int>(entityID);
-		}
-	}
+	//the prefab file is only read on the first spawn, the root of the new instance is returned directly
+	return TemplateSC::Scenes->InstantiatePrefab(path, scene);
+}
+
+//released instances of the prefab are hidden and reused by DuplicatePrefabIntoScene, 0 turns pooling off
+template <typename T>
+void SetPrefabPoolCapacity(const utility::GUID guid, size_t capacity) {
+	std::string path = TemplateSC::resource->GetResourcePath<T>(guid);
+	if (path.empty()) return;
+	TemplateSC::Scenes->SetPrefabPoolCapacity(path, capacity);
+}
 
-	return -1;
+//use instead of DeleteEntity for spawned prefabs, deletes the instance when its prefab is not pooled
+inline void ReleasePrefabInstance(ecs::EntityID root) {
+	TemplateSC::Scenes->ReleasePrefabInstance(root);
 }
@@ -52,7 +52,7 @@ public:
 			//	ecsPtr->DeleteEntity(entity);
 			//}
 			if (currentTimer >= timeBeforeDeath || isDead) {
-				ecsPtr->DeleteEntity(entity);
+				ReleasePrefabInstance(entity);
 			}
 		}
 	}
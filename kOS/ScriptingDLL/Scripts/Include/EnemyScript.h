@@ -5,7 +5,8 @@
 #include "ScriptAdapter/TemplateSC.h"
 
 
-class EnemyScripts : public TemplateSC {
+//only touches its own fields, runs as a job
+class EnemyScripts : public TemplateJobSC<> {
 public:
 	int health;
 	int shield;
@@ -60,6 +60,9 @@ public:
 
 		playerCurrentMovementSpeed = playerMovementSpeed;
 		originalDrag = ecsPtr->GetComponent<ecs::RigidbodyComponent>(entity)->drag;
+
+		//bullets are fired every click, BulletLogic hands them back instead of deleting them
+		SetPrefabPoolCapacity<R_Scene>(bulletPrefab, 32);
 	}
 
 	void Update() override {
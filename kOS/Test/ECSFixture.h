@@ -0,0 +1,63 @@
+/******************************************************************/
+/*!
+\file      ECSFixture.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Test fixture that wires up the ECS and its injected
+		   managers the same way the Application does, without
+		   creating a window or initializing any system.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#pragma once
+
+#include <gtest/gtest.h>
+#include "ECS/ECS.h"
+#include "Scene/SceneManager.h"
+#include "Scripting/ScriptManager.h"
+#include "DeSerialization/json_handler.h"
+#include "Reflection/Field.h"
+
+class ECSFixture : public ::testing::Test {
+protected:
+	void SetUp() override {
+		m_ecs.Load();
+		m_ecs.AddScene(sceneName, SceneData{});
+	}
+
+	void TearDown() override {
+		m_ecs.Unload();
+	}
+
+	//elapsed time of func in milliseconds
+	template <typename Func>
+	static double TimeMs(Func&& func) {
+		auto start = std::chrono::steady_clock::now();
+		func();
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	}
+
+	//standalone system instance wired to the fixture's managers, entities are registered by the test
+	template <typename T>
+	std::unique_ptr<T> MakeSystem() {
+		return std::make_unique<T>(m_ecs, m_graphicsManager, m_resourceManager, m_input, m_physicsManager, m_scriptManager, m_peformance);
+	}
+
+	const std::string sceneName{ "Test Scene" };
+
+	Peformance m_peformance;
+	GraphicsManager m_graphicsManager;
+	ResourceManager m_resourceManager;
+	Input::InputSystem m_input;
+	physics::PhysicsManager m_physicsManager;
+	Fields m_reflectionField;
+	ecs::ECS m_ecs{ m_peformance, m_graphicsManager, m_resourceManager, m_input, m_physicsManager, m_scriptManager };
+	serialization::Serialization m_serialization{ m_ecs };
+	scenes::SceneManager m_sceneManager{ m_ecs, m_serialization, m_resourceManager };
+	ScriptManager m_scriptManager{ m_ecs, m_sceneManager, m_input, m_physicsManager, m_resourceManager, m_reflectionField };
+};
@@ -0,0 +1,55 @@
+/******************************************************************/
+/*!
+\file      ResourceFiles.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     Writes small resource files in the engine's compiled
+		   formats for tests that load through the ResourceManager.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#pragma once
+
+#include "Config/pch.h"
+
+namespace testfiles {
+	template <typename T>
+	void WriteValue(std::ofstream& file, const T& value) {
+		file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	//one mesh of vertexCount vertices and one bone in the engine's .mesh layout
+	inline void WriteMeshFile(const std::filesystem::path& path, size_t vertexCount = 3) {
+		std::ofstream file(path, std::ios::binary);
+		WriteValue(file, size_t{ 1 });
+		WriteValue(file, vertexCount);
+		for (size_t i = 0; i < vertexCount; ++i) {
+			for (int value = 0; value < 14; ++value) WriteValue(file, static_cast<float>(i));
+			for (int bone = 0; bone < 4; ++bone) WriteValue(file, int{ 0 });
+			for (int weight = 0; weight < 4; ++weight) WriteValue(file, 0.25f);
+		}
+		WriteValue(file, vertexCount);
+		for (size_t i = 0; i < vertexCount; ++i) WriteValue(file, static_cast<unsigned int>(i));
+
+		const std::string bone{ "root" };
+		WriteValue(file, size_t{ 1 });
+		WriteValue(file, bone.size());
+		file.write(bone.data(), bone.size());
+		WriteValue(file, int{ 0 });
+
+		WriteValue(file, size_t{ 1 });
+		WriteValue(file, glm::mat4{ 1.f });
+		WriteValue(file, glm::mat4{ 1.f });
+	}
+
+	inline utility::GUID MakeGUID(uint64_t high, uint64_t low) {
+		utility::GUID guid{};
+		guid.high = high;
+		guid.low = low;
+		return guid;
+	}
+}
@@ -0,0 +1,962 @@
+/******************************************************************/
+/*!
+\file      benchmark.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains micro benchmarks for the engine's hot
+		   paths. Each benchmark checks both paths produce the same
+		   result and prints their timings.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "ECSFixture.h"
+#include "Pathfinding/OctreeGrid.h"
+#include "Pathfinding/PathQueryService.h"
+#include "Debugging/Profiler.h"
+#include "Graphics/NullGL.h"
+#include "ResourceFiles.h"
+#include <random>
+
+using namespace ecs;
+
+namespace {
+	constexpr int BENCHMARK_ITERATIONS = 100;
+
+	class ChaseScript : public Component, public ScriptClass {
+	public:
+		float speed{ 2.f };
+		glm::vec3 position{};
+		void Update() override { position.x += speed * (1.f / 60.f); }
+
+		REFLECTABLE(ChaseScript, speed)
+	};
+
+	//steering towards a target through a few obstacles, the shape of the enemy AI scripts
+	class SteeringScript : public Component, public ScriptClass {
+	public:
+		float speed{ 3.f };
+		glm::vec3 position{};
+		glm::vec3 velocity{};
+		void Update() override {
+			const glm::vec3 target{ 10.f, 0.f, 10.f };
+			glm::vec3 steer = target - position;
+			for (int i = 0; i < 32; ++i) {
+				const glm::vec3 obstacle{ static_cast<float>(i % 8), 0.f, static_cast<float>(i / 8) };
+				const glm::vec3 away = position - obstacle;
+				steer += away / (glm::dot(away, away) + 1.f);
+			}
+			velocity = glm::normalize(steer + glm::vec3(1e-4f)) * speed;
+			position += velocity * (1.f / 60.f);
+		}
+
+		REFLECTABLE(SteeringScript, speed)
+	};
+
+	class SteeringJobScript : public SteeringScript {
+	public:
+		bool IsJob() const override { return true; }
+
+		REFLECTABLE(SteeringJobScript, speed)
+	};
+}
+
+TEST_F(ECSFixture, BenchmarkPerEntityLookupVsView) {
+	constexpr int numEntities = 1500;
+
+	for (int i = 0; i < numEntities; ++i) {
+		EntityID id = m_ecs.CreateEntity(sceneName);
+		m_ecs.AddComponent<MeshFilterComponent>(id);
+		m_ecs.AddComponent<MaterialComponent>(id);
+		m_ecs.GetComponent<TransformComponent>(id)->transformation[3][0] = static_cast<float>(i);
+	}
+	const auto& entities = m_ecs.GetComponentsEnties(MeshFilterComponent::classname());
+
+	double lookupSum{};
+	double lookupMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) {
+			for (const EntityID id : entities) {
+				TransformComponent* transform = m_ecs.GetComponent<TransformComponent>(id);
+				MeshFilterComponent* meshFilter = m_ecs.GetComponent<MeshFilterComponent>(id);
+				MaterialComponent* material = m_ecs.GetComponent<MaterialComponent>(id);
+				if (meshFilter && material) lookupSum += transform->transformation[3][0];
+			}
+		}
+	});
+
+	double viewSum{};
+	double viewMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) {
+			m_ecs.View<TransformComponent, MeshFilterComponent, MaterialComponent>().Each(
+				[&](EntityID, TransformComponent& transform, MeshFilterComponent&, MaterialComponent&) {
+					viewSum += transform.transformation[3][0];
+				});
+		}
+	});
+
+	EXPECT_DOUBLE_EQ(lookupSum, viewSum);
+	std::cout << "[ BENCHMARK] " << numEntities << " entities x " << BENCHMARK_ITERATIONS << " frames\n"
+		<< "             per-entity GetComponent : " << lookupMs << " ms\n"
+		<< "             ComponentView           : " << viewMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkStringKeyedVsDenseKeyedAccess) {
+	constexpr int numEntities = 1500;
+
+	std::vector<EntityID> ids;
+	for (int i = 0; i < numEntities; ++i) {
+		EntityID id = m_ecs.CreateEntity(sceneName);
+		m_ecs.AddComponent<MeshFilterComponent>(id);
+		ids.push_back(id);
+	}
+
+	//replicates the old string keyed pool map on top of the same pools
+	std::unordered_map<std::string, std::shared_ptr<ISparseSet>> stringKeyedPools;
+	stringKeyedPools[TransformComponent::classname()] = std::shared_ptr<ISparseSet>(m_ecs.GetComponentPool<TransformComponent>(), [](ISparseSet*) {});
+	stringKeyedPools[MeshFilterComponent::classname()] = std::shared_ptr<ISparseSet>(m_ecs.GetComponentPool<MeshFilterComponent>(), [](ISparseSet*) {});
+
+	size_t stringHits{};
+	double stringMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) {
+			for (const EntityID id : ids) {
+				auto* transform = std::static_pointer_cast<SparseSet<TransformComponent>>(stringKeyedPools.at(TransformComponent::classname()))->Get(id);
+				if (transform && stringKeyedPools.at(MeshFilterComponent::classname())->ContainsEntity(id)) ++stringHits;
+			}
+		}
+	});
+
+	size_t denseHits{};
+	double denseMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) {
+			for (const EntityID id : ids) {
+				auto* transform = m_ecs.GetComponent<TransformComponent>(id);
+				if (transform && m_ecs.HasComponent<MeshFilterComponent>(id)) ++denseHits;
+			}
+		}
+	});
+
+	EXPECT_EQ(stringHits, denseHits);
+	const double accesses = static_cast<double>(numEntities) * BENCHMARK_ITERATIONS * 2.0;
+	std::cout << "[ BENCHMARK] " << numEntities << " entities x " << BENCHMARK_ITERATIONS << " frames\n"
+		<< "             string keyed access : " << stringMs * 1.0e6 / accesses << " ns/access\n"
+		<< "             dense keyed access  : " << denseMs * 1.0e6 / accesses << " ns/access\n";
+}
+
+TEST_F(ECSFixture, BenchmarkTransformHierarchyFullVsDirty) {
+	//30 trees, 5 levels deep, 4 children per node = 10230 entities
+	constexpr int numTrees = 30;
+	constexpr int depth = 5;
+	constexpr int branching = 4;
+
+	auto transformSystem = MakeSystem<TransformSystem>();
+	std::vector<EntityID> roots;
+	std::vector<EntityID> all;
+	for (int tree = 0; tree < numTrees; ++tree) {
+		std::vector<EntityID> level{ m_ecs.CreateEntity(sceneName) };
+		roots.push_back(level.front());
+		all.push_back(level.front());
+		for (int d = 1; d < depth; ++d) {
+			std::vector<EntityID> nextLevel;
+			for (const EntityID parent : level) {
+				for (int b = 0; b < branching; ++b) {
+					EntityID child = m_ecs.CreateEntity(sceneName);
+					m_ecs.SetParent(parent, child);
+					m_ecs.GetComponent<TransformComponent>(child)->LocalTransformation.position = { 1.f, static_cast<float>(b), 0.f };
+					nextLevel.push_back(child);
+					all.push_back(child);
+				}
+			}
+			level = std::move(nextLevel);
+		}
+	}
+	for (const EntityID id : all) transformSystem->RegisterSystem(id);
+	transformSystem->Update();
+
+	//previous behaviour, every matrix and decomposition is rebuilt each frame
+	double fullMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) {
+			for (const EntityID root : roots) {
+				TransformSystem::CalculateAllTransform(m_ecs, m_ecs.GetComponent<TransformComponent>(root));
+			}
+		}
+	});
+	transformSystem->Update();
+
+	double staticMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) {
+			transformSystem->Update();
+		}
+	});
+	EXPECT_EQ(transformSystem->GetUpdatedCount(), 0u);
+
+	//1% of the entities move every frame
+	size_t movedUpdates{};
+	double movingMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) {
+			for (size_t i = iter % 100; i < all.size(); i += 100) {
+				m_ecs.GetComponent<TransformComponent>(all[i])->LocalTransformation.rotation.y += 1.f;
+			}
+			transformSystem->Update();
+			movedUpdates += transformSystem->GetUpdatedCount();
+		}
+	});
+
+	//dirty propagation must match a full rebuild
+	std::vector<glm::mat4> dirtyWorld;
+	for (const EntityID id : all) dirtyWorld.push_back(m_ecs.GetComponent<TransformComponent>(id)->transformation);
+	for (const EntityID root : roots) {
+		TransformSystem::CalculateAllTransform(m_ecs, m_ecs.GetComponent<TransformComponent>(root));
+	}
+	for (size_t i = 0; i < all.size(); ++i) {
+		const glm::mat4& fullWorld = m_ecs.GetComponent<TransformComponent>(all[i])->transformation;
+		for (int column = 0; column < 4; ++column) {
+			EXPECT_TRUE(glm::all(glm::lessThanEqual(glm::abs(dirtyWorld[i][column] - fullWorld[column]), glm::vec4(1e-4f))));
+		}
+	}
+
+	std::cout << "[ BENCHMARK] " << all.size() << " entities, " << depth << " levels x " << BENCHMARK_ITERATIONS << " frames\n"
+		<< "             full rebuild         : " << fullMs << " ms\n"
+		<< "             dirty, static scene  : " << staticMs << " ms\n"
+		<< "             dirty, 1% moving     : " << movingMs << " ms (" << movedUpdates / BENCHMARK_ITERATIONS << " matrices/frame)\n";
+}
+
+TEST_F(ECSFixture, BenchmarkBulkDeleteSceneRemoval) {
+	constexpr int numEntities = 5000;
+
+	std::vector<EntityID> ids;
+	for (int i = 0; i < numEntities; ++i) ids.push_back(m_ecs.CreateEntity(sceneName));
+
+	//previous removal, find the scene by scanning then erase from the middle of sceneIDs
+	std::vector<EntityID> linearSceneIDs = m_ecs.sceneMap.at(sceneName).sceneIDs;
+	double linearMs = TimeMs([&]() {
+		for (const EntityID id : ids) {
+			auto it = std::find(linearSceneIDs.begin(), linearSceneIDs.end(), id);
+			linearSceneIDs.erase(it);
+		}
+	});
+
+	double indexedMs = TimeMs([&]() {
+		for (const EntityID id : ids) m_ecs.DeleteEntity(id);
+		m_ecs.EndFrame();
+	});
+
+	EXPECT_TRUE(linearSceneIDs.empty());
+	EXPECT_TRUE(m_ecs.sceneMap.at(sceneName).sceneIDs.empty());
+	std::cout << "[ BENCHMARK] delete " << numEntities << " entities\n"
+		<< "             linear scan + erase (scene only) : " << linearMs << " ms\n"
+		<< "             indexed swap-remove (full delete) : " << indexedMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkPrefabSpawnImmediateVsCommandBuffer) {
+	constexpr int numInstances = 5000;
+
+	//prefab template with 12 components
+	EntityID prefab = m_ecs.CreateEntity(sceneName);
+	m_ecs.AddComponent<MeshFilterComponent>(prefab);
+	m_ecs.AddComponent<MaterialComponent>(prefab);
+	m_ecs.AddComponent<MeshRendererComponent>(prefab);
+	m_ecs.AddComponent<SpriteComponent>(prefab);
+	m_ecs.AddComponent<TextComponent>(prefab);
+	m_ecs.AddComponent<LightComponent>(prefab);
+	m_ecs.AddComponent<AudioComponent>(prefab);
+	m_ecs.AddComponent<AnimatorComponent>(prefab);
+	m_ecs.AddComponent<CubeRendererComponent>(prefab);
+	m_ecs.AddComponent<SphereRendererComponent>(prefab);
+
+	const std::string immediateScene{ "Immediate Scene" };
+	const std::string bufferedScene{ "Buffered Scene" };
+	m_ecs.AddScene(immediateScene, SceneData{});
+	m_ecs.AddScene(bufferedScene, SceneData{});
+
+	double immediateMs = TimeMs([&]() {
+		for (int i = 0; i < numInstances; ++i) m_ecs.DuplicateEntity(prefab, immediateScene);
+	});
+
+	double bufferedMs = TimeMs([&]() {
+		auto& commandBuffer = m_ecs.GetCommandBuffer();
+		for (int i = 0; i < numInstances; ++i) commandBuffer.DuplicateEntity(prefab, bufferedScene);
+		m_ecs.EndFrame();
+	});
+
+	EXPECT_EQ(m_ecs.GetSceneData(immediateScene).sceneIDs.size(), static_cast<size_t>(numInstances));
+	EXPECT_EQ(m_ecs.GetSceneData(bufferedScene).sceneIDs.size(), static_cast<size_t>(numInstances));
+	EXPECT_EQ(m_ecs.GetComponentsEnties(LightComponent::classname()).size(), static_cast<size_t>(2 * numInstances + 1));
+	std::cout << "[ BENCHMARK] spawn " << numInstances << " prefab instances (12 components)\n"
+		<< "             immediate registration : " << immediateMs << " ms\n"
+		<< "             command buffer flush   : " << bufferedMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkNavigationGraphBuildAndQuery) {
+	constexpr int numQueries = 1000;
+
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<float> position(-30.f, 30.f);
+	std::vector<Octrees::OctreeObject> obstacles;
+	for (int i = 0; i < 200; ++i) {
+		obstacles.emplace_back(Octrees::Bounds(glm::vec3(position(rng), position(rng), position(rng)), glm::vec3(1.5f)));
+	}
+
+	Octrees::Octree octree;
+	double buildMs = TimeMs([&]() {
+		octree.Build(Octrees::Bounds(glm::vec3(0.f), glm::vec3(32.f)), 1.f, obstacles);
+	});
+
+	//the previous build compared every pair of empty leaves
+	size_t allPairsEdges{};
+	const auto& leaves = octree.emptyLeaves;
+	double allPairsMs = TimeMs([&]() {
+		for (size_t i = 0; i < leaves.size(); ++i) {
+			for (size_t j = i + 1; j < leaves.size(); ++j) {
+				Octrees::Bounds grownI = leaves[i].bounds, grownJ = leaves[j].bounds;
+				grownI.size *= 1.1f;
+				grownJ.size *= 1.1f;
+				if (leaves[i].bounds.Intersects(grownJ) || leaves[j].bounds.Intersects(grownI)) ++allPairsEdges;
+			}
+		}
+	});
+	EXPECT_EQ(allPairsEdges, octree.graph.EdgeCount());
+
+	const auto& graph = octree.graph;
+	std::uniform_int_distribution<Octrees::NodeIndex> pick(0, static_cast<Octrees::NodeIndex>(graph.NodeCount() - 1));
+	std::vector<std::pair<Octrees::NodeIndex, Octrees::NodeIndex>> queries(numQueries);
+	for (auto& query : queries) query = { pick(rng), pick(rng) };
+
+	Octrees::SearchState state;
+	std::vector<Octrees::NodeIndex> path;
+	size_t found{};
+	double queryMs = TimeMs([&]() {
+		for (const auto& [start, end] : queries) {
+			found += graph.AStar(start, end, state, path);
+		}
+	});
+
+	std::cout << "[ BENCHMARK] " << graph.NodeCount() << " empty leaves, " << graph.EdgeCount() << " edges\n"
+		<< "             graph build (octree neighbours) : " << buildMs << " ms\n"
+		<< "             all pairs neighbour test        : " << allPairsMs << " ms\n"
+		<< "             AStar                           : " << queryMs / numQueries << " ms per query ("
+		<< found << "/" << numQueries << " found)\n";
+}
+
+TEST_F(ECSFixture, BenchmarkPathQueriesForChasingAgents) {
+	constexpr ecs::EntityID numAgents = 250;
+	constexpr int numFrames = 30;
+
+	std::mt19937 rng(21);
+	std::uniform_real_distribution<float> position(-30.f, 30.f);
+	std::vector<Octrees::OctreeObject> obstacles;
+	for (int i = 0; i < 200; ++i) {
+		obstacles.emplace_back(Octrees::Bounds(glm::vec3(position(rng), position(rng), position(rng)), glm::vec3(1.5f)));
+	}
+	auto octree = std::make_shared<Octrees::Octree>();
+	octree->Build(Octrees::Bounds(glm::vec3(0.f), glm::vec3(32.f)), 1.f, obstacles);
+	const auto& graph = octree->graph;
+
+	std::uniform_int_distribution<Octrees::NodeIndex> pick(0, static_cast<Octrees::NodeIndex>(graph.NodeCount() - 1));
+	std::vector<glm::vec3> starts(numAgents);
+	for (auto& start : starts) start = graph.nodeCenters[pick(rng)];
+	const glm::vec3 players[2] = { graph.nodeCenters[pick(rng)], graph.nodeCenters[pick(rng)] };
+
+	//previous behaviour, one AStar per agent on the main thread
+	Octrees::SearchState state;
+	std::vector<Octrees::NodeIndex> path;
+	double sequentialMs = TimeMs([&]() {
+		for (ecs::EntityID agent = 0; agent < numAgents; ++agent) {
+			graph.AStar(octree->FindClosestGraphNode(starts[agent]), octree->FindClosestGraphNode(players[agent % 2]), state, path);
+		}
+	});
+
+	//every agent repaths every frame, main thread only pays for Request and Update
+	Octrees::PathQueryService service(m_ecs.GetJobSystem());
+	service.SetGraph(octree);
+	double worstFrameMs{}, totalFrameMs{};
+	for (int frame = 0; frame < numFrames; ++frame) {
+		double frameMs = TimeMs([&]() {
+			for (ecs::EntityID agent = 0; agent < numAgents; ++agent) {
+				service.Request(agent, starts[agent], players[agent % 2]);
+			}
+			service.Update();
+		});
+		worstFrameMs = std::max(worstFrameMs, frameMs);
+		totalFrameMs += frameMs;
+	}
+	service.Flush();
+
+	size_t found{};
+	for (ecs::EntityID agent = 0; agent < numAgents; ++agent) {
+		const auto* result = service.GetPath(agent);
+		found += result && result->found;
+	}
+	EXPECT_GT(found, 0u);
+	std::cout << "[ BENCHMARK] " << numAgents << " agents chasing 2 targets, " << graph.NodeCount() << " nodes\n"
+		<< "             AStar per agent (main thread) : " << sequentialMs << " ms\n"
+		<< "             query service main thread     : " << totalFrameMs / numFrames << " ms avg, " << worstFrameMs << " ms worst frame\n"
+		<< "             searches run                  : " << service.GetSearchCount() << " over " << numFrames << " frames\n";
+}
+
+TEST_F(ECSFixture, BenchmarkAsyncLoggingThroughput) {
+	constexpr int numThreads = 4;
+	constexpr int messagesPerThread = 25000;
+	constexpr int numSynchronous = 2000;
+
+	const std::filesystem::path logPath = std::filesystem::temp_directory_path() / "KosBenchmarkLog.log";
+	{
+		logging::Logger logger(logPath.string());
+		logger.m_SetConsoleOutput(false);
+		logger.m_SetRateLimit(0);
+
+		//previous behaviour, every call formats and flushes the file before returning
+		double synchronousMs = TimeMs([&]() {
+			for (int i = 0; i < numSynchronous; ++i) {
+				logger.m_Info("Spawned particle {} at {}, {}", i, 0.5f * i, 1.f);
+				logger.m_Flush();
+			}
+		});
+
+		std::vector<std::vector<double>> latencies(numThreads);
+		std::vector<std::thread> producers;
+		double producerMs = TimeMs([&]() {
+			for (int thread = 0; thread < numThreads; ++thread) {
+				producers.emplace_back([&, thread]() {
+					auto& samples = latencies[thread];
+					samples.reserve(messagesPerThread);
+					for (int i = 0; i < messagesPerThread; ++i) {
+						auto start = std::chrono::steady_clock::now();
+						logger.m_Info("Spawned particle {} at {}, {}", i, 0.5f * i, static_cast<float>(thread));
+						samples.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+					}
+				});
+			}
+			for (auto& producer : producers) producer.join();
+		});
+		double drainMs = TimeMs([&]() { logger.m_Flush(); });
+
+		std::vector<double> all;
+		for (const auto& samples : latencies) all.insert(all.end(), samples.begin(), samples.end());
+		std::sort(all.begin(), all.end());
+		const double p99 = all[all.size() * 99 / 100];
+		const uint64_t dropped = logger.m_GetDroppedCount();
+		const size_t total = static_cast<size_t>(numThreads) * messagesPerThread;
+
+		EXPECT_LE(logger.m_GetLogList().size(), 1000u);
+		std::cout << "[ BENCHMARK] " << numThreads << " threads x " << messagesPerThread << " log calls\n"
+			<< "             synchronous flush per call : " << synchronousMs * 1000.0 / numSynchronous << " us per call\n"
+			<< "             async caller throughput    : " << total / (producerMs / 1000.0) << " messages/s\n"
+			<< "             async caller p99 latency   : " << p99 << " us\n"
+			<< "             writer throughput          : " << (total - dropped) / ((producerMs + drainMs) / 1000.0) << " messages/s, "
+			<< dropped << " dropped (queue full)\n";
+	}
+	std::filesystem::remove(logPath);
+}
+
+TEST_F(ECSFixture, BenchmarkProfileScopeOverhead) {
+	constexpr int numScopes = 1000000;
+	constexpr int scopesPerFrame = 4096;
+
+	auto& profiler = profiling::Profiler::GetInstance();
+	profiler.EndFrame();
+	const uint64_t droppedBefore = profiler.GetDroppedCount();
+
+	volatile int sink{};
+	double baselineMs = TimeMs([&]() {
+		for (int i = 0; i < numScopes; ++i) sink = sink + 1;
+	});
+
+	profiler.SetEnabled(false);
+	double disabledMs = TimeMs([&]() {
+		for (int i = 0; i < numScopes; ++i) {
+			KOS_PROFILE_SCOPE("Benchmark::Scope");
+			sink = sink + 1;
+		}
+	});
+
+	profiler.SetEnabled(true);
+	double enabledMs = TimeMs([&]() {
+		for (int i = 0; i < numScopes; ++i) {
+			KOS_PROFILE_SCOPE("Benchmark::Scope");
+			sink = sink + 1;
+			if ((i + 1) % scopesPerFrame == 0) profiler.EndFrame();
+		}
+		profiler.EndFrame();
+	});
+
+	const auto stats = profiler.GetZoneStats("Benchmark::Scope");
+	ASSERT_TRUE(stats.has_value());
+	EXPECT_EQ(profiler.GetDroppedCount(), droppedBefore);
+	std::cout << "[ BENCHMARK] " << numScopes << " profile scopes\n"
+		<< "             no scope          : " << baselineMs << " ms\n"
+		<< "             disabled profiler : " << (disabledMs - baselineMs) * 1e6 / numScopes << " ns per scope\n"
+		<< "             enabled profiler  : " << (enabledMs - baselineMs) * 1e6 / numScopes << " ns per scope (including EndFrame)\n";
+}
+
+TEST_F(ECSFixture, BenchmarkSceneLoadJsonVsBinary) {
+	constexpr int numEntities = 10000;
+	constexpr int chainLength = 4;
+
+	const std::filesystem::path jsonPath = std::filesystem::temp_directory_path() / "kos_scene_load_benchmark.json";
+	const std::string savedScene = jsonPath.filename().string();
+	m_ecs.AddScene(savedScene, SceneData{});
+
+	{
+		ecs::RegistrationBatchScope registrationBatch(m_ecs);
+		EntityID parent{};
+		for (int i = 0; i < numEntities; ++i) {
+			EntityID id = m_ecs.CreateEntity(savedScene);
+			m_ecs.GetComponent<TransformComponent>(id)->LocalTransformation.position = glm::vec3(static_cast<float>(i), 0.f, 0.f);
+			if (i % 3 == 0) m_ecs.AddComponent<LightComponent>(id);
+			if (i % 5 == 0) m_ecs.AddComponent<MeshRendererComponent>(id);
+			if (i % chainLength != 0) m_ecs.SetParent(parent, id);
+			parent = id;
+		}
+	}
+	m_serialization.SaveScene(jsonPath);
+	ASSERT_TRUE(serialization::Serialization::IsBinarySceneCurrent(jsonPath));
+
+	const std::string jsonScene{ "Json Scene" };
+	const std::string binaryScene{ "Binary Scene" };
+
+	double jsonMs = TimeMs([&]() {
+		m_serialization.LoadSceneJson(jsonPath, jsonScene);
+	});
+
+	bool loaded{};
+	double binaryMs = TimeMs([&]() {
+		loaded = m_serialization.LoadSceneBinary(serialization::Serialization::GetBinaryScenePath(jsonPath), binaryScene);
+	});
+
+	ASSERT_TRUE(loaded);
+	EXPECT_EQ(m_ecs.GetSceneData(jsonScene).sceneIDs.size(), static_cast<size_t>(numEntities));
+	EXPECT_EQ(m_ecs.GetSceneData(binaryScene).sceneIDs.size(), static_cast<size_t>(numEntities));
+	EXPECT_EQ(m_ecs.GetComponentsEnties(LightComponent::classname()).size(), static_cast<size_t>(3 * ((numEntities + 2) / 3)));
+
+	const auto jsonBytes = std::filesystem::file_size(jsonPath);
+	const auto binaryBytes = std::filesystem::file_size(serialization::Serialization::GetBinaryScenePath(jsonPath));
+	std::filesystem::remove(jsonPath);
+	std::filesystem::remove(serialization::Serialization::GetBinaryScenePath(jsonPath));
+
+	std::cout << "[ BENCHMARK] load scene of " << numEntities << " entities\n"
+		<< "             json   (" << jsonBytes << " bytes) : " << jsonMs << " ms\n"
+		<< "             binary (" << binaryBytes << " bytes) : " << binaryMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkPlayStopCacheFilesVsSnapshot) {
+	constexpr int numEntities = 10000;
+
+	const std::filesystem::path jsonPath = std::filesystem::temp_directory_path() / "kos_play_stop_benchmark.json";
+	const std::string savedScene = jsonPath.filename().string();
+	m_ecs.AddScene(savedScene, SceneData{});
+	{
+		ecs::RegistrationBatchScope registrationBatch(m_ecs);
+		EntityID parent{};
+		for (int i = 0; i < numEntities; ++i) {
+			EntityID id = m_ecs.CreateEntity(savedScene);
+			m_ecs.GetComponent<TransformComponent>(id)->LocalTransformation.position = glm::vec3(static_cast<float>(i), 0.f, 0.f);
+			if (i % 3 == 0) m_ecs.AddComponent<LightComponent>(id);
+			if (i % 4 != 0) m_ecs.SetParent(parent, id);
+			parent = id;
+		}
+	}
+
+	//what play and stop used to do, write the scene out and load it back
+	double cacheFileMs = TimeMs([&]() {
+		m_serialization.SaveScene(jsonPath);
+		m_sceneManager.ImmediateClearScene(savedScene);
+		m_serialization.LoadSceneJson(jsonPath, savedScene);
+	});
+	ASSERT_EQ(m_ecs.GetSceneData(savedScene).sceneIDs.size(), static_cast<size_t>(numEntities));
+
+	ecs::ECSSnapshot snapshot;
+	double takeMs = TimeMs([&]() {
+		m_ecs.TakeSnapshot(snapshot);
+	});
+	double restoreMs = TimeMs([&]() {
+		m_ecs.RestoreSnapshot(snapshot);
+	});
+	EXPECT_EQ(m_ecs.GetSceneData(savedScene).sceneIDs.size(), static_cast<size_t>(numEntities));
+
+	std::filesystem::remove(jsonPath);
+	std::filesystem::remove(serialization::Serialization::GetBinaryScenePath(jsonPath));
+
+	std::cout << "[ BENCHMARK] play/stop with " << numEntities << " entities\n"
+		<< "             cache file save + load   : " << cacheFileMs << " ms\n"
+		<< "             snapshot take + restore  : " << takeMs << " + " << restoreMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkMeshSubmissionGuidLookupVsHandles) {
+	constexpr int numEntities = 5000;
+	if (!nullgl::IsInstalled()) nullgl::Install();
+
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "kos_mesh_submission_benchmark";
+	std::filesystem::create_directories(directory);
+	m_resourceManager.Init(directory.string());
+
+	const utility::GUID meshGUID = testfiles::MakeGUID(1, 1);
+	const utility::GUID materialGUID = testfiles::MakeGUID(2, 1);
+	testfiles::WriteMeshFile(m_resourceManager.GetResourcePath<R_Model>(meshGUID));
+	//the textures have no files, GetResource hands back empty placeholders
+	MaterialData materialData{};
+	materialData.diffuseMaterialGUID = testfiles::MakeGUID(3, 1);
+	materialData.specularMaterialGUID = testfiles::MakeGUID(3, 2);
+	materialData.normalMaterialGUID = testfiles::MakeGUID(3, 3);
+	materialData.ambientOcclusionMaterialGUID = testfiles::MakeGUID(3, 4);
+	materialData.roughnessMaterialGUID = testfiles::MakeGUID(3, 5);
+	serialization::WriteJsonFile(m_resourceManager.GetResourcePath<R_Material>(materialGUID), &materialData);
+
+	auto meshSystem = MakeSystem<MeshRenderSystem>();
+	std::vector<EntityID> ids;
+	{
+		ecs::RegistrationBatchScope registrationBatch(m_ecs);
+		for (int i = 0; i < numEntities; ++i) {
+			EntityID id = m_ecs.CreateEntity(sceneName);
+			m_ecs.AddComponent<MeshFilterComponent>(id)->meshGUID = meshGUID;
+			m_ecs.AddComponent<MaterialComponent>(id)->materialGUID = { materialGUID };
+			meshSystem->RegisterSystem(id);
+			ids.push_back(id);
+		}
+	}
+
+	//what MeshRenderSystem did before, every lookup hashes the GUID and copies a shared_ptr
+	struct GuidMeshData {
+		std::shared_ptr<R_Model> meshToUse;
+		std::shared_ptr<PBRMaterial> meshMaterial;
+		glm::mat4 transformation{ 1.f };
+		int entityID{ -1 };
+	};
+	std::vector<GuidMeshData> guidSubmissions;
+	auto submitByGuid = [&]() {
+		guidSubmissions.clear();
+		auto view = m_ecs.View<NameComponent, TransformComponent, MeshFilterComponent, MaterialComponent>(ids);
+		for (const EntityID id : view.Entities()) {
+			std::shared_ptr<R_Model> mesh = m_resourceManager.GetResource<R_Model>(view.Get<MeshFilterComponent>(id)->meshGUID);
+			std::vector<PBRMaterial> pbrTmpList;
+			for (utility::GUID guid : view.Get<MaterialComponent>(id)->materialGUID) {
+				std::shared_ptr<R_Material> mat = m_resourceManager.GetResource<R_Material>(guid);
+				std::shared_ptr<R_Texture> diff = m_resourceManager.GetResource<R_Texture>(mat->md.diffuseMaterialGUID);
+				std::shared_ptr<R_Texture> spec = m_resourceManager.GetResource<R_Texture>(mat->md.specularMaterialGUID);
+				std::shared_ptr<R_Texture> norm = m_resourceManager.GetResource<R_Texture>(mat->md.normalMaterialGUID);
+				std::shared_ptr<R_Texture> ao = m_resourceManager.GetResource<R_Texture>(mat->md.ambientOcclusionMaterialGUID);
+				std::shared_ptr<R_Texture> rough = m_resourceManager.GetResource<R_Texture>(mat->md.roughnessMaterialGUID);
+				pbrTmpList.push_back(PBRMaterial{ diff,spec,rough,ao,norm });
+			}
+			guidSubmissions.push_back(GuidMeshData{ mesh, std::make_shared<PBRMaterialList>(pbrTmpList, true), view.Get<TransformComponent>(id)->transformation, id });
+		}
+	};
+
+	//warm up, every resource loaded and every handle cached
+	submitByGuid();
+	meshSystem->Update();
+	m_resourceManager.FinishPendingLoads();
+	m_graphicsManager.gm_ClearSubmissions();
+	meshSystem->Update();
+	ASSERT_EQ(m_graphicsManager.gm_GetSubmissionCounts().meshes, static_cast<size_t>(numEntities));
+	ASSERT_EQ(guidSubmissions.size(), static_cast<size_t>(numEntities));
+
+	double guidMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) submitByGuid();
+	});
+	double handleMs = TimeMs([&]() {
+		for (int iter = 0; iter < BENCHMARK_ITERATIONS; ++iter) {
+			m_graphicsManager.gm_ClearSubmissions();
+			meshSystem->Update();
+		}
+	});
+	EXPECT_EQ(m_graphicsManager.gm_GetSubmissionCounts().meshes, static_cast<size_t>(numEntities));
+
+	m_graphicsManager.gm_ClearSubmissions();
+	guidSubmissions.clear();
+	std::filesystem::remove_all(directory);
+
+	std::cout << "[ BENCHMARK] submit " << numEntities << " meshes x " << BENCHMARK_ITERATIONS << " frames\n"
+		<< "             GUID lookup    : " << guidMs << " ms\n"
+		<< "             cached handles : " << handleMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkPrefabSpawnFileVsTemplateVsPool) {
+	constexpr int numInstances = 500;
+
+	//bullet sized prefab, a root and two children
+	const std::filesystem::path prefabPath = std::filesystem::temp_directory_path() / "kos_prefab_benchmark.prefab";
+	const std::string prefabScene = prefabPath.filename().string();
+	m_ecs.AddScene(prefabScene, SceneData{});
+	EntityID root = m_ecs.CreateEntity(prefabScene);
+	m_ecs.AddComponent<MeshFilterComponent>(root);
+	m_ecs.AddComponent<MaterialComponent>(root);
+	m_ecs.AddComponent<MeshRendererComponent>(root);
+	for (int i = 0; i < 2; ++i) {
+		EntityID child = m_ecs.CreateEntity(prefabScene);
+		m_ecs.AddComponent<LightComponent>(child);
+		m_ecs.AddComponent<AudioComponent>(child);
+		m_ecs.SetParent(root, child);
+	}
+	m_serialization.SaveScene(prefabPath);
+	m_sceneManager.ImmediateClearScene(prefabScene);
+	m_ecs.EndFrame();
+
+	const std::string fileScene{ "File Scene" };
+	const std::string templateScene{ "Template Scene" };
+	m_ecs.AddScene(fileScene, SceneData{});
+	m_ecs.AddScene(templateScene, SceneData{});
+
+	//what scripts did before, read the prefab file for every spawn
+	double fileMs = TimeMs([&]() {
+		for (int i = 0; i < numInstances; ++i) m_sceneManager.LoadSceneToCurrent(fileScene, prefabPath);
+	});
+
+	std::vector<EntityID> spawned;
+	double templateMs = TimeMs([&]() {
+		for (int i = 0; i < numInstances; ++i) spawned.push_back(m_sceneManager.InstantiatePrefab(prefabPath, templateScene));
+	});
+
+	m_sceneManager.SetPrefabPoolCapacity(prefabPath, numInstances);
+	for (EntityID id : spawned) m_sceneManager.ReleasePrefabInstance(id);
+	ASSERT_EQ(m_sceneManager.GetPooledInstanceCount(prefabPath), static_cast<size_t>(numInstances));
+
+	double pooledMs = TimeMs([&]() {
+		for (int i = 0; i < numInstances; ++i) m_sceneManager.InstantiatePrefab(prefabPath, templateScene);
+	});
+
+	EXPECT_EQ(m_ecs.GetSceneData(fileScene).sceneIDs.size(), static_cast<size_t>(3 * numInstances));
+	EXPECT_EQ(m_ecs.GetSceneData(templateScene).sceneIDs.size(), static_cast<size_t>(3 * numInstances));
+	EXPECT_EQ(m_sceneManager.GetPooledInstanceCount(prefabPath), 0u);
+
+	std::filesystem::remove(prefabPath);
+	std::filesystem::remove(serialization::Serialization::GetBinaryScenePath(prefabPath));
+
+	std::cout << "[ BENCHMARK] spawn " << numInstances << " prefab instances (3 entities)\n"
+		<< "             load prefab file  : " << fileMs << " ms\n"
+		<< "             copy template     : " << templateMs << " ms\n"
+		<< "             reuse pooled      : " << pooledMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkScriptDispatch) {
+	constexpr int numEnemies = 1000;
+
+	m_ecs.RegisterComponent<ChaseScript>();
+	m_scriptManager.RegisterScript(ChaseScript::classname());
+	auto scriptingSystem = MakeSystem<ScriptingSystem>();
+
+	//enemies split between the level and a streamed in chunk
+	const std::string chunkScene{ "Chunk Scene" };
+	m_ecs.AddScene(chunkScene, SceneData{});
+	{
+		ecs::RegistrationBatchScope registrationBatch(m_ecs);
+		for (int i = 0; i < numEnemies; ++i) {
+			EntityID id = m_ecs.CreateEntity(i % 2 ? chunkScene : sceneName);
+			m_ecs.AddComponent<ChaseScript>(id);
+			scriptingSystem->RegisterSystem(id);
+		}
+	}
+
+	//the previous dispatch, a copy of the script list and of the entity's SceneData per entity
+	double copiedMs = TimeMs([&]() {
+		for (int frame = 0; frame < BENCHMARK_ITERATIONS; ++frame) {
+			auto scriptList = m_scriptManager.GetScriptList();
+			for (const std::string& scriptName : scriptList) {
+				auto action = m_ecs.componentAction.at(scriptName);
+				ISparseSet* scriptPool = m_ecs.GetComponentPool(scriptName);
+				for (const EntityID id : scriptPool->GetEntityList()) {
+					if (!scriptingSystem->HasEntity(id)) continue;
+					SceneData sceneData = m_ecs.GetSceneData(m_ecs.GetSceneByEntityID(id));
+					if (!sceneData.isActive) continue;
+					static_cast<ScriptClass*>(scriptPool->GetBase(id))->Update();
+				}
+			}
+		}
+	});
+
+	double dispatchMs = TimeMs([&]() {
+		for (int frame = 0; frame < BENCHMARK_ITERATIONS; ++frame) scriptingSystem->Update();
+	});
+
+	const auto& scripts = m_ecs.GetComponentsEnties(ChaseScript::classname());
+	ASSERT_EQ(scripts.size(), static_cast<size_t>(numEnemies));
+	EXPECT_FLOAT_EQ(m_ecs.GetComponent<ChaseScript>(scripts.front())->position.x, m_ecs.GetComponent<ChaseScript>(scripts.back())->position.x);
+	std::cout << "[ BENCHMARK] dispatch " << numEnemies << " scripts across 2 scenes, " << BENCHMARK_ITERATIONS << " frames\n"
+		<< "             SceneData copy per entity : " << copiedMs << " ms\n"
+		<< "             active scene bits         : " << dispatchMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkEnemyScriptsSerialVsJob) {
+	constexpr int numEnemies = 5000;
+
+	m_ecs.RegisterComponent<SteeringScript>();
+	m_ecs.RegisterComponent<SteeringJobScript>();
+	m_scriptManager.RegisterScript(SteeringScript::classname());
+	m_scriptManager.RegisterScript(SteeringJobScript::classname());
+	auto scriptingSystem = MakeSystem<ScriptingSystem>();
+
+	const std::string serialScene{ "Serial Scene" };
+	const std::string jobScene{ "Job Scene" };
+	m_ecs.AddScene(serialScene, SceneData{});
+	m_ecs.AddScene(jobScene, SceneData{});
+	m_ecs.GetSceneData(sceneName).isActive = false;
+	{
+		ecs::RegistrationBatchScope registrationBatch(m_ecs);
+		for (int i = 0; i < numEnemies; ++i) {
+			EntityID serial = m_ecs.CreateEntity(serialScene);
+			m_ecs.AddComponent<SteeringScript>(serial);
+			scriptingSystem->RegisterSystem(serial);
+
+			EntityID job = m_ecs.CreateEntity(jobScene);
+			m_ecs.AddComponent<SteeringJobScript>(job);
+			scriptingSystem->RegisterSystem(job);
+		}
+	}
+
+	m_ecs.GetSceneData(jobScene).isActive = false;
+	double serialMs = TimeMs([&]() {
+		for (int frame = 0; frame < BENCHMARK_ITERATIONS; ++frame) scriptingSystem->Update();
+	});
+
+	m_ecs.GetSceneData(serialScene).isActive = false;
+	m_ecs.GetSceneData(jobScene).isActive = true;
+	double jobMs = TimeMs([&]() {
+		for (int frame = 0; frame < BENCHMARK_ITERATIONS; ++frame) scriptingSystem->Update();
+	});
+
+	//same steering either way
+	const auto& serialScripts = m_ecs.GetComponentsEnties(SteeringScript::classname());
+	const auto& jobScripts = m_ecs.GetComponentsEnties(SteeringJobScript::classname());
+	EXPECT_EQ(m_ecs.GetComponent<SteeringScript>(serialScripts.back())->position, m_ecs.GetComponent<SteeringJobScript>(jobScripts.back())->position);
+	std::cout << "[ BENCHMARK] " << numEnemies << " enemy scripts, " << BENCHMARK_ITERATIONS << " frames, " << m_ecs.GetJobSystem().GetWorkerCount() << " workers\n"
+		<< "             main thread : " << serialMs << " ms\n"
+		<< "             job script  : " << jobMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkLineOfSightImmediateVsBatched) {
+	constexpr int numEnemies = 2000;
+
+	m_physicsManager.Init();
+	PxPhysics* physics = m_physicsManager.GetPhysics();
+	std::mt19937 rng(5);
+	std::uniform_real_distribution<float> position(-40.f, 40.f);
+	for (int i = 0; i < 200; ++i) {
+		PxShape* shape = physics->createShape(PxBoxGeometry{ 1.f, 2.f, 1.f }, *m_physicsManager.GetDefaultMaterial(), true);
+		PxRigidStatic* actor = physics->createRigidStatic(PxTransform{ PxVec3{ position(rng), 0.f, position(rng) } });
+		actor->attachShape(*shape);
+		shape->release();
+		actor->userData = reinterpret_cast<void*>(static_cast<uintptr_t>(i + 1));
+		m_physicsManager.GetScene()->addActor(*actor);
+	}
+
+	std::vector<glm::vec3> enemies;
+	for (int i = 0; i < numEnemies; ++i) enemies.emplace_back(position(rng), 0.f, position(rng));
+	const glm::vec3 player{ 0.f };
+
+	//every enemy checks if it can see the player
+	int immediateBlocked{};
+	double immediateMs = TimeMs([&]() {
+		for (int frame = 0; frame < 10; ++frame) {
+			for (const glm::vec3& enemy : enemies) {
+				RaycastHit hit{};
+				if (m_physicsManager.Raycast(enemy, player - enemy, glm::length(player - enemy), hit, nullptr)) ++immediateBlocked;
+			}
+		}
+	});
+
+	int batchedBlocked{};
+	std::vector<physics::QueryHandle> handles(numEnemies);
+	physics::SceneQueries& queries = m_physicsManager.GetSceneQueries();
+	double batchedMs = TimeMs([&]() {
+		for (int frame = 0; frame < 10; ++frame) {
+			for (int i = 0; i < numEnemies; ++i) {
+				handles[i] = queries.Raycast(enemies[i], player - enemies[i], glm::length(player - enemies[i]));
+			}
+			m_physicsManager.ExecuteSceneQueries(&m_ecs.GetJobSystem());
+			for (const auto& handle : handles) {
+				if (queries.GetResult(handle)->hasHit) ++batchedBlocked;
+			}
+		}
+	});
+
+	m_physicsManager.Shutdown();
+	EXPECT_EQ(immediateBlocked, batchedBlocked);
+	std::cout << "[ BENCHMARK] line of sight for " << numEnemies << " enemies, 10 frames\n"
+		<< "             immediate raycasts : " << immediateMs << " ms\n"
+		<< "             batched queries    : " << batchedMs << " ms\n";
+}
+
+TEST_F(ECSFixture, BenchmarkPhysicsSyncFullVsDiffed) {
+	constexpr int numProps = 500;
+	constexpr int numFalling = 20;
+	constexpr int numFrames = 100;
+
+	m_physicsManager.Init();
+	auto physicsSystem = MakeSystem<PhysicsSystem>();
+	const float fixedStep = m_physicsManager.FixedDeltaTime();
+	//sets the delta time the physics system steps with
+	m_ecs.Update(fixedStep);
+
+	//resting props without gravity and a few bodies falling between them
+	std::vector<EntityID> ids;
+	for (int i = 0; i < numProps + numFalling; ++i) {
+		const glm::vec3 position{ static_cast<float>(i % 25) * 2.f, i < numProps ? 0.f : 20.f, static_cast<float>(i / 25) * 2.f };
+		EntityID id = m_ecs.CreateEntity(sceneName);
+		TransformSystem::SetImmediateWorldPosition(m_ecs, m_ecs.GetComponent<TransformComponent>(id), glm::vec3{ position });
+
+		PxRigidDynamic* actor = m_physicsManager.GetPhysics()->createRigidDynamic(PxTransform{ PxVec3{ position.x, position.y, position.z } });
+		PxRigidActorExt::createExclusiveShape(*actor, PxSphereGeometry{ 0.5f }, *m_physicsManager.GetDefaultMaterial());
+		actor->setActorFlag(PxActorFlag::eDISABLE_GRAVITY, i < numProps);
+		actor->userData = reinterpret_cast<void*>(static_cast<uintptr_t>(id));
+		m_physicsManager.GetScene()->addActor(*actor);
+
+		m_ecs.AddComponent<RigidbodyComponent>(id)->actor = actor;
+		physicsSystem->RegisterSystem(id);
+		ids.push_back(id);
+	}
+
+	//what the system did before, every pose pushed and every pose pulled back
+	double fullMs = TimeMs([&]() {
+		for (int frame = 0; frame < numFrames; ++frame) {
+			for (EntityID id : ids) {
+				auto* trans = m_ecs.GetComponent<TransformComponent>(id);
+				PxRigidDynamic* actor = static_cast<PxRigidDynamic*>(m_ecs.GetComponent<RigidbodyComponent>(id)->actor);
+				glm::vec3 pos = trans->WorldTransformation.position;
+				glm::quat rot = glm::quat(glm::radians(trans->WorldTransformation.rotation));
+				actor->setGlobalPose(PxTransform{ PxVec3{ pos.x, pos.y, pos.z }, PxQuat{ rot.x, rot.y, rot.z, rot.w } });
+			}
+			m_physicsManager.Update(fixedStep);
+			for (EntityID id : ids) {
+				auto* trans = m_ecs.GetComponent<TransformComponent>(id);
+				PxTransform pxTrans = static_cast<PxRigidDynamic*>(m_ecs.GetComponent<RigidbodyComponent>(id)->actor)->getGlobalPose();
+				TransformSystem::SetImmediateWorldPosition(m_ecs, trans, glm::vec3{ pxTrans.p.x, pxTrans.p.y, pxTrans.p.z });
+				glm::quat q{ pxTrans.q.w, pxTrans.q.x, pxTrans.q.y, pxTrans.q.z };
+				TransformSystem::SetImmediateWorldRotation(m_ecs, trans, glm::degrees(glm::eulerAngles(q)));
+			}
+		}
+	});
+	auto countSleeping = [&]() {
+		int sleeping{};
+		for (EntityID id : ids) {
+			if (static_cast<PxRigidDynamic*>(m_ecs.GetComponent<RigidbodyComponent>(id)->actor)->isSleeping()) ++sleeping;
+		}
+		return sleeping;
+	};
+	const int fullSleeping = countSleeping();
+
+	size_t pushed{};
+	size_t readback{};
+	double diffedMs = TimeMs([&]() {
+		for (int frame = 0; frame < numFrames; ++frame) {
+			physicsSystem->Update();
+			pushed += physicsSystem->GetPushedCount();
+			readback += physicsSystem->GetReadbackCount();
+		}
+	});
+	const int diffedSleeping = countSleeping();
+
+	//the props stay where they were placed either way
+	for (int i = 0; i < numProps; ++i) {
+		EXPECT_FLOAT_EQ(m_ecs.GetComponent<TransformComponent>(ids[i])->WorldTransformation.position.y, 0.f);
+	}
+	EXPECT_EQ(diffedSleeping, numProps);
+
+	m_physicsManager.Shutdown();
+	std::cout << "[ BENCHMARK] physics transform sync, " << numProps << " resting and " << numFalling << " falling bodies, " << numFrames << " frames\n"
+		<< "             push and pull every body : " << fullMs << " ms, " << fullSleeping << " asleep\n"
+		<< "             diffed and active actors : " << diffedMs << " ms, " << diffedSleeping << " asleep, "
+		<< pushed << " pushed, " << readback << " read back\n";
+}
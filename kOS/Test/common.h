@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "ECS/Component/ComponentHeader.h"
 #include "Config/pch.h"
 #include "DeSerialization/json_handler.h"
+#include "DeSerialization/BinarySerializationReflection.h"
 
 #define SERIALIZE_DESERIALIZE_COMPARE_TEST(ComponentType) \
 TEST(DeSerializeTest, ComponentType##Test) { \
@@ -28,6 +29,21 @@ TEST(DeSerializeTest, ComponentType##Test) { \
     EXPECT_NO_THROW(comp.ApplyFunctionPairwise(comparer, comp2)); \
 }
 
+#define BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(ComponentType) \
+TEST(BinaryDeSerializeTest, ComponentType##Test) { \
+    ComponentType comp; \
+    comp.ApplyFunction(RandomizeComponents<decltype(comp.Names())>{comp.Names()}); \
+    serialization::BinaryWriter writer; \
+    SaveComponentBinaryReflect(&comp, writer); \
+    ComponentType comp2; \
+    serialization::BinaryReader reader(writer.Buffer().data(), writer.Size()); \
+    LoadComponentBinaryReflect(&comp2, reader); \
+    EXPECT_FALSE(reader.Failed()); \
+    EXPECT_TRUE(reader.AtEnd()); \
+    CompareComponents<ComponentType> comparer; \
+    EXPECT_NO_THROW(comp.ApplyFunctionPairwise(comparer, comp2)); \
+}
+
 template <typename T>
 struct RandomizeComponents{
 
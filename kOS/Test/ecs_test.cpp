@@ -0,0 +1,639 @@
+/******************************************************************/
+/*!
+\file      ecs_test.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains test cases for the ECS update loop,
+		   entity lifetime and scene bookkeeping.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "ECSFixture.h"
+
+using namespace ecs;
+
+namespace {
+	int s_countingSystemUpdates{};
+
+	class CountingSystem : public ISystem {
+	public:
+		using ISystem::ISystem;
+		void Init() override {}
+		void Update() override { ++s_countingSystemUpdates; }
+
+		REFLECTABLE(CountingSystem)
+	};
+
+	std::mutex s_orderMutex;
+	std::vector<std::string> s_updateOrder;
+
+	void RecordUpdate(const std::string& system) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		std::lock_guard<std::mutex> lock(s_orderMutex);
+		s_updateOrder.push_back(system);
+	}
+
+	class AWorkerWriterSystem : public ISystem {
+	public:
+		using ISystem::ISystem;
+		using ReadComponents = ComponentList<>;
+		using WriteComponents = ComponentList<TransformComponent>;
+		static constexpr bool runOnWorker = true;
+		void Init() override {}
+		void Update() override { RecordUpdate(classname()); }
+
+		REFLECTABLE(AWorkerWriterSystem)
+	};
+
+	class BWorkerReaderSystem : public ISystem {
+	public:
+		using ISystem::ISystem;
+		using ReadComponents = ComponentList<TransformComponent>;
+		using WriteComponents = ComponentList<>;
+		static constexpr bool runOnWorker = true;
+		void Init() override {}
+		void Update() override { RecordUpdate(classname()); }
+
+		REFLECTABLE(BWorkerReaderSystem)
+	};
+
+	int s_registerCount{};
+	int s_deregisterCount{};
+
+	class MembershipSystem : public ISystem {
+	public:
+		template <typename... Args>
+		MembershipSystem(Args&&... args) : ISystem(std::forward<Args>(args)...) {
+			onRegister.Add([](EntityID) { ++s_registerCount; });
+			onDeregister.Add([](EntityID) { ++s_deregisterCount; });
+		}
+		void Init() override {}
+		void Update() override {}
+
+		REFLECTABLE(MembershipSystem)
+	};
+
+	class CountingScript : public Component, public ScriptClass {
+	public:
+		int starts{};
+		int updates{};
+		std::string calls;
+		void Start() override { ++starts; }
+		void FixedUpdate() override { calls += 'F'; }
+		void Update() override { ++updates; calls += 'U'; }
+		void LateUpdate() override { calls += 'L'; }
+
+		REFLECTABLE(CountingScript, starts, updates)
+	};
+
+	int s_preparedJobs{};
+
+	class CountingJobScript : public Component, public ScriptClass {
+	public:
+		int starts{};
+		int updates{};
+		void Start() override { ++starts; }
+		void Update() override { ++updates; }
+		bool IsJob() const override { return true; }
+		void PrepareJob() override { ++s_preparedJobs; }
+
+		REFLECTABLE(CountingJobScript, starts, updates)
+	};
+
+	int s_updatesBeforeLateUpdate{ -1 };
+
+	//ordered before CountingSystem
+	class ALateUpdateSystem : public ISystem {
+	public:
+		using ISystem::ISystem;
+		void Init() override {}
+		void Update() override {}
+		void LateUpdate() override { s_updatesBeforeLateUpdate = s_countingSystemUpdates; }
+
+		REFLECTABLE(ALateUpdateSystem)
+	};
+}
+
+TEST_F(ECSFixture, SystemsRunOncePerFrameWithMultipleActiveScenes) {
+	m_ecs.RegisterSystem<CountingSystem, TransformComponent>();
+
+	const std::vector<std::string> scenes{ sceneName, "UI Overlay", "Streaming Chunk" };
+	for (const auto& scene : scenes) {
+		if (scene != sceneName) m_ecs.AddScene(scene, SceneData{});
+
+		EntityID id = m_ecs.CreateEntity(scene);
+		m_ecs.AddComponent<LightComponent>(id)->lightType = LightComponent::LightType::DIRECTIONAL;
+	}
+
+	s_countingSystemUpdates = 0;
+	m_ecs.Update(1.f / 60.f);
+
+	EXPECT_EQ(s_countingSystemUpdates, 1);
+	EXPECT_EQ(m_graphicsManager.lightRenderer.directionLightsToDraw.size(), scenes.size());
+}
+
+TEST_F(ECSFixture, SystemsDoNotRunWithoutActiveScene) {
+	m_ecs.RegisterSystem<CountingSystem, TransformComponent>();
+	m_ecs.CreateEntity(sceneName);
+	m_sceneManager.SetSceneActive(sceneName, false);
+
+	s_countingSystemUpdates = 0;
+	m_ecs.Update(1.f / 60.f);
+
+	EXPECT_EQ(s_countingSystemUpdates, 0);
+}
+
+TEST_F(ECSFixture, ConflictingSystemsRunInRegistrationOrder) {
+	m_ecs.RegisterSystem<AWorkerWriterSystem, TransformComponent>();
+	m_ecs.RegisterSystem<BWorkerReaderSystem, TransformComponent>();
+	m_ecs.CreateEntity(sceneName);
+
+	for (int frame = 0; frame < 10; ++frame) {
+		s_updateOrder.clear();
+		m_ecs.Update(1.f / 60.f);
+
+		ASSERT_EQ(s_updateOrder.size(), 2u);
+		EXPECT_EQ(s_updateOrder[0], AWorkerWriterSystem::classname());
+		EXPECT_EQ(s_updateOrder[1], BWorkerReaderSystem::classname());
+	}
+
+	//both systems are on the critical path since the reader waits for the writer
+	const auto& durations = m_peformance.GetSystemPerformance();
+	EXPECT_GE(m_peformance.GetCriticalPath(),
+		durations.at(AWorkerWriterSystem::classname()) + durations.at(BWorkerReaderSystem::classname()));
+	EXPECT_TRUE(m_peformance.GetSystemWorker().contains(AWorkerWriterSystem::classname()));
+}
+
+TEST_F(ECSFixture, TransformOnlyRebuildsChangedHierarchy) {
+	auto transformSystem = MakeSystem<TransformSystem>();
+
+	EntityID parent = m_ecs.CreateEntity(sceneName);
+	EntityID child = m_ecs.CreateEntity(sceneName);
+	EntityID staticProp = m_ecs.CreateEntity(sceneName);
+	m_ecs.SetParent(parent, child);
+	for (EntityID id : { parent, child, staticProp }) transformSystem->RegisterSystem(id);
+
+	m_ecs.GetComponent<TransformComponent>(child)->LocalTransformation.position = { 0.f, 1.f, 0.f };
+	transformSystem->Update();
+	EXPECT_EQ(transformSystem->GetUpdatedCount(), 3u);
+
+	//nothing changed
+	transformSystem->Update();
+	EXPECT_EQ(transformSystem->GetUpdatedCount(), 0u);
+
+	//moving the parent rebuilds the parent and its child only
+	m_ecs.GetComponent<TransformComponent>(parent)->LocalTransformation.position = { 5.f, 0.f, 0.f };
+	transformSystem->Update();
+	EXPECT_EQ(transformSystem->GetUpdatedCount(), 2u);
+
+	const auto& childWorld = m_ecs.GetComponent<TransformComponent>(child)->WorldTransformation.position;
+	EXPECT_FLOAT_EQ(childWorld.x, 5.f);
+	EXPECT_FLOAT_EQ(childWorld.y, 1.f);
+
+	//reparenting forces a full rebuild
+	m_ecs.RemoveParent(child);
+	transformSystem->Update();
+	EXPECT_EQ(transformSystem->GetUpdatedCount(), 3u);
+	EXPECT_FLOAT_EQ(m_ecs.GetComponent<TransformComponent>(child)->WorldTransformation.position.x, 0.f);
+}
+
+TEST_F(ECSFixture, StaleHandleIsDetectedAfterIdReuse) {
+	//use up the fresh ids so deleted ids get recycled
+	std::vector<EntityID> ids;
+	for (int i = 0; i < MaxEntity; ++i) ids.push_back(m_ecs.CreateEntity(sceneName));
+
+	EntityID victim = ids[10];
+	EntityHandle handle = m_ecs.GetHandle(victim);
+	EXPECT_TRUE(m_ecs.IsValid(handle));
+
+	m_ecs.DeleteEntity(victim);
+	m_ecs.EndFrame();
+	EXPECT_FALSE(m_ecs.IsValid(handle));
+	EXPECT_EQ(m_ecs.Resolve(handle), -1);
+
+	EntityID reused = m_ecs.CreateEntity(sceneName);
+	ASSERT_EQ(reused, victim);
+	EXPECT_FALSE(m_ecs.IsValid(handle));
+	EXPECT_TRUE(m_ecs.IsValid(m_ecs.GetHandle(reused)));
+	EXPECT_NE(m_ecs.GetHandle(reused), handle);
+}
+
+TEST_F(ECSFixture, SceneLookupStaysCorrectAfterBulkDelete) {
+	const std::string otherScene{ "Other Scene" };
+	m_ecs.AddScene(otherScene, SceneData{});
+
+	std::vector<EntityID> ids;
+	for (int i = 0; i < 500; ++i) ids.push_back(m_ecs.CreateEntity(i % 2 ? otherScene : sceneName));
+
+	for (size_t i = 0; i < ids.size(); i += 3) m_ecs.DeleteEntity(ids[i]);
+	m_ecs.EndFrame();
+
+	for (size_t i = 0; i < ids.size(); ++i) {
+		if (i % 3 == 0) {
+			EXPECT_TRUE(m_ecs.GetSceneByEntityID(ids[i]).empty());
+		}
+		else {
+			EXPECT_EQ(m_ecs.GetSceneByEntityID(ids[i]), i % 2 ? otherScene : sceneName);
+		}
+	}
+
+	//sceneIDs edited outside the ECS (hierarchy reordering) is still found
+	auto& sceneIDs = m_ecs.sceneMap.at(sceneName).sceneIDs;
+	std::reverse(sceneIDs.begin(), sceneIDs.end());
+	EXPECT_EQ(m_ecs.GetSceneByEntityID(ids[2]), sceneName);
+	m_ecs.DeleteEntity(ids[2]);
+	m_ecs.EndFrame();
+	EXPECT_EQ(std::count(sceneIDs.begin(), sceneIDs.end(), ids[2]), 0);
+}
+
+TEST_F(ECSFixture, CommandBufferAppliesStructuralChangesAtEndFrame) {
+	s_registerCount = 0;
+	s_deregisterCount = 0;
+	m_ecs.RegisterSystem<MembershipSystem, TransformComponent, MeshFilterComponent>();
+
+	auto& commandBuffer = m_ecs.GetCommandBuffer();
+	EntityID id = commandBuffer.CreateEntity(sceneName);
+	commandBuffer.AddComponent<MeshFilterComponent>(id);
+	commandBuffer.AddComponent<MaterialComponent>(id);
+	EXPECT_FALSE(m_ecs.IsValidEntity(id));
+
+	m_ecs.EndFrame();
+	ASSERT_TRUE(m_ecs.IsValidEntity(id));
+	EXPECT_TRUE(m_ecs.HasComponent<MaterialComponent>(id));
+	EXPECT_EQ(s_registerCount, 1);
+	EXPECT_TRUE(commandBuffer.Empty());
+
+	//removing a component the system does not need keeps the entity registered
+	m_ecs.RemoveComponent<MaterialComponent>(id);
+	EXPECT_EQ(s_registerCount, 1);
+	EXPECT_EQ(s_deregisterCount, 0);
+
+	commandBuffer.RemoveComponent<MeshFilterComponent>(id);
+	EXPECT_EQ(s_deregisterCount, 0);
+	m_ecs.EndFrame();
+	EXPECT_EQ(s_deregisterCount, 1);
+
+	//created and deleted in the same flush never joins the system
+	EntityID temporary = commandBuffer.CreateEntity(sceneName);
+	commandBuffer.AddComponent<MeshFilterComponent>(temporary);
+	commandBuffer.DeleteEntity(temporary);
+	m_ecs.EndFrame();
+	EXPECT_FALSE(m_ecs.IsValidEntity(temporary));
+	EXPECT_EQ(s_registerCount, 1);
+}
+
+TEST_F(ECSFixture, BinarySceneMatchesTheJsonItWasCompiledFrom) {
+	const std::filesystem::path jsonPath = std::filesystem::temp_directory_path() / "kos_binary_scene_test.json";
+	const std::string savedScene = jsonPath.filename().string();
+	m_ecs.AddScene(savedScene, SceneData{});
+	m_ecs.GetSceneData(savedScene).ambientIntensity = 0.25f;
+
+	EntityID parent = m_ecs.CreateEntity(savedScene);
+	EntityID child = m_ecs.CreateEntity(savedScene);
+	m_ecs.GetComponent<NameComponent>(child)->entityName = "child";
+	m_ecs.GetComponent<TransformComponent>(child)->LocalTransformation.position = glm::vec3(1.f, 2.f, 3.f);
+	m_ecs.AddComponent<LightComponent>(child)->intesnity = 4.f;
+	m_ecs.SetParent(parent, child);
+
+	//saving writes the JSON and the binary compiled from it
+	m_serialization.SaveScene(jsonPath);
+	ASSERT_TRUE(serialization::Serialization::IsBinarySceneCurrent(jsonPath));
+
+	const std::string loadedScene{ "Loaded Scene" };
+	ASSERT_TRUE(m_serialization.LoadSceneBinary(serialization::Serialization::GetBinaryScenePath(jsonPath), loadedScene));
+	EXPECT_FLOAT_EQ(m_ecs.GetSceneData(loadedScene).ambientIntensity, 0.25f);
+
+	const std::vector<EntityID>& loaded = m_ecs.GetSceneData(loadedScene).sceneIDs;
+	ASSERT_EQ(loaded.size(), 2u);
+	EntityID loadedParent = loaded[0];
+	EntityID loadedChild = loaded[1];
+	EXPECT_EQ(m_ecs.GetParent(loadedChild), std::optional<EntityID>(loadedParent));
+	EXPECT_EQ(m_ecs.GetComponent<NameComponent>(loadedChild)->entityName, "child");
+	EXPECT_EQ(m_ecs.GetComponent<NameComponent>(loadedChild)->entityGUID, m_ecs.GetComponent<NameComponent>(child)->entityGUID);
+	EXPECT_EQ(m_ecs.GetComponent<TransformComponent>(loadedChild)->LocalTransformation.position, glm::vec3(1.f, 2.f, 3.f));
+	ASSERT_TRUE(m_ecs.HasComponent<LightComponent>(loadedChild));
+	EXPECT_FLOAT_EQ(m_ecs.GetComponent<LightComponent>(loadedChild)->intesnity, 4.f);
+	EXPECT_FALSE(m_ecs.HasComponent<LightComponent>(loadedParent));
+
+	//editing the JSON makes the binary stale
+	{
+		std::ofstream touch(jsonPath, std::ios::app);
+		touch << ' ';
+	}
+	EXPECT_FALSE(serialization::Serialization::IsBinarySceneCurrent(jsonPath));
+
+	std::filesystem::remove(jsonPath);
+	std::filesystem::remove(serialization::Serialization::GetBinaryScenePath(jsonPath));
+}
+
+TEST_F(ECSFixture, StreamedSceneActivatesOnlyWhenEveryEntityExists) {
+	constexpr int numEntities = 20;
+	const std::filesystem::path jsonPath = std::filesystem::temp_directory_path() / "kos_streaming_test.json";
+	const std::string savedScene = jsonPath.filename().string();
+	const utility::GUID meshGUID = utility::GenerateGUID();
+
+	m_ecs.AddScene(savedScene, SceneData{});
+	EntityID parent{};
+	for (int i = 0; i < numEntities; ++i) {
+		EntityID id = m_ecs.CreateEntity(savedScene);
+		m_ecs.AddComponent<MeshFilterComponent>(id)->meshGUID = meshGUID;
+		if (i % 2 == 1) m_ecs.SetParent(parent, id);
+		parent = id;
+	}
+	m_serialization.SaveScene(jsonPath);
+	m_sceneManager.ImmediateClearScene(savedScene);
+	m_ecs.EndFrame();
+
+	m_ecs.RegisterSystem<MembershipSystem, TransformComponent, MeshFilterComponent>();
+	s_registerCount = 0;
+
+	const std::string streamedScene{ "Streamed Scene" };
+	std::vector<utility::GUID> discovered;
+	int loadedCount{};
+	float lastProgress{};
+	m_sceneManager.onSceneResourcesDiscovered.Add([&](const std::string&, const std::vector<utility::GUID>& resources) { discovered = resources; });
+	m_sceneManager.onSceneLoaded.Add([&](const SceneData&) { ++loadedCount; });
+	m_sceneManager.onSceneLoadProgress.Add([&](const std::string&, float progress) { lastProgress = progress; });
+
+	//no budget, one entity per frame
+	m_sceneManager.SetStreamingBudget(0.f);
+	m_sceneManager.LoadSceneAsync(jsonPath, streamedScene);
+	EXPECT_TRUE(m_sceneManager.IsSceneLoading(streamedScene));
+
+	int frames{};
+	while (m_sceneManager.IsSceneLoading(streamedScene) && frames < 10000) {
+		m_sceneManager.EndFrame();
+		++frames;
+		if (m_ecs.sceneMap.find(streamedScene) == m_ecs.sceneMap.end()) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
+		}
+		if (m_sceneManager.IsSceneLoading(streamedScene)) {
+			EXPECT_FALSE(m_ecs.GetSceneData(streamedScene).isActive);
+			EXPECT_EQ(s_registerCount, 0);
+			EXPECT_EQ(loadedCount, 0);
+		}
+	}
+
+	ASSERT_FALSE(m_sceneManager.IsSceneLoading(streamedScene));
+	EXPECT_TRUE(m_ecs.GetSceneData(streamedScene).isActive);
+	EXPECT_EQ(m_ecs.GetSceneData(streamedScene).sceneIDs.size(), static_cast<size_t>(numEntities));
+	EXPECT_EQ(s_registerCount, numEntities);
+	EXPECT_EQ(loadedCount, 1);
+	EXPECT_FLOAT_EQ(lastProgress, 1.f);
+	ASSERT_EQ(discovered.size(), 1u);
+	EXPECT_EQ(discovered.front(), meshGUID);
+
+	const EntityID child = m_ecs.GetSceneData(streamedScene).sceneIDs[1];
+	EXPECT_TRUE(m_ecs.GetParent(child).has_value());
+
+	std::filesystem::remove(jsonPath);
+	std::filesystem::remove(serialization::Serialization::GetBinaryScenePath(jsonPath));
+}
+
+TEST_F(ECSFixture, CancelledStreamedSceneLeavesNothingBehind) {
+	const std::filesystem::path jsonPath = std::filesystem::temp_directory_path() / "kos_streaming_cancel_test.json";
+	const std::string savedScene = jsonPath.filename().string();
+	m_ecs.AddScene(savedScene, SceneData{});
+	for (int i = 0; i < 10; ++i) m_ecs.AddComponent<MeshFilterComponent>(m_ecs.CreateEntity(savedScene));
+	m_serialization.SaveScene(jsonPath);
+	m_sceneManager.ImmediateClearScene(savedScene);
+	m_ecs.EndFrame();
+
+	m_ecs.RegisterSystem<MembershipSystem, TransformComponent, MeshFilterComponent>();
+	s_registerCount = 0;
+
+	const std::string streamedScene{ "Cancelled Scene" };
+	int cancelledCount{};
+	m_sceneManager.onSceneLoadCancelled.Add([&](const std::string&) { ++cancelledCount; });
+
+	m_sceneManager.SetStreamingBudget(0.f);
+	m_sceneManager.LoadSceneAsync(jsonPath, streamedScene);
+	auto createdCount = [&]() {
+		const auto sceneIt = m_ecs.sceneMap.find(streamedScene);
+		return sceneIt == m_ecs.sceneMap.end() ? size_t{} : sceneIt->second.sceneIDs.size();
+	};
+	//wait for the first entities to exist
+	for (int frames = 0; frames < 10000 && createdCount() < 3; ++frames) {
+		m_sceneManager.EndFrame();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	ASSERT_TRUE(m_sceneManager.IsSceneLoading(streamedScene));
+
+	m_sceneManager.CancelSceneLoad(streamedScene);
+	m_ecs.EndFrame();
+	m_sceneManager.EndFrame();
+
+	EXPECT_FALSE(m_sceneManager.IsSceneLoading(streamedScene));
+	EXPECT_EQ(m_ecs.sceneMap.find(streamedScene), m_ecs.sceneMap.end());
+	EXPECT_EQ(cancelledCount, 1);
+	EXPECT_EQ(s_registerCount, 0);
+	EXPECT_TRUE(m_ecs.GetComponentsEnties(MeshFilterComponent::classname()).empty());
+
+	std::filesystem::remove(jsonPath);
+	std::filesystem::remove(serialization::Serialization::GetBinaryScenePath(jsonPath));
+}
+
+TEST_F(ECSFixture, StoppingPlayRestoresTheSnapshotTakenAtPlay) {
+	m_ecs.RegisterSystem<MembershipSystem, TransformComponent, MeshFilterComponent>();
+
+	EntityID parent = m_ecs.CreateEntity(sceneName);
+	EntityID child = m_ecs.CreateEntity(sceneName);
+	m_ecs.SetParent(parent, child);
+	m_ecs.AddComponent<MeshFilterComponent>(child);
+	m_ecs.GetComponent<TransformComponent>(child)->LocalTransformation.position = glm::vec3(1.f, 2.f, 3.f);
+	m_ecs.GetComponent<NameComponent>(child)->entityName = "child";
+	const utility::GUID childGUID = m_ecs.GetComponent<NameComponent>(child)->entityGUID;
+	const EntityHandle childHandle = m_ecs.GetHandle(child);
+
+	m_sceneManager.CacheCurrentScene();
+
+	//play edits everything the snapshot covers
+	m_ecs.GetComponent<TransformComponent>(child)->LocalTransformation.position = glm::vec3(9.f);
+	m_ecs.GetComponent<NameComponent>(child)->entityName = "moved";
+	m_ecs.RemoveComponent<MeshFilterComponent>(child);
+	EntityID spawned = m_ecs.CreateEntity(sceneName);
+	m_ecs.AddComponent<MeshFilterComponent>(spawned);
+	const EntityHandle spawnedHandle = m_ecs.GetHandle(spawned);
+	m_ecs.DeleteEntity(parent);
+	m_ecs.EndFrame();
+
+	s_registerCount = 0;
+	m_sceneManager.ReloadScene();
+
+	ASSERT_TRUE(m_ecs.IsValidEntity(parent));
+	ASSERT_TRUE(m_ecs.IsValidEntity(child));
+	EXPECT_FALSE(m_ecs.IsValid(spawnedHandle));
+	EXPECT_TRUE(m_ecs.IsValid(childHandle));
+	EXPECT_EQ(m_ecs.GetParent(child), parent);
+	EXPECT_EQ(m_ecs.GetComponent<TransformComponent>(child)->LocalTransformation.position, glm::vec3(1.f, 2.f, 3.f));
+	EXPECT_EQ(m_ecs.GetComponent<NameComponent>(child)->entityName, "child");
+	EXPECT_EQ(m_ecs.GetEntityIDFromGUID(childGUID), child);
+	EXPECT_EQ(m_ecs.GetSceneByEntityID(child), sceneName);
+	EXPECT_TRUE(m_ecs.HasComponent<MeshFilterComponent>(child));
+	EXPECT_FALSE(m_ecs.HasComponent<MeshFilterComponent>(spawned));
+	EXPECT_EQ(s_registerCount, 1);
+}
+
+TEST_F(ECSFixture, PrefabInstancesAreCopiedFromTheTemplateAndPooled) {
+	const std::filesystem::path prefabPath = std::filesystem::temp_directory_path() / "kos_prefab_test.prefab";
+	const std::string prefabScene = prefabPath.filename().string();
+	m_ecs.AddScene(prefabScene, SceneData{});
+	EntityID prefabRoot = m_ecs.CreateEntity(prefabScene);
+	EntityID prefabChild = m_ecs.CreateEntity(prefabScene);
+	m_ecs.SetParent(prefabRoot, prefabChild);
+	m_ecs.AddComponent<MeshFilterComponent>(prefabChild);
+	m_ecs.GetComponent<TransformComponent>(prefabChild)->LocalTransformation.position = glm::vec3(1.f, 2.f, 3.f);
+	m_serialization.SaveScene(prefabPath);
+	m_sceneManager.ImmediateClearScene(prefabScene);
+	m_ecs.EndFrame();
+
+	EntityID first = m_sceneManager.InstantiatePrefab(prefabPath, sceneName);
+	ASSERT_GE(first, 0);
+	EXPECT_EQ(m_ecs.GetSceneByEntityID(first), sceneName);
+	EXPECT_FALSE(m_ecs.GetParent(first));
+	EXPECT_TRUE(m_ecs.sceneMap.at(prefabScene).isPrefab);
+
+	//the file is only read for the first instance
+	std::filesystem::remove(prefabPath);
+	std::filesystem::remove(serialization::Serialization::GetBinaryScenePath(prefabPath));
+	EntityID second = m_sceneManager.InstantiatePrefab(prefabPath, sceneName);
+	ASSERT_GE(second, 0);
+	EXPECT_NE(first, second);
+
+	m_ecs.RegisterSystem<MembershipSystem, TransformComponent, MeshFilterComponent>();
+	m_sceneManager.SetPrefabPoolCapacity(prefabPath, 1);
+	ASSERT_TRUE(m_ecs.GetChild(first));
+	EntityID firstChild = m_ecs.GetChild(first)->front();
+	m_ecs.GetComponent<TransformComponent>(firstChild)->LocalTransformation.position = glm::vec3(9.f);
+	m_ecs.RemoveComponent<MeshFilterComponent>(firstChild);
+
+	//released instances are hidden, not deleted, until the pool is full
+	m_sceneManager.ReleasePrefabInstance(first);
+	EXPECT_EQ(m_sceneManager.GetPooledInstanceCount(prefabPath), 1u);
+	EXPECT_TRUE(m_ecs.GetComponent<NameComponent>(first)->hide);
+	EXPECT_TRUE(m_ecs.GetComponent<NameComponent>(firstChild)->hide);
+	const EntityHandle secondHandle = m_ecs.GetHandle(second);
+	m_sceneManager.ReleasePrefabInstance(second);
+	m_ecs.EndFrame();
+	EXPECT_FALSE(m_ecs.IsValid(secondHandle));
+	EXPECT_EQ(m_sceneManager.GetPooledInstanceCount(prefabPath), 1u);
+
+	//reuse puts the template's components back
+	s_registerCount = 0;
+	EntityID reused = m_sceneManager.InstantiatePrefab(prefabPath, sceneName);
+	EXPECT_EQ(reused, first);
+	EXPECT_EQ(m_sceneManager.GetPooledInstanceCount(prefabPath), 0u);
+	EXPECT_FALSE(m_ecs.GetComponent<NameComponent>(reused)->hide);
+	EXPECT_FALSE(m_ecs.GetComponent<NameComponent>(firstChild)->hide);
+	EXPECT_EQ(m_ecs.GetComponent<TransformComponent>(firstChild)->LocalTransformation.position, glm::vec3(1.f, 2.f, 3.f));
+	EXPECT_TRUE(m_ecs.HasComponent<MeshFilterComponent>(firstChild));
+	EXPECT_EQ(s_registerCount, 1);
+}
+
+TEST_F(ECSFixture, ScriptsOnlyUpdateInActiveScenes) {
+	m_ecs.RegisterComponent<CountingScript>();
+	m_scriptManager.RegisterScript(CountingScript::classname());
+	auto scriptingSystem = MakeSystem<ScriptingSystem>();
+
+	const std::string pausedScene{ "Paused Scene" };
+	m_ecs.AddScene(pausedScene, SceneData{});
+	EntityID active = m_ecs.CreateEntity(sceneName);
+	EntityID paused = m_ecs.CreateEntity(pausedScene);
+	EntityID pooled = m_ecs.CreateEntity(sceneName);
+	for (EntityID id : { active, paused, pooled }) {
+		m_ecs.AddComponent<CountingScript>(id);
+		scriptingSystem->RegisterSystem(id);
+	}
+	m_ecs.GetSceneData(pausedScene).isActive = false;
+	scriptingSystem->DeregisterSystem(pooled);
+
+	scriptingSystem->Update();
+	scriptingSystem->Update();
+	EXPECT_EQ(m_ecs.GetComponent<CountingScript>(active)->starts, 1);
+	EXPECT_EQ(m_ecs.GetComponent<CountingScript>(active)->updates, 2);
+	EXPECT_EQ(m_ecs.GetComponent<CountingScript>(paused)->updates, 0);
+	EXPECT_EQ(m_ecs.GetComponent<CountingScript>(pooled)->updates, 0);
+	EXPECT_EQ(m_peformance.GetScriptPerformance().count(CountingScript::classname()), 1u);
+
+	//resumes without starting again
+	m_ecs.GetSceneData(pausedScene).isActive = true;
+	scriptingSystem->Update();
+	EXPECT_EQ(m_ecs.GetComponent<CountingScript>(paused)->starts, 1);
+	EXPECT_EQ(m_ecs.GetComponent<CountingScript>(paused)->updates, 1);
+	EXPECT_EQ(m_ecs.GetComponent<CountingScript>(active)->starts, 1);
+}
+
+TEST_F(ECSFixture, ScriptPhasesRunAroundTheFrame) {
+	m_ecs.RegisterComponent<CountingScript>();
+	m_scriptManager.RegisterScript(CountingScript::classname());
+	auto scriptingSystem = MakeSystem<ScriptingSystem>();
+	scriptingSystem->Init();
+
+	EntityID id = m_ecs.CreateEntity(sceneName);
+	m_ecs.AddComponent<CountingScript>(id);
+	scriptingSystem->RegisterSystem(id);
+
+	//a frame where physics took two fixed steps
+	m_physicsManager.onFixedUpdate.Invoke();
+	m_physicsManager.onFixedUpdate.Invoke();
+	scriptingSystem->Update();
+	scriptingSystem->LateUpdate();
+	//and one where it took none
+	scriptingSystem->Update();
+	scriptingSystem->LateUpdate();
+
+	const auto* script = m_ecs.GetComponent<CountingScript>(id);
+	EXPECT_EQ(script->starts, 1);
+	EXPECT_EQ(script->calls, "FFULUL");
+
+	//the system leaves the fixed step when it is destroyed
+	scriptingSystem.reset();
+	m_physicsManager.onFixedUpdate.Invoke();
+	EXPECT_EQ(m_ecs.GetComponent<CountingScript>(id)->calls, "FFULUL");
+}
+
+TEST_F(ECSFixture, LateUpdateRunsOnceEverySystemHasUpdated) {
+	m_ecs.RegisterSystem<ALateUpdateSystem, TransformComponent>();
+	m_ecs.RegisterSystem<CountingSystem, TransformComponent>();
+	m_ecs.CreateEntity(sceneName);
+
+	s_countingSystemUpdates = 0;
+	s_updatesBeforeLateUpdate = -1;
+	m_ecs.Update(1.f / 60.f);
+	EXPECT_EQ(s_updatesBeforeLateUpdate, 1);
+}
+
+TEST_F(ECSFixture, JobScriptsUpdateEveryInstanceOnce) {
+	constexpr int numScripts = 1000;
+	m_ecs.RegisterComponent<CountingJobScript>();
+	m_scriptManager.RegisterScript(CountingJobScript::classname());
+	auto scriptingSystem = MakeSystem<ScriptingSystem>();
+
+	const std::string pausedScene{ "Paused Scene" };
+	m_ecs.AddScene(pausedScene, SceneData{});
+	m_ecs.GetSceneData(pausedScene).isActive = false;
+	std::vector<EntityID> ids;
+	for (int i = 0; i < numScripts; ++i) {
+		EntityID id = m_ecs.CreateEntity(i % 10 ? sceneName : pausedScene);
+		m_ecs.AddComponent<CountingJobScript>(id);
+		scriptingSystem->RegisterSystem(id);
+		ids.push_back(id);
+	}
+
+	s_preparedJobs = 0;
+	scriptingSystem->Update();
+	scriptingSystem->Update();
+
+	EXPECT_EQ(s_preparedJobs, 2);
+	for (int i = 0; i < numScripts; ++i) {
+		const auto* script = m_ecs.GetComponent<CountingJobScript>(ids[i]);
+		EXPECT_EQ(script->starts, i % 10 ? 1 : 0);
+		EXPECT_EQ(script->updates, i % 10 ? 2 : 0);
+	}
+}
@@ -0,0 +1,141 @@
+/******************************************************************/
+/*!
+\file      graphics_test.cpp
+\author    Gabe Ng 2301290
+\par       gabe.ng@digipen.edu
+\date      Oct 18 2026
+\brief     This file contains test cases for the driver calls the
+		   renderers make each frame, counted by the null GL backend.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Resources/ResourceManager.h"
+#include "Graphics/NullGL.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/ShaderManager.h"
+#include "Graphics/UniformBlocks.h"
+#include "ResourceFiles.h"
+
+namespace {
+	class GraphicsFixture : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			if (!nullgl::IsInstalled()) nullgl::Install();
+
+			m_directory = std::filesystem::temp_directory_path() / "kos_graphics_test";
+			std::filesystem::create_directories(m_directory);
+			m_resourceManager.Init(m_directory.string());
+
+			m_shaderManager.Initialize();
+			m_frameUniforms.Initialize(uniformblock::FRAME_BINDING);
+			m_lightUniforms.Initialize(uniformblock::LIGHT_BINDING);
+			nullgl::ResetCallCounts();
+		}
+
+		void TearDown() override {
+			m_resourceManager.FinishPendingLoads();
+			std::filesystem::remove_all(m_directory);
+		}
+
+		Shader& EngineShader(const std::string& name) {
+			return m_shaderManager.engineShaders.at(name);
+		}
+
+		std::filesystem::path m_directory;
+		ResourceManager m_resourceManager;
+		ShaderManager m_shaderManager;
+		UniformBuffer<FrameBlock> m_frameUniforms;
+		UniformBuffer<LightBlock> m_lightUniforms;
+	};
+}
+
+TEST(UniformIDTest, ElementHashesMatchTheElementName) {
+	static_assert(UniformID("bones[3]").hash == UniformID::Element("bones", 3).hash);
+	static_assert(UniformID("light[12].position").hash == UniformID::Element("light", 12, "position").hash);
+	EXPECT_EQ(UniformID(std::string("model")).hash, UniformID("model").hash);
+	EXPECT_NE(UniformID("view").hash, UniformID("model").hash);
+}
+
+TEST_F(GraphicsFixture, MeshFramesMakeNoUniformLookups) {
+	constexpr int meshCount = 100;
+	const utility::GUID guid = testfiles::MakeGUID(1, 1);
+	testfiles::WriteMeshFile(m_resourceManager.GetResourcePath<R_Model>(guid));
+	std::shared_ptr<R_Model> model = m_resourceManager.GetResource<R_Model>(guid);
+	ASSERT_TRUE(model->IsReady());
+
+	PBRMaterial material{};
+	MeshRenderer meshRenderer;
+	meshRenderer.materialsToDraw.push_back(&material);
+	for (int i = 0; i < meshCount; ++i) {
+		meshRenderer.meshesToDraw[0].push_back(MeshData{ model.get(), 0, 1, glm::translate(glm::mat4{ 1.f }, glm::vec3{ static_cast<float>(i) }), i });
+	}
+
+	LightRenderer lightRenderer;
+	for (int i = 0; i < 8; ++i) {
+		lightRenderer.pointLightsToDraw.push_back(PointLightData{ glm::vec3{ static_cast<float>(i) }, glm::vec3{ 1.f }, glm::vec3{ 1.f }, glm::vec3{ 1.f }, 0.09f, 0.032f, 1.f });
+	}
+	LightBlock lightBlock{};
+
+	//what GraphicsManager does for one camera: upload the blocks, fill the G buffer and depth map
+	CameraData camera{};
+	Shader& gBufferShader = EngineShader("GBufferPBRShader");
+	Shader& depthMapShader = EngineShader("DepthMapShader");
+	auto renderFrame = [&]() {
+		FrameBlock frame;
+		frame.projection = camera.GetPerspMtx();
+		frame.view = camera.GetViewMtx();
+		frame.cameraPosition = camera.position;
+		m_frameUniforms.Upload(frame);
+		lightRenderer.FillLightBlock(lightBlock);
+		m_lightUniforms.Upload(lightBlock);
+
+		gBufferShader.Use();
+		meshRenderer.Render(camera, gBufferShader);
+		depthMapShader.Use();
+		depthMapShader.SetTrans("lightSpaceMatrix", glm::mat4{ 1.f });
+		meshRenderer.Render(camera, depthMapShader);
+	};
+
+	renderFrame();
+	const auto firstFrame = nullgl::GetCallCounts();
+	EXPECT_EQ(nullgl::GetCallCount("glGetUniformLocation"), 0u);
+	EXPECT_EQ(nullgl::GetCallCount("glBufferSubData"), 2u);
+	EXPECT_EQ(nullgl::GetCallCount("glDrawElements"), 2u * meshCount);
+	//model per mesh per pass and the light matrix, no light is set one uniform at a time
+	EXPECT_EQ(nullgl::GetCallCount("glUniformMatrix4fv"), 2u * meshCount + 1u);
+	EXPECT_EQ(nullgl::GetCallCount("glUniform3f"), 2u);
+
+	//the same work every frame, nothing is looked up on the first frame and cached after
+	nullgl::ResetCallCounts();
+	renderFrame();
+	EXPECT_EQ(nullgl::GetCallCounts(), firstFrame);
+}
+
+TEST_F(GraphicsFixture, LightsPastTheShaderArraysAreDropped) {
+	LightRenderer lightRenderer;
+	DirectionalLightData directional{ glm::vec3{}, glm::vec3{ 1.f }, glm::vec3{ 1.f }, glm::vec3{ 1.f }, 0.f, 0.f, 0.5f, glm::vec3{ 0.f, -1.f, 0.f } };
+	lightRenderer.directionLightsToDraw.push_back(directional);
+	for (size_t i = 0; i < uniformblock::MAX_SPOT_LIGHTS + 8; ++i) {
+		lightRenderer.spotLightsToDraw.push_back(SpotLightData{});
+	}
+
+	LightBlock lightBlock{};
+	lightRenderer.FillLightBlock(lightBlock);
+	m_lightUniforms.Upload(lightBlock);
+
+	EXPECT_EQ(lightBlock.pointLightNo, 0);
+	EXPECT_EQ(lightBlock.dirLightNo, 1);
+	EXPECT_EQ(lightBlock.spotLightNo, static_cast<int32_t>(uniformblock::MAX_SPOT_LIGHTS));
+	EXPECT_EQ(lightBlock.directionalLight[0].shadowMtx, directional.GetShadowMatrix());
+	EXPECT_EQ(lightBlock.directionalLight[0].direction, glm::vec3(0.f, 1.f, 0.f));
+	EXPECT_FLOAT_EQ(lightBlock.directionalLight[0].intensity, 0.5f);
+
+	//every light goes up in one buffer write
+	EXPECT_EQ(nullgl::GetCallCount("glBufferSubData"), 1u);
+	EXPECT_EQ(nullgl::GetCallCount("glUniform3f"), 0u);
+	EXPECT_EQ(nullgl::GetCallCount("glUniform1f"), 0u);
+}
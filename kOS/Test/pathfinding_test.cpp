@@ -0,0 +1,198 @@
+/******************************************************************/
+/*!
+\file      pathfinding_test.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains test cases for the octree navigation
+		   graph and the AStar search.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Pathfinding/OctreeGrid.h"
+#include "Pathfinding/PathQueryService.h"
+#include <queue>
+#include <random>
+
+using namespace Octrees;
+
+namespace {
+	Octree MakeOctree(int obstacleCount, unsigned seed) {
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> position(-14.f, 14.f);
+
+		std::vector<OctreeObject> obstacles;
+		for (int i = 0; i < obstacleCount; ++i) {
+			obstacles.emplace_back(Bounds(glm::vec3(position(rng), position(rng), position(rng)), glm::vec3(1.f)));
+		}
+
+		Octree octree;
+		octree.Build(Bounds(glm::vec3(0.f), glm::vec3(16.f)), 1.f, obstacles);
+		return octree;
+	}
+
+	std::set<std::pair<NodeIndex, NodeIndex>> GetGraphEdges(const Graph& graph) {
+		std::set<std::pair<NodeIndex, NodeIndex>> edges;
+		for (NodeIndex node = 0; node < graph.NodeCount(); ++node) {
+			for (uint32_t edge = graph.edgeOffsets[node]; edge < graph.edgeOffsets[node + 1]; ++edge) {
+				edges.insert({ std::min(node, graph.edgeTargets[edge]), std::max(node, graph.edgeTargets[edge]) });
+			}
+		}
+		return edges;
+	}
+
+	float Dijkstra(const Graph& graph, NodeIndex start, NodeIndex end) {
+		std::vector<float> distance(graph.NodeCount(), std::numeric_limits<float>::max());
+		using Entry = std::pair<float, NodeIndex>;
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<>> open;
+		distance[start] = 0.f;
+		open.push({ 0.f, start });
+		while (!open.empty()) {
+			const auto [cost, node] = open.top();
+			open.pop();
+			if (cost > distance[node]) continue;
+			for (uint32_t edge = graph.edgeOffsets[node]; edge < graph.edgeOffsets[node + 1]; ++edge) {
+				const NodeIndex target = graph.edgeTargets[edge];
+				if (cost + graph.edgeCosts[edge] < distance[target]) {
+					distance[target] = cost + graph.edgeCosts[edge];
+					open.push({ distance[target], target });
+				}
+			}
+		}
+		return distance[end];
+	}
+}
+
+TEST(Pathfinding, OctreeNeighboursMatchAllPairs) {
+	Octree octree = MakeOctree(60, 7);
+	ASSERT_GT(octree.emptyLeaves.size(), 100u);
+
+	std::set<std::pair<NodeIndex, NodeIndex>> expected;
+	for (const OctreeNode& leaf : octree.emptyLeaves) {
+		for (const OctreeNode& other : octree.emptyLeaves) {
+			if (leaf == other) continue;
+
+			Bounds otherBounds = other.bounds;
+			otherBounds.size *= 1.1f;
+			if (leaf.bounds.Intersects(otherBounds)) {
+				const NodeIndex a = static_cast<NodeIndex>(leaf.graphIndex), b = static_cast<NodeIndex>(other.graphIndex);
+				expected.insert({ std::min(a, b), std::max(a, b) });
+			}
+		}
+	}
+
+	EXPECT_EQ(GetGraphEdges(octree.graph), expected);
+}
+
+TEST(Pathfinding, AStarFindsShortestPath) {
+	Octree octree = MakeOctree(60, 11);
+	const Graph& graph = octree.graph;
+
+	std::mt19937 rng(5);
+	std::uniform_int_distribution<NodeIndex> pick(0, static_cast<NodeIndex>(graph.NodeCount() - 1));
+	SearchState state;
+	std::vector<NodeIndex> path;
+	for (int query = 0; query < 50; ++query) {
+		const NodeIndex start = pick(rng), end = pick(rng);
+		const float expected = Dijkstra(graph, start, end);
+
+		const bool found = graph.AStar(start, end, state, path);
+		ASSERT_EQ(found, expected != std::numeric_limits<float>::max());
+		if (!found) continue;
+
+		ASSERT_EQ(path.front(), start);
+		ASSERT_EQ(path.back(), end);
+		float cost{};
+		for (size_t i = 1; i < path.size(); ++i) {
+			cost += glm::distance(graph.nodeCenters[path[i - 1]], graph.nodeCenters[path[i]]);
+		}
+		EXPECT_NEAR(cost, expected, 1e-3f * std::max(1.f, expected));
+	}
+
+	//lookup by position lands on the graph node of the containing leaf
+	EXPECT_EQ(octree.FindClosestGraphNode(graph.nodeCenters[3]), 3u);
+}
+
+TEST(Pathfinding, QueryServiceCoalescesAgentsSharingATarget) {
+	auto octree = std::make_shared<Octree>(MakeOctree(60, 13));
+	const Graph& graph = octree->graph;
+
+	utility::JobSystem jobSystem(2);
+	PathQueryService service(jobSystem);
+	service.SetGraph(octree);
+	service.SetFrameBudget(1000.f);
+
+	std::mt19937 rng(9);
+	std::uniform_int_distribution<NodeIndex> pick(0, static_cast<NodeIndex>(graph.NodeCount() - 1));
+	const glm::vec3 targets[2] = { graph.nodeCenters[pick(rng)], graph.nodeCenters[pick(rng)] };
+
+	constexpr ecs::EntityID agentCount = 200;
+	std::vector<glm::vec3> starts;
+	for (ecs::EntityID agent = 0; agent < agentCount; ++agent) {
+		starts.push_back(graph.nodeCenters[pick(rng)]);
+		service.Request(agent, starts.back(), targets[agent % 2]);
+	}
+
+	service.Update();
+	service.Flush();
+	EXPECT_EQ(service.GetSearchCount(), 2u);
+	EXPECT_EQ(service.GetPendingCount(), 0u);
+
+	SearchState state;
+	std::vector<NodeIndex> reference;
+	for (ecs::EntityID agent = 0; agent < agentCount; ++agent) {
+		const PathBuffer* path = service.GetPath(agent);
+		ASSERT_NE(path, nullptr);
+		EXPECT_EQ(path->version, 1u);
+
+		const NodeIndex start = octree->FindClosestGraphNode(starts[agent]);
+		const NodeIndex end = octree->FindClosestGraphNode(targets[agent % 2]);
+		ASSERT_EQ(path->found, graph.AStar(start, end, state, reference));
+		if (!path->found) continue;
+
+		//same length as the agent's own AStar path, ending at the requested destination
+		float cost{}, expected{};
+		glm::vec3 previous = graph.nodeCenters[start];
+		for (const glm::vec3& point : path->points) {
+			cost += glm::distance(previous, point);
+			previous = point;
+		}
+		for (size_t i = 1; i < reference.size(); ++i) {
+			expected += glm::distance(graph.nodeCenters[reference[i - 1]], graph.nodeCenters[reference[i]]);
+		}
+		expected += glm::distance(graph.nodeCenters[end], targets[agent % 2]);
+		EXPECT_NEAR(cost, expected, 1e-3f * std::max(1.f, expected));
+		EXPECT_EQ(path->points.back(), targets[agent % 2]);
+	}
+}
+
+TEST(Pathfinding, QueryServiceSpreadsSearchesOverFrames) {
+	auto octree = std::make_shared<Octree>(MakeOctree(60, 17));
+	const Graph& graph = octree->graph;
+
+	utility::JobSystem jobSystem(0);
+	PathQueryService service(jobSystem);
+	service.SetGraph(octree);
+	//a budget smaller than any search still starts one search per frame
+	service.SetFrameBudget(0.f);
+
+	for (ecs::EntityID agent = 0; agent < 10; ++agent) {
+		service.Request(agent, graph.nodeCenters[agent], graph.nodeCenters[graph.NodeCount() - 1 - agent]);
+	}
+
+	int frames{};
+	while (service.GetPendingCount() > 0 || service.IsBusy()) {
+		service.Update();
+		++frames;
+	}
+	service.Update();
+
+	EXPECT_EQ(frames, 10);
+	for (ecs::EntityID agent = 0; agent < 10; ++agent) {
+		EXPECT_NE(service.GetPath(agent), nullptr);
+	}
+}
@@ -0,0 +1,169 @@
+/******************************************************************/
+/*!
+\file      physics_test.cpp
+\author    Toh Yu Heng 2301294
+\par       t.yuheng@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains test cases for the batched scene
+		   queries, run against a PhysX scene of static boxes, and for
+		   the transform sync between the ECS and PhysX.
+
+Copyright (C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "ECSFixture.h"
+#include "Physics/PhysicsManager.h"
+#include "Utility/JobSystem.h"
+
+using namespace physics;
+
+namespace {
+	class PhysicsFixture : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			m_physicsManager.Init();
+		}
+
+		void TearDown() override {
+			m_physicsManager.Shutdown();
+		}
+
+		//static box owned by entity on the given collider layer
+		void AddBox(const glm::vec3& center, const glm::vec3& halfExtents, uint32_t layer, unsigned int entity) {
+			PxPhysics* physics = m_physicsManager.GetPhysics();
+			PxShape* shape = physics->createShape(PxBoxGeometry{ halfExtents.x, halfExtents.y, halfExtents.z }, *m_physicsManager.GetDefaultMaterial(), true);
+			PxFilterData filter;
+			filter.word0 = layer;
+			shape->setQueryFilterData(filter);
+
+			PxRigidStatic* actor = physics->createRigidStatic(PxTransform{ PxVec3{ center.x, center.y, center.z } });
+			actor->attachShape(*shape);
+			shape->release();
+			actor->userData = reinterpret_cast<void*>(static_cast<uintptr_t>(entity));
+			m_physicsManager.GetScene()->addActor(*actor);
+		}
+
+		physics::PhysicsManager m_physicsManager;
+		utility::JobSystem m_jobSystem;
+	};
+}
+
+TEST_F(PhysicsFixture, QueuedQueriesResolveWhenTheBatchExecutes) {
+	AddBox(glm::vec3{ 0.f, 0.f, 10.f }, glm::vec3{ 1.f }, 1, 7);
+	AddBox(glm::vec3{ 0.f, 0.f, 20.f }, glm::vec3{ 1.f }, 2, 8);
+
+	SceneQueries& queries = m_physicsManager.GetSceneQueries();
+	const QueryHandle nearest = queries.Raycast(glm::vec3{ 0.f }, glm::vec3{ 0.f, 0.f, 1.f }, 100.f);
+	const QueryHandle masked = queries.Raycast(glm::vec3{ 0.f }, glm::vec3{ 0.f, 0.f, 1.f }, 100.f, 1u << 2);
+	const QueryHandle missed = queries.Raycast(glm::vec3{ 0.f }, glm::vec3{ 1.f, 0.f, 0.f }, 100.f);
+	const QueryHandle overlap = queries.OverlapSphere(glm::vec3{ 0.f, 0.f, 15.f }, 10.f);
+	const QueryHandle sweep = queries.SweepSphere(glm::vec3{ 0.f }, 0.5f, glm::vec3{ 0.f, 0.f, 1.f }, 100.f);
+	const QueryHandle box = queries.OverlapBox(glm::vec3{ 0.f, 0.f, 20.f }, glm::vec3{ 2.f }, glm::quat{ 1.f, 0.f, 0.f, 0.f });
+	EXPECT_EQ(queries.GetQueuedCount(), 6u);
+	EXPECT_EQ(queries.GetResult(nearest), nullptr);
+
+	m_physicsManager.ExecuteSceneQueries(&m_jobSystem);
+	EXPECT_EQ(queries.GetQueuedCount(), 0u);
+
+	const QueryResult* result = queries.GetResult(nearest);
+	ASSERT_NE(result, nullptr);
+	ASSERT_TRUE(result->hasHit);
+	EXPECT_EQ(result->hit.entityID, 7u);
+	EXPECT_NEAR(result->hit.distance, 9.f, 1e-3f);
+
+	//layer 1 is outside the mask
+	result = queries.GetResult(masked);
+	ASSERT_NE(result, nullptr);
+	ASSERT_TRUE(result->hasHit);
+	EXPECT_EQ(result->hit.entityID, 8u);
+
+	EXPECT_FALSE(queries.GetResult(missed)->hasHit);
+	EXPECT_EQ(queries.GetResult(overlap)->overlapCount, 2u);
+	ASSERT_TRUE(queries.GetResult(sweep)->hasHit);
+	EXPECT_EQ(queries.GetResult(sweep)->hit.entityID, 7u);
+	ASSERT_EQ(queries.GetResult(box)->overlapCount, 1u);
+	EXPECT_EQ(queries.GetResult(box)->overlaps[0], 8u);
+
+	//results last until the next batch executes
+	m_physicsManager.ExecuteSceneQueries(&m_jobSystem);
+	EXPECT_EQ(queries.GetResult(nearest), nullptr);
+}
+
+TEST_F(PhysicsFixture, QueriesCanBeQueuedFromWorkers) {
+	constexpr size_t numQueries = 1000;
+	AddBox(glm::vec3{ 0.f, 0.f, 10.f }, glm::vec3{ 100.f, 100.f, 1.f }, 0, 3);
+
+	std::vector<QueryHandle> handles(numQueries);
+	SceneQueries& queries = m_physicsManager.GetSceneQueries();
+	m_jobSystem.ParallelFor(numQueries, 16, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			handles[i] = queries.Raycast(glm::vec3{ static_cast<float>(i % 50), 0.f, 0.f }, glm::vec3{ 0.f, 0.f, 1.f }, 100.f);
+		}
+	});
+	m_physicsManager.ExecuteSceneQueries(&m_jobSystem);
+
+	for (const QueryHandle& handle : handles) {
+		const QueryResult* result = queries.GetResult(handle);
+		ASSERT_NE(result, nullptr);
+		EXPECT_TRUE(result->hasHit);
+		EXPECT_EQ(result->hit.entityID, 3u);
+	}
+}
+
+TEST_F(ECSFixture, PhysicsSyncOnlyTouchesChangedAndMovingBodies) {
+	m_physicsManager.Init();
+	auto physicsSystem = MakeSystem<ecs::PhysicsSystem>();
+	const float fixedStep = m_physicsManager.FixedDeltaTime();
+
+	auto addBody = [&](const glm::vec3& position, bool useGravity) {
+		ecs::EntityID id = m_ecs.CreateEntity(sceneName);
+		m_ecs.GetComponent<ecs::TransformComponent>(id)->LocalTransformation.position = position;
+
+		PxRigidDynamic* actor = m_physicsManager.GetPhysics()->createRigidDynamic(PxTransform{ PxVec3{ position.x, position.y, position.z } });
+		PxRigidActorExt::createExclusiveShape(*actor, PxSphereGeometry{ 0.5f }, *m_physicsManager.GetDefaultMaterial());
+		actor->setActorFlag(PxActorFlag::eDISABLE_GRAVITY, !useGravity);
+		actor->userData = reinterpret_cast<void*>(static_cast<uintptr_t>(id));
+		m_physicsManager.GetScene()->addActor(*actor);
+
+		m_ecs.AddComponent<ecs::RigidbodyComponent>(id)->actor = actor;
+		physicsSystem->RegisterSystem(id);
+		return id;
+	};
+
+	//the ECS update runs the transform system and sets the delta time the physics system steps with
+	auto runFrame = [&]() {
+		m_ecs.Update(fixedStep);
+		physicsSystem->Update();
+	};
+
+	const ecs::EntityID prop = addBody(glm::vec3{ 0.f }, false);
+	const ecs::EntityID ball = addBody(glm::vec3{ 10.f, 10.f, 0.f }, true);
+	PxRigidDynamic* propActor = static_cast<PxRigidDynamic*>(m_ecs.GetComponent<ecs::RigidbodyComponent>(prop)->actor);
+	PxRigidDynamic* ballActor = static_cast<PxRigidDynamic*>(m_ecs.GetComponent<ecs::RigidbodyComponent>(ball)->actor);
+
+	//new bodies are pushed once, only the falling ball is read back
+	runFrame();
+	EXPECT_EQ(physicsSystem->GetPushedCount(), 2u);
+	EXPECT_EQ(physicsSystem->GetReadbackCount(), 1u);
+
+	//the ball's readback is not pushed again and the prop is left to fall asleep
+	for (int frame = 0; frame < 100; ++frame) {
+		runFrame();
+		EXPECT_EQ(physicsSystem->GetPushedCount(), 0u);
+	}
+	EXPECT_TRUE(propActor->isSleeping());
+	EXPECT_FALSE(ballActor->isSleeping());
+	EXPECT_NEAR(m_ecs.GetComponent<ecs::TransformComponent>(ball)->WorldTransformation.position.y, ballActor->getGlobalPose().p.y, 1e-4f);
+
+	//moving the prop in the ECS teleports and wakes it
+	m_ecs.GetComponent<ecs::TransformComponent>(prop)->LocalTransformation.position = glm::vec3{ 3.f, 0.f, 0.f };
+	runFrame();
+	EXPECT_EQ(physicsSystem->GetPushedCount(), 1u);
+	EXPECT_FALSE(propActor->isSleeping());
+	EXPECT_FLOAT_EQ(propActor->getGlobalPose().p.x, 3.f);
+
+	m_physicsManager.Shutdown();
+}
@@ -0,0 +1,183 @@
+/******************************************************************/
+/*!
+\file      resource_test.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      Oct 18, 2026
+\brief     This file contains test cases for the resource manager's
+		   background loading, run against the null GL backend.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include <gtest/gtest.h>
+#include "Resources/ResourceManager.h"
+#include "Graphics/NullGL.h"
+#include "ResourceFiles.h"
+
+namespace {
+	class ResourceFixture : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			if (!nullgl::IsInstalled()) nullgl::Install();
+			nullgl::ResetCallCounts();
+
+			m_directory = std::filesystem::temp_directory_path() / "kos_resource_test";
+			std::filesystem::create_directories(m_directory);
+			m_resourceManager.Init(m_directory.string());
+		}
+
+		void TearDown() override {
+			m_resourceManager.FinishPendingLoads();
+			std::filesystem::remove_all(m_directory);
+		}
+
+		utility::GUID AddMesh(uint64_t id, size_t vertexCount = 3) {
+			const utility::GUID guid = testfiles::MakeGUID(1, id);
+			testfiles::WriteMeshFile(m_resourceManager.GetResourcePath<R_Model>(guid), vertexCount);
+			return guid;
+		}
+
+		//runs frames until the resource is uploaded, false if it never is
+		bool WaitUntilReady(const Resource& resource) {
+			for (int frames = 0; frames < 10000 && !resource.IsReady(); ++frames) {
+				m_resourceManager.ProcessUploads();
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			return resource.IsReady();
+		}
+
+		std::filesystem::path m_directory;
+		ResourceManager m_resourceManager;
+	};
+}
+
+TEST_F(ResourceFixture, AsyncResourceIsAPlaceholderUntilUploaded) {
+	const utility::GUID guid = AddMesh(1);
+
+	std::shared_ptr<R_Model> mesh = m_resourceManager.GetResourceAsync<R_Model>(guid);
+	ASSERT_TRUE(mesh);
+	//GL objects are only created by ProcessUploads
+	EXPECT_FALSE(mesh->IsReady());
+	EXPECT_TRUE(mesh->GetBoneMap().empty());
+	EXPECT_EQ(nullgl::GetCallCount("glGenVertexArrays"), 0u);
+	EXPECT_EQ(m_resourceManager.GetResourceAsync<R_Model>(guid), mesh);
+
+	ASSERT_TRUE(WaitUntilReady(*mesh));
+	EXPECT_EQ(mesh->GetBoneMap().size(), 1u);
+	EXPECT_EQ(mesh->GetBoneInfo().size(), 1u);
+	EXPECT_EQ(nullgl::GetCallCount("glGenVertexArrays"), 1u);
+	EXPECT_EQ(m_resourceManager.GetPendingLoadCount(), 0u);
+}
+
+TEST_F(ResourceFixture, BlockingRequestFinishesAnAsyncLoad) {
+	const utility::GUID guid = AddMesh(2);
+
+	std::shared_ptr<R_Model> pending = m_resourceManager.GetResourceAsync<R_Model>(guid);
+	std::shared_ptr<R_Model> mesh = m_resourceManager.GetResource<R_Model>(guid);
+	EXPECT_EQ(pending, mesh);
+	EXPECT_TRUE(mesh->IsReady());
+	EXPECT_EQ(mesh->GetBoneMap().size(), 1u);
+
+	//the queued upload is skipped, not done twice
+	m_resourceManager.FinishPendingLoads();
+	EXPECT_EQ(nullgl::GetCallCount("glGenVertexArrays"), 1u);
+}
+
+TEST_F(ResourceFixture, UploadsStayWithinTheFrameBudget) {
+	constexpr int meshCount = 8;
+	std::vector<std::shared_ptr<R_Model>> meshes;
+	for (int i = 0; i < meshCount; ++i) {
+		meshes.push_back(m_resourceManager.GetResourceAsync<R_Model>(AddMesh(100 + i)));
+	}
+
+	//smaller than one mesh, every frame uploads exactly one
+	m_resourceManager.SetUploadBudget(1);
+	size_t readyCount{};
+	for (int frames = 0; frames < 10000 && readyCount < meshCount; ++frames) {
+		m_resourceManager.ProcessUploads();
+		const size_t nowReady = std::count_if(meshes.begin(), meshes.end(), [](const auto& mesh) { return mesh->IsReady(); });
+		EXPECT_LE(nowReady, readyCount + 1);
+		readyCount = nowReady;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_EQ(readyCount, static_cast<size_t>(meshCount));
+}
+
+TEST_F(ResourceFixture, PrefetchFindsTheTypeFromTheFile) {
+	const utility::GUID guid = AddMesh(3);
+	const utility::GUID missing = testfiles::MakeGUID(2, 1);
+
+	m_resourceManager.Prefetch({ guid, missing });
+	m_resourceManager.FinishPendingLoads();
+
+	std::shared_ptr<R_Model> mesh = m_resourceManager.GetResourceAsync<R_Model>(guid);
+	ASSERT_TRUE(mesh);
+	EXPECT_TRUE(mesh->IsReady());
+	EXPECT_EQ(mesh->GetBoneMap().size(), 1u);
+	EXPECT_EQ(m_resourceManager.GetPendingLoadCount(), 0u);
+}
+
+TEST_F(ResourceFixture, HandleGoesStaleWhenTheResourceIsUnloaded) {
+	const utility::GUID guid = AddMesh(4);
+
+	ResourceHandle<R_Model> handle = m_resourceManager.GetHandle<R_Model>(guid);
+	ASSERT_FALSE(handle.IsNull());
+	EXPECT_EQ(m_resourceManager.GetHandle<R_Model>(guid), handle);
+	R_Model* mesh = m_resourceManager.Resolve(handle);
+	ASSERT_NE(mesh, nullptr);
+	EXPECT_EQ(mesh, m_resourceManager.GetResourceAsync<R_Model>(guid).get());
+	EXPECT_EQ(m_resourceManager.Resolve(ResourceHandle<R_Model>{}), nullptr);
+
+	//nothing outside the manager holds the mesh
+	m_resourceManager.FinishPendingLoads();
+	m_resourceManager.CollectGarbage();
+	EXPECT_EQ(m_resourceManager.Resolve(handle), nullptr);
+
+	//the slot is reused under a new version
+	ResourceHandle<R_Model> reloaded = m_resourceManager.GetHandle<R_Model>(guid);
+	EXPECT_EQ(reloaded.index, handle.index);
+	EXPECT_NE(reloaded.version, handle.version);
+	EXPECT_EQ(m_resourceManager.Resolve(handle), nullptr);
+	EXPECT_NE(m_resourceManager.Resolve(reloaded), nullptr);
+}
+
+TEST_F(ResourceFixture, LeastRecentlyUsedResourcesAreEvictedOverBudget) {
+	const utility::GUID oldest = AddMesh(10);
+	const utility::GUID held = AddMesh(11);
+	const utility::GUID recent = AddMesh(12);
+
+	std::shared_ptr<R_Model> heldMesh = m_resourceManager.GetResource<R_Model>(held);
+	ResourceHandle<R_Model> oldestHandle = m_resourceManager.GetHandle<R_Model>(oldest);
+	m_resourceManager.FinishPendingLoads();
+	m_resourceManager.EndFrame();
+	ResourceHandle<R_Model> recentHandle = m_resourceManager.GetHandle<R_Model>(recent);
+	m_resourceManager.FinishPendingLoads();
+	m_resourceManager.EndFrame();
+
+	const ResourceMemory resident = m_resourceManager.GetResidentMemory();
+	auto byType = m_resourceManager.GetMemoryUsageByType();
+	ASSERT_EQ(byType.at(R_Model::classname()).count, 3u);
+	EXPECT_GT(resident.gpuBytes, 0u);
+	EXPECT_EQ(byType.at(R_Model::classname()).memory.Total(), resident.Total());
+
+	//nothing is evicted while within the budget
+	m_resourceManager.SetMemoryBudget(resident.Total());
+	m_resourceManager.EndFrame();
+	EXPECT_EQ(m_resourceManager.GetResidentMemory().Total(), resident.Total());
+
+	//room for two of the three meshes, the held mesh is as old but referenced
+	m_resourceManager.SetMemoryBudget(resident.Total() / 3 * 2);
+	ASSERT_NE(m_resourceManager.Resolve(recentHandle), nullptr);
+	m_resourceManager.EndFrame();
+	EXPECT_EQ(m_resourceManager.Resolve(oldestHandle), nullptr);
+	EXPECT_NE(m_resourceManager.Resolve(recentHandle), nullptr);
+	EXPECT_TRUE(heldMesh->IsReady());
+	EXPECT_EQ(m_resourceManager.GetResidentMemory().Total(), resident.Total() / 3 * 2);
+	EXPECT_EQ(nullgl::GetCallCount("glDeleteVertexArrays"), 1u);
+
+	byType = m_resourceManager.GetMemoryUsageByType();
+	EXPECT_EQ(byType.at(R_Model::classname()).count, 2u);
+}
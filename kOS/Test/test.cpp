@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "ECS/ECS.h"
 #include "Scene/SceneManager.h"
 #include "Utility/MathUtility.h"
+#include "Debugging/Profiler.h"
 #include "glm/gtx/euler_angles.hpp"
 #include <glm/gtx/matrix_decompose.hpp>
 #include <glm/gtx/string_cast.hpp>
@@ -43,6 +44,25 @@ SERIALIZE_DESERIALIZE_COMPARE_TEST(RigidbodyComponent)
 SERIALIZE_DESERIALIZE_COMPARE_TEST(CharacterControllerComponent)
 // Add more component tests as needed
 
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(TransformComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(NameComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(SpriteComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(CameraComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(AudioComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(TextComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(CanvasRendererComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(MeshFilterComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(MeshRendererComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(SkinnedMeshRendererComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(AnimatorComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(LightComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(ScriptComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(BoxColliderComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(CapsuleColliderComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(SphereColliderComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(RigidbodyComponent)
+BINARY_SERIALIZE_DESERIALIZE_COMPARE_TEST(CharacterControllerComponent)
+
 
 //TEST(Scene, CreateScene) {
 //    scenes::SceneManager sm;
@@ -127,3 +147,46 @@ TEST(Math, RandomDecomposeTRS) {
     }
 }
 
+TEST(Profiler, NestedZonesAreCollectedAndExported) {
+    auto& profiler = profiling::Profiler::GetInstance();
+    profiler.SetEnabled(true);
+    //drain whatever other tests recorded
+    profiler.EndFrame();
+
+    profiler.BeginCapture(1);
+    {
+        KOS_PROFILE_SCOPE("ProfilerTest::Outer");
+        for (int i = 0; i < 3; ++i) {
+            KOS_PROFILE_SCOPE("ProfilerTest::Inner");
+        }
+        std::thread worker([]() {
+            profiling::Profiler::SetThreadName("ProfilerTest Worker");
+            KOS_PROFILE_SCOPE("ProfilerTest::Worker");
+        });
+        worker.join();
+    }
+    profiler.EndFrame();
+
+    const auto outer = profiler.GetZoneStats("ProfilerTest::Outer");
+    const auto inner = profiler.GetZoneStats("ProfilerTest::Inner");
+    const auto worker = profiler.GetZoneStats("ProfilerTest::Worker");
+    ASSERT_TRUE(outer && inner && worker);
+    EXPECT_EQ(outer->calls, 1u);
+    EXPECT_EQ(inner->calls, 3u);
+    EXPECT_EQ(worker->calls, 1u);
+    //the parent zone contains its children
+    EXPECT_GE(outer->max, inner->max);
+
+    const std::filesystem::path tracePath = std::filesystem::temp_directory_path() / "KosProfilerTest.json";
+    ASSERT_TRUE(profiler.WriteChromeTrace(tracePath));
+    std::ifstream traceFile(tracePath);
+    const std::string trace((std::istreambuf_iterator<char>(traceFile)), std::istreambuf_iterator<char>());
+    traceFile.close();
+    std::filesystem::remove(tracePath);
+
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"ProfilerTest::Inner\",\"cat\":\"kos\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("ProfilerTest Worker"), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Frame\""), std::string::npos);
+    EXPECT_FALSE(profiler.IsCapturing());
+}